@@ -112,6 +112,12 @@ public final class PrismGraphicsManager extends WCGraphicsManager {
         return new WCPathImpl((WCPathImpl)path);
     }
 
+    @Override
+    protected WCPath createWCPath(byte[] types, int numTypes,
+                                  float[] coords, int numCoords) {
+        return new WCPathImpl(types, numTypes, coords, numCoords);
+    }
+
     @Override
     protected WCImage createWCImage(int w, int h) {
         return new WCImageImpl(w, h);
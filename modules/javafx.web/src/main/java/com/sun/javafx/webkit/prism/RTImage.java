@@ -48,6 +48,8 @@ import java.nio.IntBuffer;
  */
 final class RTImage extends PrismImage implements ResourceFactoryListener {
     private RTTexture txt;
+    // Staging texture for the parts of [pixelBuffer] changed natively.
+    private Texture uploadTexture;
     private final int width, height;
     private WeakReference<ResourceFactory> registeredWithFactory = null;
     private ByteBuffer pixelBuffer;
@@ -172,10 +174,7 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
     @Override
     void dispose() {
         PrismInvoker.invokeOnRenderThread(() -> {
-            if (txt != null) {
-                txt.dispose();
-                txt = null;
-            }
+            disposeTextures();
         });
     }
 
@@ -241,42 +240,67 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
         return pixelBuffer;
     }
 
-    // This method is called from native [ImageBufferData::update]
-    // while lazy painting procedure
+    // This method is called from native [ImageBufferJavaBackend::uploadDirtyPixels]
+    // before the image is drawn into or painted. Only the given rectangle
+    // of the pixel buffer has changed since the last upload.
     @Override
-    protected void drawPixelBuffer() {
+    protected void drawPixelBuffer(int x, int y, int w, int h) {
         PrismInvoker.invokeOnRenderThread(new Runnable() {
             public void run() {
                 //[g] field can be null if it is the first paint
                 //from synthetic ImageData or if the resource factory is disposed
                 Graphics g = getGraphics();
-                if (g != null && pixelBuffer != null) {
+                if (g == null || pixelBuffer == null) {
+                    return;
+                }
+                // A texture is returned locked by createTexture(), a cached
+                // one is locked here; either way it is unlocked once below.
+                if (uploadTexture != null) {
+                    uploadTexture.lock();
+                    if (uploadTexture.isSurfaceLost()) {
+                        uploadTexture.unlock();
+                        uploadTexture.dispose();
+                        uploadTexture = null;
+                    }
+                }
+                if (uploadTexture == null) {
+                    uploadTexture = g.getResourceFactory().createTexture(
+                            PixelFormat.BYTE_BGRA_PRE, Texture.Usage.DYNAMIC,
+                            Texture.WrapMode.CLAMP_NOT_NEEDED, width, height);
+                    if (uploadTexture == null) {
+                        return;
+                    }
+                }
+                try {
                     pixelBuffer.rewind();//critical!
-                    Image img = Image.fromByteBgraPreData(
-                            pixelBuffer,
-                            width,
-                            height);
-                    Texture txt = g.getResourceFactory().createTexture(img, Texture.Usage.DEFAULT, Texture.WrapMode.CLAMP_NOT_NEEDED);
-                    g.clear();
-                    g.drawTexture(txt, 0, 0, width, height);
-                    txt.dispose();
+                    uploadTexture.update(pixelBuffer, PixelFormat.BYTE_BGRA_PRE,
+                            x, y, x, y, w, h, width * 4, false);
+                    g.setCompositeMode(CompositeMode.SRC);
+                    g.drawTexture(uploadTexture, x, y, x + w, y + h, x, y, x + w, y + h);
+                } finally {
+                    uploadTexture.unlock();
                 }
             }
         });
     }
 
-    @Override public void factoryReset() {
+    private void disposeTextures() {
         if (txt != null) {
             txt.dispose();
             txt = null;
         }
+        if (uploadTexture != null) {
+            uploadTexture.dispose();
+            uploadTexture = null;
+        }
+    }
+
+    @Override public void factoryReset() {
+        disposeTextures();
     }
 
     @Override public void factoryReleased() {
-        if (txt != null) {
-            txt.dispose();
-            txt = null;
-        }
+        disposeTextures();
     }
 
     @Override
@@ -26,10 +26,12 @@
 package com.sun.javafx.webkit.prism;
 
 import com.sun.javafx.font.CharToGlyphMapper;
+import com.sun.javafx.font.CompositeFontResource;
 import com.sun.javafx.font.FontFactory;
 import com.sun.javafx.font.FontResource;
 import com.sun.javafx.font.FontStrike;
 import com.sun.javafx.font.PGFont;
+import com.sun.javafx.font.PrismFontFile;
 import com.sun.javafx.geom.BaseBounds;
 import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.javafx.logging.PlatformLogger.Level;
@@ -41,6 +43,9 @@ import com.sun.javafx.webkit.prism.WCTextRunImpl;
 import com.sun.prism.GraphicsPipeline;
 import com.sun.webkit.graphics.WCFont;
 import com.sun.webkit.graphics.WCTextRun;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
 import java.util.Arrays;
 import java.util.HashMap;
 import static com.sun.javafx.webkit.prism.TextUtilities.getLayoutBounds;
@@ -121,29 +126,58 @@ final class WCFontImpl extends WCFont {
         return new float[]{bb[0], -bb[3], bb[2], bb[3] - bb[1]};
     }
 
+    @Override public void getGlyphAdvances(int firstGlyph, int count, ByteBuffer advances) {
+        FontResource resource = getFontStrike().getFontResource();
+        float size = font.getSize();
+        FloatBuffer out = advances.order(ByteOrder.nativeOrder()).asFloatBuffer();
+        for (int i = 0; i < count; i++) {
+            out.put(resource.getAdvance(firstGlyph + i, size));
+        }
+    }
+
+    @Override public void getGlyphBoundingBoxes(int firstGlyph, int count, ByteBuffer boxes) {
+        FontResource resource = getFontStrike().getFontResource();
+        float size = font.getSize();
+        FloatBuffer out = boxes.order(ByteOrder.nativeOrder()).asFloatBuffer();
+        float[] bb = new float[4];
+        for (int i = 0; i < count; i++) {
+            bb = resource.getGlyphBoundingBox(firstGlyph + i, size, bb);
+            out.put(bb[0]).put(-bb[3]).put(bb[2]).put(bb[3] - bb[1]);
+        }
+    }
+
+    @Override public byte[] getFontTable(int tag) {
+        FontResource resource = getFontStrike().getFontResource();
+        if (resource instanceof CompositeFontResource) {
+            // Glyph codes without a slot refer to the primary font.
+            resource = ((CompositeFontResource) resource).getSlotResource(0);
+        }
+        return (resource instanceof PrismFontFile)
+                ? ((PrismFontFile) resource).getTableBytes(tag)
+                : null;
+    }
+
     @Override public float getXHeight() {
         return getFontStrike().getMetrics().getXHeight();
     }
 
-    private static boolean needsTextLayout(final int glyphs[]) {
-        for (int g : glyphs) {
-            if (g == 0) {
+    private static boolean needsTextLayout(final int glyphs[], int length) {
+        for (int i = 0; i < length; i++) {
+            if (glyphs[i] == 0) {
                 return true;
             }
         }
         return false;
     }
 
-    @Override public int[] getGlyphCodes(char[] chars) {
-        int[] glyphs = new int[chars.length];
+    @Override public void getGlyphCodes(char[] chars, int length, int[] glyphs) {
         CharToGlyphMapper mapper = getFontStrike().getFontResource().getGlyphMapper();
-        mapper.charsToGlyphs(chars.length, chars, glyphs);
-        if (needsTextLayout(glyphs)) {
+        mapper.charsToGlyphs(length, chars, glyphs);
+        if (needsTextLayout(glyphs, length)) {
             // Call charsToGlyphs once again after doing layout if any of the glyph index is zero
-            TextUtilities.createLayout(new String(chars), getPlatformFont()).getRuns();
-            mapper.charsToGlyphs(chars.length, chars, glyphs);
+            TextUtilities.createLayout(new String(chars, 0, length), getPlatformFont()).getRuns();
+            mapper.charsToGlyphs(length, chars, glyphs);
         }
-        return glyphs;
     }
 
     public float getAscent() {
@@ -64,6 +64,16 @@ final class WCPathImpl extends WCPath<Path2D> {
         hasCP = wcp.hasCP;
     }
 
+    WCPathImpl(byte[] types, int numTypes, float[] coords, int numCoords) {
+        if (log.isLoggable(Level.FINE)) {
+            log.fine("Create WCPathImpl({0}) with {1} segments",
+                    new Object[] { getID(), numTypes });
+        }
+        path = new Path2D(Path2D.WIND_NON_ZERO, types, numTypes,
+                          coords, numCoords);
+        hasCP = numTypes > 0;
+    }
+
     public void addRect(double x, double y, double w, double h) {
         if (log.isLoggable(Level.FINE)) {
             log.fine("WCPathImpl({0}).addRect({1},{2},{3},{4})",
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+import com.sun.javafx.logging.PlatformLogger;
+import java.io.File;
+
+/**
+ * A collection of static methods for managing the disk cache, which keeps
+ * HTTP responses loaded by all pages of the process across runs. Fresh
+ * responses are loaded from the cache without a request; stale responses
+ * with an {@code ETag} or {@code Last-Modified} header are revalidated
+ * with a conditional request, and their body is reused when the server
+ * answers {@code 304 Not Modified}.
+ *
+ * The cache is disabled until a directory is set, either with
+ * {@link #setDirectory} or with
+ * {@code -Dcom.sun.webkit.diskCache=<directory>}. The capacity may be given
+ * with {@code -Dcom.sun.webkit.diskCacheSize=<bytes>}.
+ */
+public final class DiskCache {
+
+    private static final PlatformLogger log =
+            PlatformLogger.getLogger(DiskCache.class.getName());
+
+    /**
+     * The capacity used when none is given.
+     */
+    public static final long DEFAULT_CAPACITY = 50L * 1024 * 1024;
+
+    private static File directory;
+    private static long capacity;
+
+    /**
+     * The private default constructor. Ensures non-instantiability.
+     */
+    private DiskCache() {
+        throw new AssertionError();
+    }
+
+    /**
+     * Enables the disk cache given by the {@code com.sun.webkit.diskCache}
+     * system property, if any. Called when the first page is created.
+     */
+    static void install() {
+        String path = System.getProperty("com.sun.webkit.diskCache");
+        if (path == null || path.isEmpty()) {
+            return;
+        }
+        long size = DEFAULT_CAPACITY;
+        String sizeValue = System.getProperty("com.sun.webkit.diskCacheSize");
+        if (sizeValue != null) {
+            try {
+                size = Long.parseLong(sizeValue);
+            } catch (NumberFormatException ex) {
+                log.warning("Ignoring invalid disk cache size: " + sizeValue);
+            }
+        }
+        try {
+            setDirectory(new File(path), size);
+        } catch (IllegalArgumentException ex) {
+            log.warning("Ignoring invalid disk cache: " + ex.getMessage());
+        }
+    }
+
+    /**
+     * Returns the directory of the disk cache.
+     * @return the directory, or {@code null} if the cache is disabled
+     */
+    public static File getDirectory() {
+        return directory;
+    }
+
+    /**
+     * Returns the capacity of the disk cache.
+     * @return the capacity, in bytes, or 0 if the cache is disabled
+     */
+    public static long getCapacity() {
+        return capacity;
+    }
+
+    /**
+     * Enables the disk cache in a directory, reusing the responses already
+     * stored there, or disables it. Entries over the capacity are evicted,
+     * least recently used first.
+     * @param dir the directory, or {@code null} to disable the cache
+     * @param capacity the capacity, in bytes
+     * @throws IllegalArgumentException if {@code capacity} is negative
+     * @throws IllegalStateException if not called on the event thread
+     */
+    public static void setDirectory(File dir, long capacity) {
+        if (capacity < 0) {
+            throw new IllegalArgumentException(
+                    "capacity is negative: " + capacity);
+        }
+        Invoker.getInvoker().checkEventThread();
+        twkSetDirectory(dir != null ? dir.getAbsolutePath() : null,
+                dir != null ? capacity : 0);
+        directory = dir;
+        DiskCache.capacity = dir != null ? capacity : 0;
+    }
+
+    /**
+     * Removes all responses from the disk cache.
+     * @throws IllegalStateException if not called on the event thread
+     */
+    public static void clear() {
+        Invoker.getInvoker().checkEventThread();
+        twkClear();
+    }
+
+    /**
+     * Returns the size of the response bodies in the disk cache.
+     * @return the size, in bytes
+     */
+    public static long getSize() {
+        return twkGetSize();
+    }
+
+    /**
+     * Returns the number of loads answered from the disk cache without a
+     * request.
+     * @return the hit count
+     */
+    public static long getHitCount() {
+        return twkGetHitCount();
+    }
+
+    /**
+     * Returns the number of cacheable loads the disk cache had no usable
+     * response for.
+     * @return the miss count
+     */
+    public static long getMissCount() {
+        return twkGetMissCount();
+    }
+
+    /**
+     * Returns the number of cached responses the server confirmed with
+     * {@code 304 Not Modified}.
+     * @return the validation count
+     */
+    public static long getValidationCount() {
+        return twkGetValidationCount();
+    }
+
+    /**
+     * Returns the number of responses written to the disk cache.
+     * @return the store count
+     */
+    public static long getStoreCount() {
+        return twkGetStoreCount();
+    }
+
+    native private static void twkSetDirectory(String directory,
+            long capacity);
+    native private static void twkClear();
+    native private static long twkGetSize();
+    native private static long twkGetHitCount();
+    native private static long twkGetMissCount();
+    native private static long twkGetValidationCount();
+    native private static long twkGetStoreCount();
+}
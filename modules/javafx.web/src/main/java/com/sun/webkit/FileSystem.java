@@ -34,8 +34,11 @@ import static java.lang.String.format;
 import java.nio.ByteBuffer;
 import java.nio.channels.FileChannel;
 import java.nio.file.Files;
+import java.nio.file.AtomicMoveNotSupportedException;
 import java.nio.file.InvalidPathException;
+import java.nio.file.Path;
 import java.nio.file.Paths;
+import java.nio.file.StandardCopyOption;
 
 final class FileSystem {
 
@@ -91,6 +94,39 @@ final class FileSystem {
         }
     }
 
+    private static int fwkWriteToFile(RandomAccessFile raf, ByteBuffer byteBuffer) {
+        try {
+            FileChannel fc = raf.getChannel();
+            int written = 0;
+            while (byteBuffer.hasRemaining()) {
+                written += fc.write(byteBuffer);
+            }
+            return written;
+        } catch (IOException ex) {
+            logger.fine(format("Error while writing RandomAccessFile for file [%s]", raf), ex);
+        }
+        return -1;
+    }
+
+    private static boolean fwkTruncateFile(RandomAccessFile raf, long length) {
+        try {
+            raf.setLength(length);
+            return true;
+        } catch (IOException ex) {
+            logger.fine(format("Error while truncating RandomAccessFile for file [%s]", raf), ex);
+        }
+        return false;
+    }
+
+    private static long fwkGetFileLength(RandomAccessFile raf) {
+        try {
+            return raf.length();
+        } catch (IOException ex) {
+            logger.fine(format("Error determining length of RandomAccessFile for file [%s]", raf), ex);
+        }
+        return -1;
+    }
+
     private static long fwkGetFileSize(String path) {
         try {
             File file = new File(path);
@@ -140,6 +176,44 @@ final class FileSystem {
         }
     }
 
+    private static boolean fwkMoveFile(String oldPath, String newPath) {
+        try {
+            Path source = Paths.get(oldPath);
+            Path target = Paths.get(newPath);
+            try {
+                Files.move(source, target, StandardCopyOption.ATOMIC_MOVE);
+            } catch (AtomicMoveNotSupportedException ex) {
+                Files.move(source, target, StandardCopyOption.REPLACE_EXISTING);
+            }
+            return true;
+        } catch (InvalidPathException | IOException | SecurityException ex) {
+            logger.fine(format("Error moving file [%s] to [%s]", oldPath, newPath), ex);
+        }
+        return false;
+    }
+
+    private static boolean fwkDeleteFile(String path) {
+        try {
+            Path file = Paths.get(path);
+            if (Files.isDirectory(file)) {
+                return false;
+            }
+            return Files.deleteIfExists(file);
+        } catch (InvalidPathException | IOException | SecurityException ex) {
+            logger.fine(format("Error deleting file [%s]", path), ex);
+        }
+        return false;
+    }
+
+    private static String[] fwkListDirectory(String path) {
+        try {
+            return new File(path).list();
+        } catch (SecurityException ex) {
+            logger.fine(format("Error listing directory [%s]", path), ex);
+        }
+        return null;
+    }
+
     private static String fwkPathGetFileName(String path) {
         return new File(path).getName();
     }
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+import com.sun.javafx.logging.PlatformLogger;
+import com.sun.javafx.logging.PlatformLogger.Level;
+import java.security.AccessController;
+import java.security.PrivilegedAction;
+import java.util.Collections;
+import java.util.LinkedHashMap;
+import java.util.Locale;
+import java.util.Map;
+
+/**
+ * Tuning profiles for the JavaScript engine. A profile maps onto a
+ * coherent set of JavaScriptCore options: the execution counts at which
+ * functions tier up from the interpreter to the baseline, DFG and FTL
+ * compilers, the growth factors of the garbage collected heap, the number
+ * of parallel GC markers and of concurrent compiler threads, and a cap on
+ * the memory size the heap is sized against.
+ *
+ * All pages of the process share one JavaScript VM, whose options are
+ * fixed once it is created, so the profile is process-wide. It is chosen
+ * with
+ * {@code -Dcom.sun.webkit.jscProfile=default|lowMemory|throughput|lowLatency}
+ * and applied when the first page is created, after the
+ * {@code com.sun.webkit.useJIT} family of properties. The options are
+ * then checked for consistency; inconsistent values, such as those set
+ * through the {@code JSC_} environment variables, are corrected and
+ * reported as warnings.
+ */
+public final class JSEngine {
+
+    private static final PlatformLogger log =
+            PlatformLogger.getLogger(JSEngine.class.getName());
+
+    /**
+     * JavaScript engine tuning profiles.
+     */
+    public enum Profile {
+        /**
+         * The JavaScriptCore defaults.
+         */
+        DEFAULT,
+
+        /**
+         * Minimizes memory use: functions tier up later, so less code is
+         * compiled, the heap grows slowly and is sized against at most
+         * 1 GB of memory, and a single thread compiles and at most two
+         * mark. Suited to many small pages or constrained devices.
+         */
+        LOW_MEMORY,
+
+        /**
+         * Maximizes the speed of long-running scripts: functions tier up
+         * early, the heap grows quickly so that collections are rare, and
+         * more threads compile and mark.
+         */
+        THROUGHPUT,
+
+        /**
+         * Keeps the event thread responsive: functions leave the
+         * interpreter early but reach the FTL tier late, whose
+         * compilations are the longest, and the collector runs
+         * concurrently with more headroom and more timer driven
+         * collections, so that allocations rarely have to wait for it.
+         */
+        LOW_LATENCY
+    }
+
+    private static Profile profile = Profile.DEFAULT;
+
+    /**
+     * The private default constructor. Ensures non-instantiability.
+     */
+    private JSEngine() {
+        throw new AssertionError();
+    }
+
+    /**
+     * Selects the profile given by the {@code com.sun.webkit.jscProfile}
+     * system property, if any. Called before the first page is created.
+     */
+    static void install() {
+        @SuppressWarnings("removal")
+        String value = AccessController.doPrivileged(
+                (PrivilegedAction<String>) () -> System.getProperty(
+                        "com.sun.webkit.jscProfile"));
+        if (value != null) {
+            String name = value.replaceAll("([a-z])([A-Z])", "$1_$2")
+                    .toUpperCase(Locale.ROOT);
+            try {
+                profile = Profile.valueOf(name);
+            } catch (IllegalArgumentException ex) {
+                log.warning("Ignoring invalid JavaScript engine profile: " + value);
+            }
+        }
+        twkSetProfile(profile.ordinal());
+    }
+
+    /**
+     * Reports the corrections made when the profile was applied. Called
+     * when the first page has been created.
+     */
+    static void checkOptions() {
+        for (String warning : twkGetWarnings()) {
+            log.warning(warning);
+        }
+        if (log.isLoggable(Level.FINE)) {
+            log.fine("JavaScript engine profile {0}: {1}", profile,
+                    getEffectiveOptions());
+        }
+    }
+
+    /**
+     * Returns the profile of the JavaScript engine.
+     * @return the profile
+     */
+    public static Profile getProfile() {
+        return profile;
+    }
+
+    /**
+     * Returns the effective values of the JavaScriptCore options the
+     * profiles tune, including the JIT tiers in use, after any
+     * corrections.
+     * @return an unmodifiable map from option names to values, in a
+     *         fixed order, which is empty until the first page has been
+     *         created
+     */
+    public static Map<String, String> getEffectiveOptions() {
+        String[] options = twkGetEffectiveOptions();
+        if (options == null) {
+            return Collections.emptyMap();
+        }
+        Map<String, String> map = new LinkedHashMap<>();
+        for (String option : options) {
+            int separator = option.indexOf('=');
+            map.put(option.substring(0, separator), option.substring(separator + 1));
+        }
+        return Collections.unmodifiableMap(map);
+    }
+
+    native private static void twkSetProfile(int profile);
+    native private static String[] twkGetWarnings();
+    native private static String[] twkGetEffectiveOptions();
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+/**
+ * A collection of static methods for profiling the JavaScript engine shared
+ * by all pages in the process.
+ * <p>
+ * The sampling profiler records the JavaScript stack of the WebKit main
+ * thread at a fixed interval. Samples are aggregated natively by identical
+ * stack, so only the distinct stacks are retained and profiling can be left
+ * running at a low rate. Results are returned as JSON strings.
+ * <p>
+ * All methods must be called on the FX application thread.
+ */
+public final class JSProfiler {
+
+    /**
+     * The default sampling interval, in microseconds. At 10 ms the profiler
+     * thread wakes up 100 times per second.
+     */
+    public static final int DEFAULT_SAMPLING_INTERVAL = 10000;
+
+    /**
+     * The private default constructor. Ensures non-instantiability.
+     */
+    private JSProfiler() {
+        throw new AssertionError();
+    }
+
+    /**
+     * Starts the sampling profiler, or changes the interval if it is
+     * already running.
+     * @param intervalMicros the sampling interval, in microseconds.
+     * @throws IllegalArgumentException if {@code intervalMicros} is not positive.
+     */
+    public static void startSampling(int intervalMicros) {
+        Invoker.getInvoker().checkEventThread();
+        if (intervalMicros <= 0) {
+            throw new IllegalArgumentException(
+                    "intervalMicros is not positive:" + intervalMicros);
+        }
+        twkStartSampling(intervalMicros);
+    }
+
+    /**
+     * Stops the sampling profiler. Samples collected so far are kept until
+     * the next call to {@link #takeSamples()}.
+     */
+    public static void stopSampling() {
+        Invoker.getInvoker().checkEventThread();
+        twkStopSampling();
+    }
+
+    /**
+     * Returns the samples aggregated since the previous call and resets the
+     * aggregation. The result is a JSON object of the form
+     * <pre>
+     * { "sampling": true, "intervalMicros": 10000, "durationMillis": 5012,
+     *   "sampleCount": 480,
+     *   "stacks": [ { "count": 120, "frames": [ "draw (app.js:10:5)", ... ] }, ... ] }
+     * </pre>
+     * where {@code stacks} is sorted by descending count and each
+     * {@code frames} array lists the innermost frame first.
+     * @return the aggregated samples, as JSON.
+     */
+    public static String takeSamples() {
+        Invoker.getInvoker().checkEventThread();
+        return twkTakeSamples();
+    }
+
+    /**
+     * Returns JavaScript heap statistics as a JSON object with the heap
+     * {@code size}, {@code capacity}, {@code extraMemorySize}, object counts,
+     * and a {@code collections} object with count, total, maximum and last
+     * duration of eden and full collections plus the most recent ones.
+     * Collections are tracked from the first use of this class onwards.
+     * @param includeObjectTypeCounts whether to add an
+     *        {@code objectTypeCounts} object. This walks the whole heap, so
+     *        it is considerably more expensive than the rest.
+     * @return the heap statistics, as JSON.
+     */
+    public static String getHeapStatistics(boolean includeObjectTypeCounts) {
+        Invoker.getInvoker().checkEventThread();
+        return twkGetHeapStatistics(includeObjectTypeCounts);
+    }
+
+    native private static void twkStartSampling(int intervalMicros);
+    native private static void twkStopSampling();
+    native private static String twkTakeSamples();
+    native private static String twkGetHeapStatistics(boolean includeObjectTypeCounts);
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+/**
+ * A collection of static methods for finding the most expensive calls the
+ * native WebKit code makes into Java.
+ * <p>
+ * While enabled, every native call site that calls into Java and then
+ * checks for a pending exception is counted, together with the time since
+ * the calling thread last obtained its JNI environment or made such a call.
+ * Results are aggregated per source location for all pages in the process
+ * and returned as JSON strings.
+ * <p>
+ * The methods may be called on any thread.
+ */
+public final class JavaCallProfiler {
+
+    /**
+     * The private default constructor. Ensures non-instantiability.
+     */
+    private JavaCallProfiler() {
+        throw new AssertionError();
+    }
+
+    /**
+     * Starts or stops collecting statistics. Statistics collected so far are
+     * kept until {@link #reset()} is called.
+     * @param enabled whether to collect statistics.
+     */
+    public static void setEnabled(boolean enabled) {
+        twkSetEnabled(enabled);
+    }
+
+    /**
+     * Discards all statistics collected so far.
+     */
+    public static void reset() {
+        twkReset();
+    }
+
+    /**
+     * Returns the statistics collected so far as a JSON object of the form
+     * <pre>
+     * { "enabled": true, "durationMillis": 5012, "callCount": 182345,
+     *   "sites": [ { "site": "GraphicsContextJava.cpp:412", "count": 9120,
+     *                "totalMillis": 35.2, "maxMillis": 0.8 }, ... ] }
+     * </pre>
+     * where {@code sites} is sorted by descending total time.
+     * @return the call statistics, as JSON.
+     */
+    public static String getStatistics() {
+        return twkGetStatistics();
+    }
+
+    native private static void twkSetEnabled(boolean enabled);
+    native private static void twkReset();
+    native private static String twkGetStatistics();
+}
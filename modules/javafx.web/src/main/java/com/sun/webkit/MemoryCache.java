@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+import com.sun.javafx.logging.PlatformLogger;
+import java.security.AccessController;
+import java.security.PrivilegedAction;
+import java.util.Locale;
+
+/**
+ * A collection of static methods for managing the memory cache, which
+ * holds the decoded images, style sheets, scripts and fonts loaded by all
+ * pages of the process. The capacities are therefore a process-wide budget
+ * shared by every {@code WebView}.
+ *
+ * The cache keeps resources in use by a page ("live") and resources no
+ * page refers to anymore ("dead"). The total capacity bounds both; dead
+ * resources are pruned down to the maximum dead capacity, or to the
+ * minimum dead capacity when the cache is over its total capacity.
+ *
+ * The capacities can be set explicitly, or derived from the physical
+ * memory of the host with one of the {@link CacheModel cache models}. The
+ * initial model can be chosen with
+ * {@code -Dcom.sun.webkit.cacheModel=documentViewer|documentBrowser|primaryWebBrowser};
+ * without it WebKit's default capacities are used.
+ */
+public final class MemoryCache {
+
+    private static final PlatformLogger log =
+            PlatformLogger.getLogger(MemoryCache.class.getName());
+
+    /**
+     * The largest capacity the native cache can represent.
+     */
+    private static final long MAX_CAPACITY = 0xFFFFFFFFL;
+
+    /**
+     * Cache sizing policies, scaled by the physical memory of the host.
+     */
+    public enum CacheModel {
+        /**
+         * Minimizes memory use: no dead resources and no back/forward
+         * cache. Suited to many pages shown side by side that are rarely
+         * navigated.
+         */
+        DOCUMENT_VIEWER,
+
+        /**
+         * A moderate cache for pages that are navigated, with a small
+         * back/forward cache.
+         */
+        DOCUMENT_BROWSER,
+
+        /**
+         * A large cache for an application whose main purpose is browsing.
+         */
+        PRIMARY_WEB_BROWSER
+    }
+
+    private static CacheModel cacheModel;
+
+    /**
+     * The private default constructor. Ensures non-instantiability.
+     */
+    private MemoryCache() {
+        throw new AssertionError();
+    }
+
+    /**
+     * Applies the cache model given by the {@code com.sun.webkit.cacheModel}
+     * system property, if any. Called when the first page is created.
+     */
+    static void install() {
+        @SuppressWarnings("removal")
+        String value = AccessController.doPrivileged(
+                (PrivilegedAction<String>) () -> System.getProperty(
+                        "com.sun.webkit.cacheModel"));
+        if (value == null) {
+            return;
+        }
+        String name = value.replaceAll("([a-z])([A-Z])", "$1_$2")
+                .toUpperCase(Locale.ROOT);
+        try {
+            setCacheModel(CacheModel.valueOf(name));
+        } catch (IllegalArgumentException ex) {
+            log.warning("Ignoring invalid cache model: " + value);
+        }
+    }
+
+    /**
+     * Returns the cache model last applied.
+     * @return the cache model, or {@code null} if none has been applied or
+     *         the capacities have been set explicitly since
+     */
+    public static CacheModel getCacheModel() {
+        return cacheModel;
+    }
+
+    /**
+     * Sizes the memory cache according to a cache model. This also sets
+     * the capacity of the {@link PageCache}.
+     * @param model the cache model
+     * @throws NullPointerException if {@code model} is {@code null}
+     * @throws IllegalStateException if not called on the event thread
+     */
+    public static void setCacheModel(CacheModel model) {
+        if (model == null) {
+            throw new NullPointerException("model is null");
+        }
+        Invoker.getInvoker().checkEventThread();
+        twkSetCacheModel(model.ordinal());
+        cacheModel = model;
+    }
+
+    /**
+     * Sets the capacities of the memory cache. Resources over the new
+     * capacities are pruned.
+     * @param minDeadBytes the maximum size of dead resources when the
+     *        cache is over its total capacity, in bytes
+     * @param maxDeadBytes the maximum size of dead resources otherwise,
+     *        in bytes
+     * @param totalBytes the total capacity, in bytes
+     * @throws IllegalArgumentException unless
+     *         {@code 0 <= minDeadBytes <= maxDeadBytes <= totalBytes <= 2^32 - 1}
+     * @throws IllegalStateException if not called on the event thread
+     */
+    public static void setCapacities(long minDeadBytes, long maxDeadBytes,
+                                     long totalBytes) {
+        if (minDeadBytes < 0 || minDeadBytes > maxDeadBytes
+                || maxDeadBytes > totalBytes || totalBytes > MAX_CAPACITY) {
+            throw new IllegalArgumentException(String.format(
+                    "invalid capacities: minDead=%d, maxDead=%d, total=%d",
+                    minDeadBytes, maxDeadBytes, totalBytes));
+        }
+        Invoker.getInvoker().checkEventThread();
+        twkSetCapacities(minDeadBytes, maxDeadBytes, totalBytes);
+        cacheModel = null;
+    }
+
+    /**
+     * Returns the total capacity of the memory cache.
+     * @return the total capacity, in bytes
+     */
+    public static long getCapacity() {
+        return twkGetCapacity();
+    }
+
+    /**
+     * Returns the maximum size of dead resources when the cache is over its
+     * total capacity.
+     * @return the minimum dead capacity, in bytes
+     */
+    public static long getMinDeadCapacity() {
+        return twkGetMinDeadCapacity();
+    }
+
+    /**
+     * Returns the maximum size of dead resources.
+     * @return the maximum dead capacity, in bytes
+     */
+    public static long getMaxDeadCapacity() {
+        return twkGetMaxDeadCapacity();
+    }
+
+    /**
+     * Returns the size of the resources in use by a page.
+     * @return the live size, in bytes
+     */
+    public static long getLiveSize() {
+        return twkGetLiveSize();
+    }
+
+    /**
+     * Returns the size of the resources no page refers to.
+     * @return the dead size, in bytes
+     */
+    public static long getDeadSize() {
+        return twkGetDeadSize();
+    }
+
+    /**
+     * Removes all dead resources from the memory cache.
+     * @throws IllegalStateException if not called on the event thread
+     */
+    public static void pruneDeadResources() {
+        Invoker.getInvoker().checkEventThread();
+        twkPruneDeadResources();
+    }
+
+    native private static void twkSetCacheModel(int cacheModel);
+    native private static void twkSetCapacities(long minDeadBytes,
+            long maxDeadBytes, long totalBytes);
+    native private static long twkGetCapacity();
+    native private static long twkGetMinDeadCapacity();
+    native private static long twkGetMaxDeadCapacity();
+    native private static long twkGetLiveSize();
+    native private static long twkGetDeadSize();
+    native private static void twkPruneDeadResources();
+}
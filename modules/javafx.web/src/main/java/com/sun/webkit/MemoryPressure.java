@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+import com.sun.javafx.logging.PlatformLogger;
+import java.lang.ref.SoftReference;
+
+/**
+ * Connects Java-side memory pressure signals to the native
+ * {@code MemoryPressureHandler}, which releases the reclaimable WebKit
+ * caches: decoded images, the back/forward cache, compiled JavaScript code
+ * and font data.
+ *
+ * Three sources of pressure are mapped onto the native non-critical and
+ * critical levels:
+ * <ul>
+ * <li>the Java heap, sampled whenever the JVM clears soft references;</li>
+ * <li>on Linux, the memory limit of the cgroup the process runs in,
+ * polled natively;</li>
+ * <li>explicit calls to {@link #releaseMemory(boolean)}.</li>
+ * </ul>
+ *
+ * The automatic signals can be disabled with
+ * {@code -Dcom.sun.webkit.memoryPressure=false}. The fraction of the heap or
+ * cgroup limit in use at which the levels are entered is controlled by
+ * {@code com.sun.webkit.memoryPressure.warningThreshold} (default 0.8) and
+ * {@code com.sun.webkit.memoryPressure.criticalThreshold} (default 0.95);
+ * the cgroup poll interval by
+ * {@code com.sun.webkit.memoryPressure.pollInterval} (milliseconds, default
+ * 1000).
+ */
+public final class MemoryPressure {
+
+    private static final PlatformLogger log =
+            PlatformLogger.getLogger(MemoryPressure.class.getName());
+
+    private static final double warningThreshold =
+            threshold("warningThreshold", 0.8);
+    private static final double criticalThreshold =
+            Math.max(warningThreshold, threshold("criticalThreshold", 0.95));
+
+    private static volatile boolean installed;
+
+    // Only softly reachable, so the JVM clears it when it runs short of heap.
+    private static SoftReference<Object> heapSentinel;
+
+    /**
+     * The private default constructor. Ensures non-instantiability.
+     */
+    private MemoryPressure() {
+        throw new AssertionError();
+    }
+
+    /**
+     * Installs the native memory pressure handler and starts listening for
+     * heap and cgroup pressure. Called when the first page is created.
+     */
+    static void install() {
+        Invoker.getInvoker().checkEventThread();
+        if (installed) {
+            return;
+        }
+        installed = true;
+        twkInstall();
+
+        if (!Boolean.valueOf(System.getProperty(
+                "com.sun.webkit.memoryPressure", "true"))) {
+            return;
+        }
+
+        armHeapSentinel();
+
+        long pollInterval = Math.max(100, Long.getLong(
+                "com.sun.webkit.memoryPressure.pollInterval", 1000));
+        if (twkStartCgroupWatcher(pollInterval, warningThreshold,
+                                  criticalThreshold)) {
+            log.fine("Watching cgroup memory limit of {0} bytes",
+                    twkGetCgroupMemoryLimit());
+        }
+    }
+
+    /**
+     * Stops the native cgroup watcher. Safe to call from any thread.
+     */
+    static void shutdown() {
+        if (installed) {
+            twkStopCgroupWatcher();
+        }
+    }
+
+    /**
+     * Releases WebKit memory as if the system had signalled memory pressure.
+     * A non-critical release drops caches that are cheap to rebuild; a
+     * critical release also empties the back/forward and memory caches,
+     * discards compiled code and runs a full JavaScript garbage collection.
+     * The release is synchronous.
+     * @param critical whether to perform a critical release
+     */
+    public static void releaseMemory(boolean critical) {
+        Invoker.getInvoker().checkEventThread();
+        twkReleaseMemory(critical);
+    }
+
+    /**
+     * Returns the resident memory of the process, in bytes. On platforms
+     * where it is not available, the private dirty memory is returned.
+     * @return the resident memory of the process, in bytes
+     */
+    public static long getResidentMemory() {
+        return twkGetResidentMemory();
+    }
+
+    /**
+     * Returns the size of the JavaScript heap shared by all pages, including
+     * the memory held by array buffers, in bytes.
+     * @return the size of the JavaScript heap, in bytes
+     */
+    public static long getJavaScriptHeapSize() {
+        Invoker.getInvoker().checkEventThread();
+        return twkGetJavaScriptHeapSize();
+    }
+
+    /**
+     * Returns the memory limit of the cgroup the process runs in.
+     * @return the limit in bytes, or {@code -1} if there is no limit or
+     *         cgroups are not supported on this platform
+     */
+    public static long getCgroupMemoryLimit() {
+        return twkGetCgroupMemoryLimit();
+    }
+
+    private static void armHeapSentinel() {
+        Object sentinel = new Object();
+        heapSentinel = new SoftReference<>(sentinel);
+        Disposer.addRecord(sentinel, MemoryPressure::heapSentinelCleared);
+    }
+
+    private static void heapSentinelCleared() {
+        // Soft references also age out without any pressure, so look at the
+        // heap before deciding whether this is a signal at all.
+        Runtime runtime = Runtime.getRuntime();
+        double used = (double) (runtime.totalMemory() - runtime.freeMemory())
+                / runtime.maxMemory();
+        if (used >= warningThreshold) {
+            boolean critical = used >= criticalThreshold;
+            log.fine("Java heap {0}% full, releasing memory (critical: {1})",
+                    Math.round(used * 100), critical);
+            twkReleaseMemory(critical);
+        }
+        armHeapSentinel();
+    }
+
+    private static double threshold(String name, double defaultValue) {
+        String value = System.getProperty(
+                "com.sun.webkit.memoryPressure." + name);
+        if (value != null) {
+            try {
+                double d = Double.parseDouble(value);
+                if (d > 0 && d <= 1) {
+                    return d;
+                }
+            } catch (NumberFormatException ex) {
+                // Fall through
+            }
+            log.warning("Ignoring invalid memory pressure " + name + ": "
+                    + value);
+        }
+        return defaultValue;
+    }
+
+    native private static void twkInstall();
+    native private static void twkReleaseMemory(boolean critical);
+    native private static long twkGetResidentMemory();
+    native private static long twkGetJavaScriptHeapSize();
+    native private static boolean twkStartCgroupWatcher(long pollIntervalMillis,
+            double warningFraction, double criticalFraction);
+    native private static void twkStopCgroupWatcher();
+    native private static long twkGetCgroupMemoryLimit();
+}
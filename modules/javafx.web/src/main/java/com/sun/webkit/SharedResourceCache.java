@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+import com.sun.javafx.logging.PlatformLogger;
+
+/**
+ * A collection of static methods for managing the shared resource cache,
+ * which lets all pages of the process share the parsed form of identical
+ * stylesheets and the source of identical scripts, even when the memory
+ * cache loads them again. Entries are keyed by URL and content hash; those
+ * over the capacity are evicted, least recently used first.
+ *
+ * The capacity may be given with
+ * {@code -Dcom.sun.webkit.sharedResourceCacheSize=<bytes>}; 0 disables the
+ * cache.
+ */
+public final class SharedResourceCache {
+
+    private static final PlatformLogger log =
+            PlatformLogger.getLogger(SharedResourceCache.class.getName());
+
+    /**
+     * The capacity used when none is given.
+     */
+    public static final long DEFAULT_CAPACITY = 32L * 1024 * 1024;
+
+    /**
+     * The private default constructor. Ensures non-instantiability.
+     */
+    private SharedResourceCache() {
+        throw new AssertionError();
+    }
+
+    /**
+     * Applies the capacity given by the
+     * {@code com.sun.webkit.sharedResourceCacheSize} system property, if
+     * any. Called when the first page is created.
+     */
+    static void install() {
+        String sizeValue = System.getProperty("com.sun.webkit.sharedResourceCacheSize");
+        if (sizeValue == null) {
+            return;
+        }
+        try {
+            setCapacity(Long.parseLong(sizeValue));
+        } catch (IllegalArgumentException ex) {
+            log.warning("Ignoring invalid shared resource cache size: " + sizeValue);
+        }
+    }
+
+    /**
+     * Returns the capacity of the shared resource cache.
+     * @return the capacity, in bytes
+     */
+    public static long getCapacity() {
+        return twkGetCapacity();
+    }
+
+    /**
+     * Sets the capacity of the shared resource cache, evicting entries as
+     * needed.
+     * @param capacity the capacity, in bytes, or 0 to disable the cache
+     * @throws IllegalArgumentException if {@code capacity} is negative
+     * @throws IllegalStateException if not called on the event thread
+     */
+    public static void setCapacity(long capacity) {
+        if (capacity < 0) {
+            throw new IllegalArgumentException(
+                    "capacity is negative: " + capacity);
+        }
+        Invoker.getInvoker().checkEventThread();
+        twkSetCapacity(capacity);
+    }
+
+    /**
+     * Removes all entries from the shared resource cache. Pages keep the
+     * stylesheets and scripts they already use.
+     * @throws IllegalStateException if not called on the event thread
+     */
+    public static void clear() {
+        Invoker.getInvoker().checkEventThread();
+        twkClear();
+    }
+
+    /**
+     * Returns the estimated size of the parsed stylesheets in the cache.
+     * @return the size, in bytes
+     */
+    public static long getStyleSheetSize() {
+        return twkGetStyleSheetSize();
+    }
+
+    /**
+     * Returns the size of the script sources in the cache.
+     * @return the size, in bytes
+     */
+    public static long getScriptSize() {
+        return twkGetScriptSize();
+    }
+
+    /**
+     * Returns the number of stylesheets and scripts taken from the cache
+     * instead of a copy of their own.
+     * @return the hit count
+     */
+    public static long getHitCount() {
+        return twkGetHitCount();
+    }
+
+    /**
+     * Returns the number of stylesheets and scripts the cache had no entry
+     * for.
+     * @return the miss count
+     */
+    public static long getMissCount() {
+        return twkGetMissCount();
+    }
+
+    native private static long twkGetCapacity();
+    native private static void twkSetCapacity(long capacity);
+    native private static void twkClear();
+    native private static long twkGetStyleSheetSize();
+    native private static long twkGetScriptSize();
+    native private static long twkGetHitCount();
+    native private static long twkGetMissCount();
+}
@@ -31,6 +31,7 @@ import javafx.scene.paint.Color;
 import com.sun.glass.utils.NativeLibLoader;
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
+import com.sun.javafx.tk.TKPulseListener;
 import com.sun.javafx.tk.Toolkit;
 import com.sun.webkit.event.WCFocusEvent;
 import com.sun.webkit.event.WCInputMethodEvent;
@@ -133,6 +134,21 @@ public final class WebPage {
     // An ID of the current updateContent cycle associated with an updateContent call.
     private int updateContentCycleID;
 
+    // The pulse period in nanoseconds, or zero if idle-time collection is
+    // disabled. Off by default.
+    private static final long idleGCPulseNanos = initIdleGCPulse();
+
+    // Below this there is no point in asking the collector.
+    private static final long MIN_IDLE_GC_BUDGET_NANOS = 1_000_000L;
+
+    // The start of the pulse that last updated a page, or zero once the
+    // collector has been offered the rest of that pulse.
+    // Accessed on: Event thread only.
+    private static long idleGCPulseStart;
+
+    // Referenced here because the toolkit holds its pulse listeners weakly.
+    private static TKPulseListener idleGCPulseListener;
+
     static {
         @SuppressWarnings("removal")
         var dummy = AccessController.doPrivileged((PrivilegedAction<Void>) () -> {
@@ -152,6 +168,8 @@ public final class WebPage {
                     "com.sun.webkit.useJIT", "true"));
             final boolean useDFGJIT = Boolean.valueOf(System.getProperty(
                     "com.sun.webkit.useDFGJIT", "true"));
+            final boolean useFTLJIT = Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.useFTLJIT", "true"));
 
             // TODO: Enable CSS3D by default once it is stabilized.
             boolean useCSS3D = Boolean.valueOf(System.getProperty(
@@ -159,7 +177,8 @@ public final class WebPage {
             useCSS3D = useCSS3D && Platform.isSupported(ConditionalFeature.SCENE3D);
 
             // Initialize WTF, WebCore and JavaScriptCore.
-            twkInitWebCore(useJIT, useDFGJIT, useCSS3D);
+            twkInitWebCore(useJIT, useDFGJIT, useFTLJIT, useCSS3D, idleGCPulseNanos > 0);
+            JSEngine.install();
 
             // Inform the native webkit code when either the JVM or the
             // JavaFX runtime is being shutdown
@@ -167,6 +186,7 @@ public final class WebPage {
                 synchronized(WebPage.class) {
                     MainThread.twkSetShutdown(true);
                 }
+                MemoryPressure.shutdown();
             };
 
             // Register shutdown hook with the Java runtime and the Toolkit
@@ -178,6 +198,13 @@ public final class WebPage {
 
     }
 
+    // Replays recorded drawing commands for areas that were not invalidated.
+    @SuppressWarnings("removal")
+    private static final boolean useDisplayListCache =
+            AccessController.doPrivileged((PrivilegedAction<Boolean>) () ->
+                    Boolean.valueOf(System.getProperty(
+                            "com.sun.webkit.useDisplayListCache", "false")));
+
     private static boolean firstWebPageCreated = false;
 
     private static void collectJSCGarbages() {
@@ -218,16 +245,25 @@ public final class WebPage {
         pPage = twkCreatePage(editable);
 
         twkInit(pPage, false, WCGraphicsManager.getGraphicsManager().getDevicePixelScale());
+        if (useDisplayListCache) {
+            twkSetDisplayListCacheEnabled(pPage, true);
+        }
 
         if (pageClient != null && pageClient.isBackBufferSupported()) {
             backbuffer = pageClient.createBackBuffer();
             backbuffer.ref();
+            twkSetHasBackBuffer(pPage, true);
         }
 
         if (!firstWebPageCreated) {
             // Add dummy object to get notification as soon as it is collected
             // by the JVM GC.
             Disposer.addRecord(new Object(), WebPage::collectJSCGarbages);
+            MemoryPressure.install();
+            MemoryCache.install();
+            DiskCache.install();
+            SharedResourceCache.install();
+            JSEngine.checkOptions();
             firstWebPageCreated = true;
         }
     }
@@ -265,6 +301,12 @@ public final class WebPage {
 
     private WCPageBackBuffer backbuffer;
     private List<WCRectangle> dirtyRects = new LinkedList<WCRectangle>();
+    // Composited layers changed or animate; the damaged area is known
+    // only to the native side, which tracks it per layer.
+    private boolean layerUpdatePending;
+    // WebCore invalidated parts of the page; the native side keeps the
+    // exact region, see twkTakeDamage().
+    private boolean damagePending;
 
     private void addDirtyRect(WCRectangle toPaint) {
         if (toPaint.getWidth() <= 0 || toPaint.getHeight() <= 0) {
@@ -298,7 +340,7 @@ public final class WebPage {
     public boolean isDirty() {
         lockPage();
         try {
-            return !dirtyRects.isEmpty();
+            return !dirtyRects.isEmpty() || layerUpdatePending || damagePending;
         } finally {
             unlockPage();
         }
@@ -315,6 +357,14 @@ public final class WebPage {
             // Clear the list so that the platform doesn't consider
             // the page dirty.
             dirtyRects.clear();
+            layerUpdatePending = false;
+            if (damagePending && !isDisposed) {
+                // Drop the native damage too. It only requests a repaint
+                // when it becomes non-empty, so damage left behind would
+                // swallow every later invalidation.
+                twkTakeDamage(getPage(), 0, 0, width, height);
+            }
+            damagePending = false;
             return;
         }
         if (clip == null) {
@@ -322,6 +372,7 @@ public final class WebPage {
         }
         List<WCRectangle> oldDirtyRects = dirtyRects;
         dirtyRects = new LinkedList<WCRectangle>();
+        layerUpdatePending = false;
         twkPrePaint(getPage());
         while (!oldDirtyRects.isEmpty()) {
             WCRectangle r = oldDirtyRects.remove(0).intersection(clip);
@@ -335,6 +386,10 @@ public final class WebPage {
                              r.getIntWidth() + 2, r.getIntHeight() + 2);
             currentFrame.addRenderQueue(rq);
         }
+        if (damagePending) {
+            damagePending = false;
+            updateDamage(clip);
+        }
         {
             WCRenderQueue rq = WCGraphicsManager.getGraphicsManager()
                     .createRenderQueue(clip, false);
@@ -389,6 +444,40 @@ public final class WebPage {
         }
     }
 
+    /*
+     * Paints the region invalidated by WebCore into a single render queue.
+     * The queue only covers its bounds completely, and can therefore drop
+     * older frames, if the region is a single rectangle.
+     */
+    private void updateDamage(WCRectangle clip) {
+        int[] rects = twkTakeDamage(getPage(), clip.getIntX(), clip.getIntY(),
+                                    clip.getIntWidth(), clip.getIntHeight());
+        if (rects == null || rects.length == 0) {
+            return;
+        }
+        WCRectangle bounds = new WCRectangle(rects[0], rects[1], rects[2], rects[3]);
+        for (int i = 4; i < rects.length; i += 4) {
+            bounds = bounds.createUnion(
+                    new WCRectangle(rects[i], rects[i + 1], rects[i + 2], rects[i + 3]));
+        }
+        paintLog.finest("Updating damage: {0} in {1} rect(s)", new Object[] {bounds, rects.length / 4});
+        WCRenderQueue rq = WCGraphicsManager.getGraphicsManager()
+                .createRenderQueue(bounds, rects.length == 4);
+        twkPaintRects(getPage(), rq, rects);
+        currentFrame.addRenderQueue(rq);
+    }
+
+    /*
+     * Creates the render queue a tile of the page is recorded into; it is
+     * replayed by later updates until the tile is invalidated.
+     */
+    private WCRenderQueue fwkCreateDisplayList(int x, int y, int w, int h) {
+        WCRenderQueue rq = WCGraphicsManager.getGraphicsManager()
+                .createRenderQueue(new WCRectangle(x, y, w, h), true);
+        rq.setRetained();
+        return rq;
+    }
+
     private void scroll(int x, int y, int w, int h, int dx, int dy) {
         if (!isBackgroundColorOpaque()) {
             if (paintLog.isLoggable(Level.FINEST)) {
@@ -661,6 +750,14 @@ public final class WebPage {
      * Executed on the Event Thread.
      */
     public void updateContent(WCRectangle toPaint) {
+        // Pages are updated by the stage pulse, the first part of a pulse.
+        if (idleGCPulseNanos > 0 && idleGCPulseStart == 0) {
+            idleGCPulseStart = System.nanoTime();
+            if (idleGCPulseListener == null) {
+                idleGCPulseListener = WebPage::collectDuringIdleTime;
+                Toolkit.getToolkit().addPostSceneTkPulseListener(idleGCPulseListener);
+            }
+        }
         lockPage();
         try {
             ++updateContentCycleID;
@@ -677,6 +774,36 @@ public final class WebPage {
         }
     }
 
+    private static long initIdleGCPulse() {
+        @SuppressWarnings("removal")
+        long period = AccessController.doPrivileged((PrivilegedAction<Long>) () -> {
+            final boolean useIdleTimeGC = Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.useIdleTimeGC", "false"));
+            final int pulse = Integer.getInteger("javafx.animation.pulse", 60);
+            return useIdleTimeGC && pulse > 0 ? 1_000_000_000L / pulse : 0L;
+        });
+        return period;
+    }
+
+    /*
+     * Runs after the scene graph of a pulse that updated a page has been
+     * synchronized, while the render thread paints it. Lets the JavaScript
+     * collector run an eden (or, if due, full) collection in the time left
+     * until the next pulse, instead of on its own timers in the middle of a
+     * later frame. The collector declines if no collection is due soon or
+     * if its last one would not fit.
+     */
+    private static void collectDuringIdleTime() {
+        if (idleGCPulseStart == 0) {
+            return;
+        }
+        long remaining = idleGCPulseStart + idleGCPulseNanos - System.nanoTime();
+        idleGCPulseStart = 0;
+        if (remaining >= MIN_IDLE_GC_BUDGET_NANOS) {
+            twkCollectDuringIdleTime(remaining);
+        }
+    }
+
     public void updateRendering() {
         twkUpdateRendering(getPage());
     }
@@ -1122,6 +1249,59 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Returns paint statistics as a JSON object with the number of frames
+     * that painted anything, their total damaged area in pixels, total and
+     * maximum paint time, total style and layout time, render queue bytes
+     * and calls into Java, and a {@code recentFrames} array with the
+     * {@code rectCount}, {@code area}, {@code paintMillis},
+     * {@code layoutMillis}, {@code queueBytes} and {@code javaCalls} of each
+     * of the most recent frames. Only repaints driven by page updates are
+     * counted, and calls into Java only while {@link JavaCallProfiler} is
+     * enabled. With the display list cache enabled, {@code tilesRecorded}
+     * and {@code tilesReused} count the tiles painted from a new recording
+     * and from a cached one.
+     */
+    public String getPaintStatistics() {
+        lockPage();
+        try {
+            if (isDisposed) {
+                log.fine("getPaintStatistics() request for a disposed web page.");
+                return null;
+            }
+            return twkGetPaintStatistics(getPage());
+        } finally {
+            unlockPage();
+        }
+    }
+
+    public void resetPaintStatistics() {
+        lockPage();
+        try {
+            if (!isDisposed) {
+                twkResetPaintStatistics(getPage());
+            }
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Enables or disables replaying recorded tiles for areas that were not
+     * invalidated. Defaults to the {@code com.sun.webkit.useDisplayListCache}
+     * system property; disabling drops the recorded tiles.
+     */
+    public void setDisplayListCacheEnabled(boolean enabled) {
+        lockPage();
+        try {
+            if (!isDisposed) {
+                twkSetDisplayListCacheEnabled(getPage(), enabled);
+            }
+        } finally {
+            unlockPage();
+        }
+    }
+
     public String getEncoding() {
         lockPage();
         try {
@@ -1933,6 +2113,57 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Renders a rectangle of the page, in document coordinates, into an
+     * image of its own. Unlike {@link #paint}, this needs no page client,
+     * back buffer or pending render frames, so it suits pages that are
+     * never shown, and parts of the page outside the view. Composited
+     * layers are flattened into the image. The page is painted on the
+     * event thread, and reading the pixels back waits for the render
+     * thread, which flushes the image's render queue. This method may
+     * therefore be called on any thread except the render thread, and
+     * waits for the result. Callers on several threads only overlap the
+     * work they do with the pixels; painting stays serialized.
+     * @param x the left edge of the rectangle
+     * @param y the top edge of the rectangle
+     * @param width the width of the rectangle
+     * @param height the height of the rectangle
+     * @return the pixels, row by row, as non-premultiplied ARGB values,
+     *         or {@code null} if the page is disposed or has no document
+     * @throws IllegalArgumentException if the size is not positive or
+     *         too large
+     */
+    public int[] snapshot(int x, int y, int width, int height) {
+        if (width <= 0 || height <= 0 || width > Integer.MAX_VALUE / height) {
+            throw new IllegalArgumentException(
+                    "invalid size: " + width + "x" + height);
+        }
+        // The page lock is taken on the event thread, so that threads
+        // waiting for their snapshots do not hold it.
+        AtomicReference<int[]> retVal = new AtomicReference<>();
+        final CountDownLatch l = new CountDownLatch(1);
+        Invoker.getInvoker().invokeOnEventThread(() -> {
+            lockPage();
+            try {
+                if (isDisposed) {
+                    log.warning("snapshot() called for a disposed web page.");
+                    return;
+                }
+                retVal.set(twkSnapshot(getPage(), x, y, width, height));
+            } finally {
+                unlockPage();
+                l.countDown();
+            }
+        });
+
+        try {
+            l.await();
+        } catch (InterruptedException e) {
+            throw new RuntimeException(e);
+        }
+        return retVal.get();
+    }
+
     public int getPageHeight() {
         return getFrameHeight(getMainFrame());
     }
@@ -2107,6 +2338,22 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Returns the LocalStorage statistics of the origin of the given URL as
+     * a JSON object: the duration ({@code importMillis}) and item count
+     * ({@code importedItemCount}) of the last import from the database, the
+     * number of syncs to the database and the items they wrote
+     * ({@code syncCount}, {@code syncedItemCount}), the last, maximum and
+     * total sync durations, and the current sync interval
+     * ({@code syncIntervalMillis}), which grows while the origin keeps
+     * writing many items. Returns {@code null} if the origin has not used
+     * a LocalStorage database in this process.
+     */
+    public static String getLocalStorageStatistics(String url) {
+        Invoker.getInvoker().checkEventThread();
+        return twkGetLocalStorageStatistics(url);
+    }
+
     // ---- INSPECTOR SUPPORT ---- //
 
     public void connectInspectorFrontend() {
@@ -2164,14 +2411,20 @@ public final class WebPage {
         frames.remove(frameID);
     }
 
-    private void fwkRepaint(int x, int y, int w, int h) {
+    private void fwkRepaint() {
         lockPage();
         try {
-            if (paintLog.isLoggable(Level.FINEST)) {
-                paintLog.finest("x: {0}, y: {1}, w: {2}, h: {3}",
-                        new Object[] {x, y, w, h});
-            }
-            addDirtyRect(new WCRectangle(x, y, w, h));
+            paintLog.finest("Damage pending");
+            damagePending = true;
+        } finally {
+            unlockPage();
+        }
+    }
+
+    private void fwkRequestLayerUpdate() {
+        lockPage();
+        try {
+            layerUpdatePending = true;
         } finally {
             unlockPage();
         }
@@ -2550,6 +2803,17 @@ public final class WebPage {
 
     private static native int twkWorkerThreadCount();
 
+    /**
+     * Returns whether complex text is shaped natively with HarfBuzz rather
+     * than by the Java text layout, which depends on the
+     * {@code USE_HARFBUZZ_SHAPING} build option.
+     */
+    public static boolean isHarfBuzzShapingEnabled() {
+        return twkIsHarfBuzzShapingEnabled();
+    }
+
+    private static native boolean twkIsHarfBuzzShapingEnabled();
+
     private void fwkDidClearWindowObject(long pContext, long pWindowObject) {
         if (pageClient != null) {
             pageClient.didClearWindowObject(pContext, pWindowObject);
@@ -2621,7 +2885,7 @@ public final class WebPage {
     // Native methods
     // *************************************************************************
 
-    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useCSS3D);
+    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useFTLJIT, boolean useCSS3D, boolean useIdleTimeGC);
     private native long twkCreatePage(boolean editable);
     private native void twkInit(long pPage, boolean usePlugins, float devicePixelScale);
     private native void twkDestroyPage(long pPage);
@@ -2670,6 +2934,7 @@ public final class WebPage {
     private native int twkBeginPrinting(long pPage, float width, float height);
     private native void twkEndPrinting(long pPage);
     private native void twkPrint(long pPage, WCRenderQueue gc, int pageNumber, float width);
+    private native int[] twkSnapshot(long pPage, int x, int y, int width, int height);
     private native float twkAdjustFrameHeight(long pFrame, float oldTop, float oldBottom, float bottomLimit);
 
     private native int[] twkGetVisibleRect(long pFrame);
@@ -2681,10 +2946,16 @@ public final class WebPage {
     private native void twkSetBounds(long pPage, int x, int y, int w, int h);
     private native void twkPrePaint(long pPage);
     private native void twkUpdateContent(long pPage, WCRenderQueue rq, int x, int y, int w, int h);
+    private native int[] twkTakeDamage(long pPage, int x, int y, int w, int h);
+    private native void twkPaintRects(long pPage, WCRenderQueue rq, int[] rects);
     private native void twkUpdateRendering(long pPage);
     private native void twkPostPaint(long pPage, WCRenderQueue rq,
                                      int x, int y, int w, int h);
 
+    private native String twkGetPaintStatistics(long pPage);
+    private native void twkResetPaintStatistics(long pPage);
+    private native void twkSetDisplayListCacheEnabled(long pPage, boolean enabled);
+    private native void twkSetHasBackBuffer(long pPage, boolean hasBackBuffer);
     private native String twkGetEncoding(long pPage);
     private native void twkSetEncoding(long pPage, String encoding);
 
@@ -2751,4 +3022,6 @@ public final class WebPage {
     private native void twkDispatchInspectorMessageFromFrontend(long pPage,
                                                                 String message);
     private static native void twkDoJSCGarbageCollection();
+    private static native String twkGetLocalStorageStatistics(String url);
+    private static native boolean twkCollectDuringIdleTime(long budgetNanos);
 }
@@ -86,6 +86,7 @@ public final class GraphicsDecoder  {
     @Native public final static int SET_MITER_LIMIT        = 54;
     @Native public final static int SET_TEXT_MODE          = 55;
     @Native public final static int SET_PERSPECTIVE_TRANSFORM = 56;
+    @Native public final static int REPLAYRQ               = 57;
 
     private final static PlatformLogger log =
             PlatformLogger.getLogger(GraphicsDecoder.class.getName());
@@ -353,6 +354,12 @@ public final class GraphicsDecoder  {
                     WCRenderQueue _rq = (WCRenderQueue)gm.getRef(buf.getInt());
                     _rq.decode(gc.getFontSmoothingType());
                     break;
+                case REPLAYRQ:
+                    WCRenderQueue retained = (WCRenderQueue)gm.getRef(buf.getInt());
+                    gc.saveState();
+                    retained.replay(gc);
+                    gc.restoreState();
+                    break;
                 case ROTATE:
                     gc.rotate(buf.getFloat());
                     break;
@@ -25,6 +25,8 @@
 
 package com.sun.webkit.graphics;
 
+import java.nio.ByteBuffer;
+
 public abstract class WCFont extends Ref {
 
     public abstract Object getPlatformFont();
@@ -33,7 +35,11 @@ public abstract class WCFont extends Ref {
 
     public abstract WCTextRun[] getTextRuns(String str);
 
-    public abstract int[] getGlyphCodes(char[] chars);
+    /**
+     * Maps the first {@code length} chars of {@code chars} to glyph codes.
+     * NB: This method is called from native code!
+     */
+    public abstract void getGlyphCodes(char[] chars, int length, int[] glyphs);
 
     public abstract float getXHeight();
 
@@ -41,6 +47,28 @@ public abstract class WCFont extends Ref {
 
     public abstract float[] getGlyphBoundingBox(int glyph);
 
+    /**
+     * Writes the advances of {@code count} consecutive glyphs starting at
+     * {@code firstGlyph} to {@code advances} as native order floats.
+     * NB: This method is called from native code!
+     */
+    public abstract void getGlyphAdvances(int firstGlyph, int count, ByteBuffer advances);
+
+    /**
+     * Writes the bounding boxes of {@code count} consecutive glyphs starting
+     * at {@code firstGlyph} to {@code boxes} as native order floats, four per
+     * glyph in the layout returned by {@link #getGlyphBoundingBox}.
+     * NB: This method is called from native code!
+     */
+    public abstract void getGlyphBoundingBoxes(int firstGlyph, int count, ByteBuffer boxes);
+
+    /**
+     * Returns the bytes of the OpenType table {@code tag} of the font that
+     * glyph codes refer to, or {@code null} if the font has no such table.
+     * NB: This method is called from native code!
+     */
+    public abstract byte[] getFontTable(int tag);
+
     /**
      * Returns a hash code value for the object.
      * NB: This method is called from native code!
@@ -90,6 +90,14 @@ public abstract class WCGraphicsManager {
 
     protected abstract WCPath createWCPath(WCPath path);
 
+    /**
+     * Creates a path from the packed native path buffers. Segment types
+     * are the {@code WCPathIterator.SEG_*} constants; the arrays are owned
+     * by the returned path.
+     */
+    protected abstract WCPath createWCPath(byte[] types, int numTypes,
+                                           float[] coords, int numCoords);
+
     protected abstract WCImage createWCImage(int w, int h);
 
     protected abstract WCImage createRTImage(int w, int h);
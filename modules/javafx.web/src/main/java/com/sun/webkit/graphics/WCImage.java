@@ -52,7 +52,7 @@ public abstract class WCImage extends Ref {
 
     public ByteBuffer getPixelBuffer() {return null;}
 
-    protected void drawPixelBuffer() {}
+    protected void drawPixelBuffer(int x, int y, int width, int height) {}
 
     public synchronized void setRQ(WCRenderQueue rq) {
         this.rq = rq;
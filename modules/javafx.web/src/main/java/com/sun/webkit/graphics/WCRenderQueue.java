@@ -45,6 +45,7 @@ public abstract class WCRenderQueue extends Ref {
     private final WCRectangle clip;
     private int size = 0;
     private final boolean opaque;
+    private volatile boolean retained = false;
 
     // Associated graphics context (currently used to draw to a buffered image).
     protected final WCGraphicsContext gc;
@@ -103,6 +104,35 @@ public abstract class WCRenderQueue extends Ref {
         dispose();
     }
 
+    /*
+     * Decodes a retained queue without disposing of its buffers, so that
+     * it can be decoded again. See setRetained().
+     */
+    public synchronized void replay(WCGraphicsContext gc) {
+        if (gc == null || !gc.isValid()) {
+            log.fine("WCRenderQueue::replay : GC is " + (gc == null ? "null" : " invalid"));
+            return;
+        }
+
+        for (BufferData bdata : buffers) {
+            bdata.getBuffer().rewind();
+            try {
+                GraphicsDecoder.decode(
+                    WCGraphicsManager.getGraphicsManager(), gc, bdata);
+            } catch (RuntimeException e) {
+                e.printStackTrace(System.err);
+            }
+        }
+    }
+
+    /*
+     * Marks the queue as a recording that other queues replay. Its buffers
+     * are only released when the native side disposes of the queue.
+     */
+    public void setRetained() {
+        retained = true;
+    }
+
     public synchronized void decode() {
         if (gc == null || !gc.isValid()) {
             log.fine("WCRenderQueue::decode : GC is " + (gc == null ? "null" : " invalid"));
@@ -158,6 +188,9 @@ public abstract class WCRenderQueue extends Ref {
     protected abstract void disposeGraphics();
 
     private void fwkDisposeGraphics() {
+        if (retained) {
+            dispose();
+        }
         disposeGraphics();
     }
 
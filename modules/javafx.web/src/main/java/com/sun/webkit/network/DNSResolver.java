@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.network;
+
+import com.sun.javafx.logging.PlatformLogger;
+import com.sun.javafx.logging.PlatformLogger.Level;
+import com.sun.webkit.Invoker;
+import java.net.InetAddress;
+import java.net.Proxy;
+import java.net.ProxySelector;
+import java.net.URI;
+import java.net.UnknownHostException;
+import java.security.AccessController;
+import java.security.PrivilegedAction;
+import java.security.Security;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.LinkedBlockingQueue;
+import java.util.concurrent.ThreadFactory;
+import java.util.concurrent.ThreadPoolExecutor;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+
+/**
+ * Resolves host names ahead of the loader on behalf of
+ * {@code DNSResolveQueueJava}. The lookups go through
+ * {@link InetAddress}, so a prefetched name is served from the same
+ * JVM address cache that {@code URLLoader} and {@code HTTP2Loader}
+ * consult when they open the connection.
+ */
+final class DNSResolver {
+
+    private static final PlatformLogger logger =
+            PlatformLogger.getLogger(DNSResolver.class.getName());
+
+    /**
+     * The size of the resolver thread pool. Matches the number of
+     * simultaneous requests issued by WebCore's DNSResolveQueue.
+     */
+    private static final int THREAD_POOL_SIZE = 8;
+
+    /**
+     * The thread pool keep alive time.
+     */
+    private static final long THREAD_POOL_KEEP_ALIVE_TIME = 10000L;
+
+    /**
+     * The maximum number of host names kept in the cache.
+     */
+    private static final int MAX_CACHE_SIZE = 256;
+
+    /**
+     * The default lifetime of a cache entry, the same as the default
+     * value of the "networkaddress.cache.ttl" security property.
+     */
+    private static final long DEFAULT_TTL_SECONDS = 30L;
+
+    /**
+     * Looks up the addresses of a host name.
+     */
+    interface Lookup {
+        InetAddress[] lookup(String host) throws UnknownHostException;
+    }
+
+    private static final class Entry {
+        private final CompletableFuture<InetAddress[]> addresses =
+                new CompletableFuture<>();
+        private volatile long expirationTime;
+    }
+
+    private static final ThreadPoolExecutor threadPool;
+    private static final long ttlNanos;
+    static {
+        threadPool = new ThreadPoolExecutor(
+                THREAD_POOL_SIZE,
+                THREAD_POOL_SIZE,
+                THREAD_POOL_KEEP_ALIVE_TIME,
+                TimeUnit.MILLISECONDS,
+                new LinkedBlockingQueue<Runnable>(),
+                new DNSResolverThreadFactory());
+        threadPool.allowCoreThreadTimeOut(true);
+
+        @SuppressWarnings("removal")
+        long ttl = AccessController.doPrivileged((PrivilegedAction<Long>) () -> {
+            try {
+                String value = Security.getProperty("networkaddress.cache.ttl");
+                if (value != null) {
+                    return Long.parseLong(value.trim());
+                }
+            } catch (NumberFormatException ex) {
+            }
+            return DEFAULT_TTL_SECONDS;
+        });
+        // A negative value means "cache forever" for InetAddress, but the
+        // entries here only exist to avoid repeating a lookup
+        ttlNanos = TimeUnit.SECONDS.toNanos(
+                ttl >= 0 ? ttl : DEFAULT_TTL_SECONDS);
+    }
+
+    /**
+     * The resolved and in-flight host names, in access order.
+     */
+    private static final Map<String, Entry> cache =
+            new LinkedHashMap<>(16, 0.75f, true) {
+                @Override
+                protected boolean removeEldestEntry(
+                        Map.Entry<String, Entry> eldest) {
+                    return size() > MAX_CACHE_SIZE;
+                }
+            };
+
+    private static volatile Lookup lookup = InetAddress::getAllByName;
+
+
+    /**
+     * Non-invocable constructor.
+     */
+    private DNSResolver() {
+        throw new AssertionError();
+    }
+
+
+    /**
+     * Replaces the host name lookup, for testing.
+     */
+    static void setLookup(Lookup newLookup) {
+        lookup = newLookup != null ? newLookup : InetAddress::getAllByName;
+        clearCache();
+    }
+
+    static void clearCache() {
+        synchronized (cache) {
+            cache.clear();
+        }
+    }
+
+    /**
+     * Resolves a host name on the resolver thread pool. Concurrent
+     * requests for the same name share a single lookup, and a
+     * successful result is reused until it expires.
+     */
+    static CompletableFuture<InetAddress[]> resolve(String host) {
+        Entry entry;
+        synchronized (cache) {
+            entry = cache.get(host);
+            if (entry != null && (!entry.addresses.isDone()
+                    || entry.expirationTime - System.nanoTime() > 0)) {
+                return entry.addresses;
+            }
+            entry = new Entry();
+            cache.put(host, entry);
+        }
+
+        final Entry newEntry = entry;
+        final Lookup currentLookup = lookup;
+        threadPool.submit(() -> {
+            try {
+                InetAddress[] addresses = currentLookup.lookup(host);
+                newEntry.expirationTime = System.nanoTime() + ttlNanos;
+                newEntry.addresses.complete(addresses);
+            } catch (UnknownHostException | RuntimeException ex) {
+                if (logger.isLoggable(Level.FINE)) {
+                    logger.fine(String.format(
+                            "Failed to resolve [%s]: %s", host, ex));
+                }
+                // Failures are not cached, the loader reports them
+                synchronized (cache) {
+                    cache.remove(host, newEntry);
+                }
+                newEntry.addresses.completeExceptionally(ex);
+            }
+        });
+        return newEntry.addresses;
+    }
+
+    /**
+     * Returns whether a proxy is configured. Prefetching is pointless
+     * when the host names are resolved by the proxy.
+     */
+    private static boolean fwkIsUsingProxy() {
+        @SuppressWarnings("removal")
+        ProxySelector proxySelector = AccessController.doPrivileged(
+                (PrivilegedAction<ProxySelector>) () -> ProxySelector.getDefault());
+        if (proxySelector == null) {
+            return false;
+        }
+        try {
+            List<Proxy> proxies =
+                    proxySelector.select(URI.create("http://example.com"));
+            for (Proxy proxy : proxies) {
+                if (proxy.type() != Proxy.Type.DIRECT) {
+                    return true;
+                }
+            }
+            return false;
+        } catch (RuntimeException ex) {
+            return true;
+        }
+    }
+
+    private static void fwkPrefetch(String host) {
+        resolve(host).whenComplete((addresses, ex) -> twkPrefetchComplete());
+    }
+
+    private static void fwkResolve(String host, long id) {
+        resolve(host).whenComplete((addresses, ex) -> {
+            byte[][] result = null;
+            if (addresses != null) {
+                result = new byte[addresses.length][];
+                for (int i = 0; i < addresses.length; i++) {
+                    result[i] = addresses[i].getAddress();
+                }
+            }
+            final byte[][] resolved = result;
+            Invoker.getInvoker().postOnEventThread(
+                    () -> twkDidResolve(id, resolved));
+        });
+    }
+
+    private static native void twkPrefetchComplete();
+    private static native void twkDidResolve(long id, byte[][] addresses);
+
+    /**
+     * Thread factory for resolver threads.
+     */
+    private static final class DNSResolverThreadFactory implements ThreadFactory {
+        private final ThreadGroup group;
+        private final AtomicInteger index = new AtomicInteger(1);
+
+        private DNSResolverThreadFactory() {
+            @SuppressWarnings("removal")
+            SecurityManager sm = System.getSecurityManager();
+            group = (sm != null) ? sm.getThreadGroup()
+                    : Thread.currentThread().getThreadGroup();
+        }
+
+        @Override
+        public Thread newThread(Runnable r) {
+            Thread t = new Thread(group, r, "DNS-Resolver-"
+                    + index.getAndIncrement());
+            t.setDaemon(true);
+            if (t.getPriority() != Thread.NORM_PRIORITY) {
+                t.setPriority(Thread.NORM_PRIORITY);
+            }
+            return t;
+        }
+    }
+}
@@ -31,6 +31,7 @@ import com.sun.webkit.Invoker;
 import com.sun.webkit.WebPage;
 import java.io.IOException;
 import java.io.InputStream;
+import java.io.OutputStream;
 import static java.lang.String.format;
 import java.net.ConnectException;
 import java.net.InetSocketAddress;
@@ -43,6 +44,7 @@ import java.net.SocketException;
 import java.net.URI;
 import java.net.URISyntaxException;
 import java.net.UnknownHostException;
+import java.nio.ByteBuffer;
 import java.security.AccessController;
 import java.security.PrivilegedAction;
 import java.util.List;
@@ -67,6 +69,22 @@ final class SocketStreamHandle {
             new SynchronousQueue<Runnable>(),
             new CustomThreadFactory());
 
+    /**
+     * The size of the send and receive ring buffers.
+     */
+    private static final int BUFFER_SIZE = 1024 * 64;
+
+    /**
+     * The size of the chunks copied between the rings and the socket.
+     */
+    private static final int CHUNK_SIZE = 8192;
+
+    /**
+     * The shared pool of ring buffers.
+     */
+    private static final ByteBufferPool byteBufferPool =
+            ByteBufferPool.newInstance(BUFFER_SIZE);
+
     private enum State {ACTIVE, CLOSE_REQUESTED, DISPOSED}
 
     private final String host;
@@ -78,6 +96,26 @@ final class SocketStreamHandle {
     private volatile State state = State.ACTIVE;
     private volatile boolean connected;
 
+    // Outgoing data is written into sendBuffer by the native code and
+    // handed over with fwkFlush(), incoming data is collected in
+    // receiveBuffer and delivered to the native code in batches on the
+    // event thread. The counters below only grow and are guarded by
+    // this object.
+    private final ByteBufferAllocator allocator =
+            byteBufferPool.newAllocator(2);
+    private final ByteBuffer sendBuffer;
+    private final ByteBuffer receiveBuffer;
+    private final byte[] writeChunk = new byte[CHUNK_SIZE];
+    private long sendQueued;
+    private long sendWritten;
+    private boolean writing;
+    private boolean sendNotificationPending;
+    private long received;
+    private long delivered;
+    private boolean deliveryPending;
+    private boolean readerFinished;
+    private boolean buffersReleased;
+
     private SocketStreamHandle(String host, int port, boolean ssl,
                                WebPage webPage, long data)
     {
@@ -86,6 +124,13 @@ final class SocketStreamHandle {
         this.ssl = ssl;
         this.webPage = webPage;
         this.data = data;
+        try {
+            sendBuffer = allocator.allocate();
+            receiveBuffer = allocator.allocate();
+        } catch (InterruptedException ex) {
+            // Cannot happen, the allocator is not shared
+            throw new AssertionError(ex);
+        }
     }
 
     private static SocketStreamHandle fwkCreate(String host, int port,
@@ -96,7 +141,11 @@ final class SocketStreamHandle {
                 new SocketStreamHandle(host, port, ssl, webPage, data);
         logger.finest("Starting {0}", ssh);
         threadPool.submit(() -> {
-            ssh.run();
+            try {
+                ssh.run();
+            } finally {
+                ssh.finishReading();
+            }
         });
         return ssh;
     }
@@ -130,8 +179,8 @@ final class SocketStreamHandle {
             logger.finest("{0} connected", this);
             didOpen();
             InputStream is = socket.getInputStream();
+            byte[] buffer = new byte[CHUNK_SIZE];
             while (true) {
-                byte[] buffer = new byte[8192];
                 int n = is.read(buffer);
                 if(n > 0) {
                     if (logger.isLoggable(Level.FINEST)) {
@@ -286,24 +335,74 @@ final class SocketStreamHandle {
         }
     }
 
-    private int fwkSend(byte[] buffer) {
-        if (logger.isLoggable(Level.FINEST)) {
-            logger.finest(format("%s sending len: [%d], data:%s",
-                    this, buffer.length, dump(buffer, buffer.length)));
+    private ByteBuffer fwkGetSendBuffer() {
+        return sendBuffer;
+    }
+
+    /**
+     * Makes the data queued by the native code, up to the given total
+     * byte count, available to the writer.
+     */
+    private void fwkFlush(long queued) {
+        if (!connected) {
+            logger.finest("{0} not connected", this);
+            didFail(0, "Not connected");
+            return;
         }
-        if (connected) {
-            try {
-                socket.getOutputStream().write(buffer);
-                return buffer.length;
-            } catch (IOException ex) {
+        synchronized (this) {
+            sendQueued = queued;
+            if (writing || state != State.ACTIVE) {
+                return;
+            }
+            writing = true;
+        }
+        threadPool.submit(() -> {
+            write();
+        });
+    }
+
+    private void write() {
+        try {
+            OutputStream os = socket.getOutputStream();
+            while (true) {
+                long start, end;
+                synchronized (this) {
+                    start = sendWritten;
+                    end = sendQueued;
+                    if (start == end || state != State.ACTIVE) {
+                        // Checked together with fwkFlush() so that no
+                        // flush is missed
+                        writing = false;
+                        releaseBuffersIfDone();
+                        return;
+                    }
+                }
+                while (start < end) {
+                    int position = (int) (start % BUFFER_SIZE);
+                    int len = (int) Math.min(Math.min(end - start,
+                            BUFFER_SIZE - position), CHUNK_SIZE);
+                    sendBuffer.get(position, writeChunk, 0, len);
+                    if (logger.isLoggable(Level.FINEST)) {
+                        logger.finest(format("%s sending len: [%d], data:%s",
+                                this, len, dump(writeChunk, len)));
+                    }
+                    os.write(writeChunk, 0, len);
+                    start += len;
+                }
+                synchronized (this) {
+                    sendWritten = end;
+                }
+                didSendData();
+            }
+        } catch (IOException ex) {
+            if (state == State.ACTIVE) {
                 logger.finest(format("%s exception", this), ex);
                 didFail(0, "I/O error");
-                return 0;
             }
-        } else {
-            logger.finest("{0} not connected", this);
-            didFail(0, "Not connected");
-            return 0;
+        }
+        synchronized (this) {
+            writing = false;
+            releaseBuffersIfDone();
         }
     }
 
@@ -311,6 +410,7 @@ final class SocketStreamHandle {
         synchronized (this) {
             logger.finest("{0}", this);
             state = State.CLOSE_REQUESTED;
+            notifyAll();
             try {
                 if (socket != null) {
                     socket.close();
@@ -319,9 +419,31 @@ final class SocketStreamHandle {
         }
     }
 
-    private void fwkNotifyDisposed() {
+    private synchronized void fwkNotifyDisposed() {
         logger.finest("{0}", this);
         state = State.DISPOSED;
+        notifyAll();
+        releaseBuffersIfDone();
+    }
+
+    private synchronized void finishReading() {
+        readerFinished = true;
+        releaseBuffersIfDone();
+    }
+
+    /**
+     * Returns the ring buffers to the pool once neither the native code
+     * nor the reader and writer can touch them anymore.
+     */
+    private void releaseBuffersIfDone() {
+        if (buffersReleased || writing || !readerFinished
+                || state != State.DISPOSED)
+        {
+            return;
+        }
+        buffersReleased = true;
+        allocator.release(sendBuffer);
+        allocator.release(receiveBuffer);
     }
 
     private void didOpen() {
@@ -332,10 +454,78 @@ final class SocketStreamHandle {
         });
     }
 
-    private void didReceiveData(final byte[] buffer, final int len) {
+    /**
+     * Copies the data into the receive ring, waiting for the event
+     * thread to make room if it is full. Only one delivery is posted
+     * for whatever accumulates before the event thread gets to it.
+     */
+    private void didReceiveData(byte[] buffer, int len)
+            throws InterruptedException
+    {
+        int offset = 0;
+        while (offset < len) {
+            boolean post;
+            synchronized (this) {
+                while (received - delivered == BUFFER_SIZE
+                        && state == State.ACTIVE)
+                {
+                    wait();
+                }
+                if (state != State.ACTIVE) {
+                    return;
+                }
+                int position = (int) (received % BUFFER_SIZE);
+                int count = Math.min(len - offset, Math.min(
+                        (int) (BUFFER_SIZE - (received - delivered)),
+                        BUFFER_SIZE - position));
+                receiveBuffer.put(position, buffer, offset, count);
+                received += count;
+                offset += count;
+                post = !deliveryPending;
+                deliveryPending = true;
+            }
+            if (post) {
+                Invoker.getInvoker().postOnEventThread(() -> {
+                    deliverReceivedData();
+                });
+            }
+        }
+    }
+
+    private void deliverReceivedData() {
+        long start, end;
+        synchronized (this) {
+            start = delivered;
+            end = received;
+            deliveryPending = false;
+        }
+        while (start < end && state == State.ACTIVE) {
+            int position = (int) (start % BUFFER_SIZE);
+            int len = (int) Math.min(end - start, BUFFER_SIZE - position);
+            notifyDidReceiveData(position, len);
+            start += len;
+        }
+        synchronized (this) {
+            delivered = end;
+            notifyAll();
+        }
+    }
+
+    private void didSendData() {
+        synchronized (this) {
+            if (sendNotificationPending) {
+                return;
+            }
+            sendNotificationPending = true;
+        }
         Invoker.getInvoker().postOnEventThread(() -> {
+            long written;
+            synchronized (this) {
+                sendNotificationPending = false;
+                written = sendWritten;
+            }
             if (state == State.ACTIVE) {
-                notifyDidReceiveData(buffer, len);
+                notifyDidSendData(written);
             }
         });
     }
@@ -361,12 +551,21 @@ final class SocketStreamHandle {
         twkDidOpen(data);
     }
 
-    private void notifyDidReceiveData(byte[] buffer, int len) {
+    private void notifyDidReceiveData(int position, int len) {
         if (logger.isLoggable(Level.FINEST)) {
+            byte[] buffer = new byte[len];
+            receiveBuffer.get(position, buffer);
             logger.finest(format("%s, len: [%d], data:%s",
                     this, len, dump(buffer, len)));
         }
-        twkDidReceiveData(buffer, len, data);
+        twkDidReceiveData(receiveBuffer, position, len, data);
+    }
+
+    private void notifyDidSendData(long sentByteCount) {
+        if (logger.isLoggable(Level.FINEST)) {
+            logger.finest(format("%s, sent: [%d]", this, sentByteCount));
+        }
+        twkDidSendData(sentByteCount, data);
     }
 
     private void notifyDidFail(int errorCode, String errorDescription) {
@@ -384,8 +583,10 @@ final class SocketStreamHandle {
     }
 
     private static native void twkDidOpen(long data);
-    private static native void twkDidReceiveData(byte[] buffer, int len,
+    private static native void twkDidReceiveData(ByteBuffer byteBuffer,
+                                                 int position, int len,
                                                  long data);
+    private static native void twkDidSendData(long sentByteCount, long data);
     private static native void twkDidFail(int errorCode,
                                           String errorDescription, long data);
     private static native void twkDidClose(long data);
@@ -28,6 +28,7 @@ package com.sun.webkit.perf;
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.webkit.graphics.WCFont;
 import com.sun.webkit.graphics.WCTextRun;
+import java.nio.ByteBuffer;
 
 public final class WCFontPerfLogger extends WCFont {
     private static final PlatformLogger log =
@@ -71,11 +72,10 @@ public final class WCFontPerfLogger extends WCFont {
         return runs;
     }
 
-    public int[] getGlyphCodes(char[] chars) {
+    public void getGlyphCodes(char[] chars, int length, int[] glyphs) {
         logger.resumeCount("GETGLYPHCODES");
-        int[] res = fnt.getGlyphCodes(chars);
+        fnt.getGlyphCodes(chars, length, glyphs);
         logger.suspendCount("GETGLYPHCODES");
-        return res;
     }
 
     public float getXHeight() {
@@ -99,6 +99,25 @@ public final class WCFontPerfLogger extends WCFont {
         return res;
     }
 
+    public void getGlyphAdvances(int firstGlyph, int count, ByteBuffer advances) {
+        logger.resumeCount("GETGLYPHADVANCES");
+        fnt.getGlyphAdvances(firstGlyph, count, advances);
+        logger.suspendCount("GETGLYPHADVANCES");
+    }
+
+    public void getGlyphBoundingBoxes(int firstGlyph, int count, ByteBuffer boxes) {
+        logger.resumeCount("GETGLYPHBOUNDINGBOXES");
+        fnt.getGlyphBoundingBoxes(firstGlyph, count, boxes);
+        logger.suspendCount("GETGLYPHBOUNDINGBOXES");
+    }
+
+    public byte[] getFontTable(int tag) {
+        logger.resumeCount("GETFONTTABLE");
+        byte[] res = fnt.getFontTable(tag);
+        logger.suspendCount("GETFONTTABLE");
+        return res;
+    }
+
     public int hashCode() {
         logger.resumeCount("HASH");
         int res = fnt.hashCode();
@@ -2503,6 +2503,45 @@ void Heap::collectNowFullIfNotDoneRecently(Synchronousness synchronousness)
     collectNow(synchronousness, CollectionScope::Full);
 }
 
+bool Heap::collectDuringIdleTime(Seconds budget)
+{
+    ASSERT(vm().currentThreadIsHoldingAPILock());
+
+    if (!Options::useIdleTimeCollection() || !Options::useGC() || !m_isSafeToCollect || isDeferred())
+        return false;
+
+    if (mutatorState() != MutatorState::Running)
+        return false;
+
+    // A collection is already running or has been requested.
+    if (m_collectionScope)
+        return false;
+    {
+        Locker locker { *m_threadLock };
+        if (m_lastGrantedTicket > m_lastServedTicket)
+            return false;
+    }
+
+    // Don't collect early unless the allocation-triggered collection would come soon anyway,
+    // otherwise idle time would just add collections.
+    size_t bytesAllowedThisCycle = m_maxEdenSize;
+#if USE(BMALLOC_MEMORY_FOOTPRINT_API)
+    if (overCriticalMemoryThreshold())
+        bytesAllowedThisCycle = std::min(m_maxEdenSizeWhenCritical, bytesAllowedThisCycle);
+#endif
+    if (m_bytesAllocatedThisCycle < bytesAllowedThisCycle * Options::idleTimeCollectionMinEdenFraction())
+        return false;
+
+    bool wantsFullCollection = !useGenerationalGC() || m_shouldDoFullCollection;
+    Seconds expectedLength = wantsFullCollection ? m_lastFullGCLength : m_lastEdenGCLength;
+    if (expectedLength > budget * Options::idleTimeCollectionBudgetUtilization())
+        return false;
+
+    dataLogIf(Options::logGC(), "[GC<", RawPointer(this), ">: idle time collection, budget ", budget.milliseconds(), " ms, expected ", expectedLength.milliseconds(), " ms]\n");
+    collectSync(wantsFullCollection ? CollectionScope::Full : CollectionScope::Eden);
+    return true;
+}
+
 bool Heap::useGenerationalGC()
 {
     return Options::useGenerationalGC() && !VM::isInMiniMode();
@@ -376,6 +376,12 @@ public:
 
     JS_EXPORT_PRIVATE void collectNowFullIfNotDoneRecently(Synchronousness);
 
+    // Called by the embedder when the mutator is about to go idle for roughly the given budget,
+    // e.g. between rendering frames. Runs a synchronous collection now if one would be due soon
+    // anyway and the previous collection of that kind fit into the budget, so that the collection
+    // does not land in the middle of the next frame instead. Returns true if it collected.
+    JS_EXPORT_PRIVATE bool collectDuringIdleTime(Seconds budget);
+
     void collectIfNecessaryOrDefer(GCDeferralContext* = nullptr);
 
     void completeAllJITPlans();
@@ -1149,10 +1149,17 @@ bool canUseJITCage() { return false; }
 
 bool canUseWebAssemblyFastMemory()
 {
+#if PLATFORM(JAVA)
+    // Fast memories catch out of bounds accesses with a SIGSEGV handler,
+    // but in the Java port SIGSEGV belongs to the JVM, which relies on it
+    // for implicit null checks and safepoints. Bounds check explicitly.
+    return false;
+#else
     // Gigacage::hasCapacityToUseLargeGigacage is determined based on EFFECTIVE_ADDRESS_WIDTH.
     // If we have enough address range to potentially use a large gigacage,
     // then we have enough address range to useWebAssemblyFastMemory.
     return Gigacage::hasCapacityToUseLargeGigacage;
+#endif
 }
 
 } // namespace JSC
@@ -344,6 +344,9 @@ bool canUseWebAssemblyFastMemory();
     v(Double, percentCPUPerMBForFullTimer, 0.0003125, Normal, nullptr) \
     v(Double, percentCPUPerMBForEdenTimer, 0.0025, Normal, nullptr) \
     v(Double, collectionTimerMaxPercentCPU, 0.05, Normal, nullptr) \
+    v(Bool, useIdleTimeCollection, false, Normal, "If true, Heap::collectDuringIdleTime() may run a collection when the embedder reports idle time.") \
+    v(Double, idleTimeCollectionMinEdenFraction, 0.5, Normal, "Fraction of the eden size that must have been allocated before an idle-time collection is worth running.") \
+    v(Double, idleTimeCollectionBudgetUtilization, 0.8, Normal, "Fraction of the reported idle time that the expected collection length may take up.") \
     \
     v(Bool, forceWeakRandomSeed, false, Normal, nullptr) \
     v(Unsigned, forcedWeakRandomSeed, 0, Normal, nullptr) \
@@ -8,6 +8,7 @@ list(APPEND WTF_INCLUDE_DIRECTORIES
 )
 
 list(APPEND WTF_PUBLIC_HEADERS
+    java/JavaCallProfiler.h
     java/JavaEnv.h
     java/JavaRef.h
     java/DbgUtils.h
@@ -17,6 +18,7 @@ list(APPEND WTF_PUBLIC_HEADERS
 
 list(APPEND WTF_SOURCES
     java/FileSystemJava.cpp
+    java/JavaCallProfiler.cpp
     java/JavaEnv.cpp
     java/MainThreadJava.cpp
     java/StringJava.cpp
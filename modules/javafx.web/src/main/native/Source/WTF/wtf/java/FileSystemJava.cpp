@@ -26,6 +26,7 @@
 #include "config.h"
 #include "FileSystem.h"
 #include "FileMetadata.h"
+#include <wtf/CheckedArithmetic.h>
 #include <wtf/java/JavaEnv.h>
 #include <wtf/text/CString.h>
 
@@ -84,7 +85,8 @@ bool getFileSize(const String& path, long long& result)
 std::optional<uint64_t> fileSize(const String& path)
 {
     long long size = 0;
-    getFileSize(path, size);
+    if (!getFileSize(path, size))
+        return std::nullopt;
     return size;
 }
 
@@ -189,9 +191,9 @@ CString fileSystemRepresentation(const String& s)
     return CString(s.latin1().data());
 }
 
-PlatformFileHandle openFile(const String& path, FileOpenMode mode, FileAccessPermission, bool)
+PlatformFileHandle openFile(const String& path, FileOpenMode mode, FileAccessPermission, bool failIfFileExists)
 {
-    if (mode != FileOpenMode::Read) {
+    if (failIfFileExists && fileExists(path)) {
         return invalidPlatformFileHandle;
     }
     JNIEnv* env = WTF::GetJavaEnv();
@@ -201,13 +203,22 @@ PlatformFileHandle openFile(const String& path, FileOpenMode mode, FileAccessPer
             "(Ljava/lang/String;Ljava/lang/String;)Ljava/io/RandomAccessFile;");
     ASSERT(mid);
 
-    PlatformFileHandle result = env->CallStaticObjectMethod(
+    JLObject result(env->CallStaticObjectMethod(
             comSunWebkitFileSystem,
             mid,
-            (jstring)path.toJavaString(env), (jstring)(env->NewStringUTF("r")));
-
+            (jstring)path.toJavaString(env),
+            (jstring)String(mode == FileOpenMode::Read ? "r"_s : "rw"_s).toJavaString(env)));
     WTF::CheckAndClearException(env);
-    return result ? result : invalidPlatformFileHandle;
+    if (!result) {
+        return invalidPlatformFileHandle;
+    }
+
+    PlatformFileHandle handle { result };
+    // RandomAccessFile has no truncating mode
+    if (mode == FileOpenMode::Write && !truncateFile(handle, 0)) {
+        closeFile(handle);
+    }
+    return handle;
 }
 
 void closeFile(PlatformFileHandle& handle)
@@ -296,6 +307,170 @@ long long seekFile(PlatformFileHandle handle, long long offset, FileSeekOrigin)
     return offset;
 }
 
+int writeToFile(PlatformFileHandle handle, const void* data, int length)
+{
+    if (length < 0 || !isHandleValid(handle) || data == nullptr) {
+        return -1;
+    }
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkWriteToFile",
+            "(Ljava/io/RandomAccessFile;Ljava/nio/ByteBuffer;)I");
+    ASSERT(mid);
+
+    int result = env->CallStaticIntMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jobject)handle,
+            (jobject)JLObject(env->NewDirectByteBuffer(const_cast<void*>(data), length)));
+    if (WTF::CheckAndClearException(env) || result < 0) {
+        return -1;
+    }
+    return result;
+}
+
+bool truncateFile(PlatformFileHandle handle, long long offset)
+{
+    if (offset < 0 || !isHandleValid(handle)) {
+        return false;
+    }
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkTruncateFile",
+            "(Ljava/io/RandomAccessFile;J)Z");
+    ASSERT(mid);
+
+    jboolean result = env->CallStaticBooleanMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jobject)handle, (jlong)offset);
+    WTF::CheckAndClearException(env);
+
+    return jbool_to_bool(result);
+}
+
+std::optional<uint64_t> fileSize(PlatformFileHandle handle)
+{
+    if (!isHandleValid(handle)) {
+        return std::nullopt;
+    }
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkGetFileLength",
+            "(Ljava/io/RandomAccessFile;)J");
+    ASSERT(mid);
+
+    jlong size = env->CallStaticLongMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jobject)handle);
+    WTF::CheckAndClearException(env);
+
+    if (size < 0) {
+        return std::nullopt;
+    }
+    return size;
+}
+
+std::optional<Vector<uint8_t>> readEntireFile(PlatformFileHandle handle)
+{
+    auto size = fileSize(handle).value_or(0);
+    if (!size) {
+        return std::nullopt;
+    }
+    size_t bytesToRead;
+    if (!WTF::convertSafely(size, bytesToRead) || bytesToRead > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        return std::nullopt;
+    }
+
+    Vector<uint8_t> buffer(bytesToRead);
+    size_t totalBytesRead = 0;
+    int bytesRead;
+    while ((bytesRead = readFromFile(handle, buffer.data() + totalBytesRead, bytesToRead - totalBytesRead)) > 0) {
+        totalBytesRead += bytesRead;
+    }
+    if (totalBytesRead != bytesToRead) {
+        return std::nullopt;
+    }
+    return buffer;
+}
+
+std::optional<Vector<uint8_t>> readEntireFile(const String& path)
+{
+    auto handle = openFile(path, FileOpenMode::Read);
+    auto contents = readEntireFile(handle);
+    closeFile(handle);
+
+    return contents;
+}
+
+bool moveFile(const String& oldPath, const String& newPath)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkMoveFile",
+            "(Ljava/lang/String;Ljava/lang/String;)Z");
+    ASSERT(mid);
+
+    jboolean result = env->CallStaticBooleanMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring)oldPath.toJavaString(env),
+            (jstring)newPath.toJavaString(env));
+    WTF::CheckAndClearException(env);
+
+    return jbool_to_bool(result);
+}
+
+bool deleteFile(const String& path)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkDeleteFile",
+            "(Ljava/lang/String;)Z");
+    ASSERT(mid);
+
+    jboolean result = env->CallStaticBooleanMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring)path.toJavaString(env));
+    WTF::CheckAndClearException(env);
+
+    return jbool_to_bool(result);
+}
+
+Vector<String> listDirectory(const String& path)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkListDirectory",
+            "(Ljava/lang/String;)[Ljava/lang/String;");
+    ASSERT(mid);
+
+    JLObjectArray names(static_cast<jobjectArray>(env->CallStaticObjectMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring)path.toJavaString(env))));
+    Vector<String> fileNames;
+    if (WTF::CheckAndClearException(env) || !names) {
+        return fileNames;
+    }
+
+    jsize count = env->GetArrayLength(names);
+    fileNames.reserveInitialCapacity(count);
+    for (jsize i = 0; i < count; i++) {
+        JLString name(static_cast<jstring>(env->GetObjectArrayElement(names, i)));
+        fileNames.uncheckedAppend(String(env, name));
+    }
+    return fileNames;
+}
+
 
 // -----------------------------------------------------------------------
 // Below methods are stubs as of now.
@@ -327,31 +502,6 @@ Vector<String> listDirectory(const String&, const String&)
     return entities;
 }
 
-Vector<String> listDirectory(const String&)
-{
-    fprintf(stderr, "listDirectory(const String&) NOT IMPLEMENTED\n");
-    Vector<String> entities;
-    return entities;
-}
-
-int writeToFile(PlatformFileHandle, const void* data, int length)
-{
-    fprintf(stderr, "writeToFile(PlatformFileHandle, const void* data, int length) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(data);
-    UNUSED_PARAM(length);
-
-    return -1;
-}
-
-bool truncateFile(PlatformFileHandle, long long offset)
-{
-    fprintf(stderr, "truncateFile(PlatformFileHandle, long long offset) NOT IMPLEMENTED\n");
-
-    // FIXME: openjfx2.26 implement truncateFile
-    UNUSED_PARAM(offset);
-    return false;
-}
-
 std::optional<int32_t> getFileDeviceId(const CString&)
 {
     fprintf(stderr, "getFileDeviceId(const CString&) NOT IMPLEMENTED\n");
@@ -377,12 +527,6 @@ MappedFileData::~MappedFileData()
     unmapViewOfFile(m_fileData, m_fileSize);
 }
 
-bool deleteFile(const String&)
-{
-    fprintf(stderr, "deleteFile(const String&) NOT IMPLEMENTED\n");
-    return false;
-}
-
 bool deleteEmptyDirectory(String const &)
 {
     fprintf(stderr, "deleteEmptyDirectory(String const &) NOT IMPLEMENTED\n");
@@ -403,15 +547,6 @@ String parentPath(const String& path)
     return "";
 }
 
-bool moveFile(const String& oldPath, const String& newPath)
-{
-    fprintf(stderr, "moveFile(const String& oldPath, const String& newPath) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(oldPath);
-    UNUSED_PARAM(newPath);
-
-    return false;
-}
-
 bool isHiddenFile(const String& path)
 {
     fprintf(stderr, "isHiddenFile(const String& path) NOT IMPLEMENTED\n");
@@ -461,35 +596,12 @@ bool flushFile(PlatformFileHandle handle)
      return false;
 }
 
-std::optional<Vector<uint8_t>> readEntireFile(PlatformFileHandle handle)
-{
-    fprintf(stderr, "readEntireFile(PlatformFileHandle handle) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(handle);
-    Vector<uint8_t> vec;
-    return vec;
-}
-std::optional<Vector<uint8_t>> readEntireFile(const String& path)
-{
-    fprintf(stderr, "readEntireFile(const String& path) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(path);
-    Vector<uint8_t> vec;
-    return vec;
-}
-
 bool deleteNonEmptyDirectory(String const &)
 {
     fprintf(stderr, "deleteNonEmptyDirectory(String const &) NOT IMPLEMENTED\n");
     return false;
 }
 
-std::optional<uint64_t> fileSize(PlatformFileHandle handle)
-{
-    long long size = 0;
-    fprintf(stderr, "readEntireFile(PlatformFileHandle) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(handle);
-    return size;
-}
-
 } // namespace FileSystemImpl
 
 } // namespace WTF
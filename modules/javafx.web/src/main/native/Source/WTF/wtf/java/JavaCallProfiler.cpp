@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+
+#include <wtf/HashMap.h>
+#include <wtf/JSONValues.h>
+#include <wtf/Lock.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/StdLibExtras.h>
+#include <wtf/java/JavaCallProfiler.h>
+#include <wtf/java/JavaEnv.h>
+#include <wtf/text/StringHash.h>
+
+namespace WTF {
+
+std::atomic<bool> JavaCallProfiler::s_enabled { false };
+
+namespace {
+
+struct CallSite {
+    const char* file { nullptr };
+    int line { 0 };
+    uint64_t count { 0 };
+    Seconds totalTime;
+    Seconds maxTime;
+};
+
+// Keyed by the __FILE__ pointer, which is not unique for a file included
+// into several translation units; statistics() merges those.
+using CallSiteMap = HashMap<std::pair<const void*, int>, CallSite>;
+
+}
+
+static Lock callSiteLock;
+static MonotonicTime profilingStart;
+// Bumped whenever profiling is enabled or reset. A thread's mark taken in
+// an earlier generation is stale and must not be charged to a call site.
+static std::atomic<unsigned> markGeneration { 0 };
+static thread_local MonotonicTime lastMark;
+static thread_local unsigned lastMarkGeneration;
+
+static CallSiteMap& callSites()
+{
+    static NeverDestroyed<CallSiteMap> map;
+    return map;
+}
+
+void JavaCallProfiler::setEnabled(bool enabled)
+{
+    Locker locker { callSiteLock };
+    if (enabled && !isEnabled()) {
+        profilingStart = MonotonicTime::now();
+        markGeneration.fetch_add(1, std::memory_order_relaxed);
+    }
+    s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void JavaCallProfiler::reset()
+{
+    Locker locker { callSiteLock };
+    callSites().clear();
+    profilingStart = MonotonicTime::now();
+    markGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
+void JavaCallProfiler::willCall()
+{
+    lastMark = MonotonicTime::now();
+    lastMarkGeneration = markGeneration.load(std::memory_order_relaxed);
+}
+
+void JavaCallProfiler::didCall(const char* file, int line)
+{
+    auto now = MonotonicTime::now();
+    unsigned generation = markGeneration.load(std::memory_order_relaxed);
+    Seconds elapsed = lastMark && lastMarkGeneration == generation ? now - lastMark : Seconds();
+    lastMark = now;
+    lastMarkGeneration = generation;
+
+    Locker locker { callSiteLock };
+    auto& site = callSites().add(std::make_pair(static_cast<const void*>(file), line), CallSite { file, line }).iterator->value;
+    ++site.count;
+    site.totalTime += elapsed;
+    site.maxTime = std::max(site.maxTime, elapsed);
+}
+
+static const char* baseName(const char* path)
+{
+    const char* name = path;
+    for (const char* p = path; *p; ++p) {
+        if (*p == '/' || *p == '\\')
+            name = p + 1;
+    }
+    return name;
+}
+
+String JavaCallProfiler::statistics()
+{
+    Vector<CallSite> sites;
+    Seconds duration;
+    {
+        Locker locker { callSiteLock };
+        HashMap<String, size_t> indexByName;
+        for (auto& site : callSites().values()) {
+            String name = makeString(baseName(site.file), ':', site.line);
+            auto result = indexByName.add(name, sites.size());
+            if (result.isNewEntry) {
+                sites.append(site);
+                continue;
+            }
+            auto& merged = sites[result.iterator->value];
+            merged.count += site.count;
+            merged.totalTime += site.totalTime;
+            merged.maxTime = std::max(merged.maxTime, site.maxTime);
+        }
+        if (profilingStart)
+            duration = MonotonicTime::now() - profilingStart;
+    }
+
+    std::sort(sites.begin(), sites.end(), [](auto& a, auto& b) {
+        return a.totalTime > b.totalTime;
+    });
+
+    uint64_t callCount = 0;
+    auto array = JSON::Array::create();
+    for (auto& site : sites) {
+        callCount += site.count;
+        auto object = JSON::Object::create();
+        object->setString("site"_s, makeString(baseName(site.file), ':', site.line));
+        object->setDouble("count"_s, site.count);
+        object->setDouble("totalMillis"_s, site.totalTime.milliseconds());
+        object->setDouble("maxMillis"_s, site.maxTime.milliseconds());
+        array->pushObject(WTFMove(object));
+    }
+
+    auto result = JSON::Object::create();
+    result->setBoolean("enabled"_s, isEnabled());
+    result->setDouble("durationMillis"_s, duration.milliseconds());
+    result->setDouble("callCount"_s, callCount);
+    result->setArray("sites"_s, WTFMove(array));
+    return result->toJSONString();
+}
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_JavaCallProfiler_twkSetEnabled
+  (JNIEnv*, jclass, jboolean enabled)
+{
+    JavaCallProfiler::setEnabled(enabled == JNI_TRUE);
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_JavaCallProfiler_twkReset
+  (JNIEnv*, jclass)
+{
+    JavaCallProfiler::reset();
+}
+
+JNIEXPORT jstring JNICALL Java_com_sun_webkit_JavaCallProfiler_twkGetStatistics
+  (JNIEnv* env, jclass)
+{
+    return JavaCallProfiler::statistics().toJavaString(env).releaseLocal();
+}
+
+}
+
+} // namespace WTF
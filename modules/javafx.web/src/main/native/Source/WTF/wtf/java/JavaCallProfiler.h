@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <wtf/Forward.h>
+
+namespace WTF {
+
+// Opt-in statistics of the calls native code makes into Java, per call
+// site. A call site is the CheckAndClearException() that follows a call.
+// Its time is measured from the thread's previous GetJavaEnv() or
+// CheckAndClearException(), so it also covers converting the arguments.
+// While disabled, each call costs one relaxed load.
+class JavaCallProfiler {
+public:
+    static bool isEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+    static void setEnabled(bool);
+    static void reset();
+
+    // Returns the call sites as JSON, the most expensive first.
+    static String statistics();
+
+    static void willCall();
+    static void didCall(const char* file, int line);
+
+private:
+    static std::atomic<bool> s_enabled;
+};
+
+} // namespace WTF
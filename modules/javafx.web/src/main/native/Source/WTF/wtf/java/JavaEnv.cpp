@@ -24,6 +24,7 @@
 */
 #include "config.h"
 
+#include <atomic>
 #include <wtf/Assertions.h>
 #include <wtf/java/JavaEnv.h>
 
@@ -33,8 +34,19 @@ volatile bool g_ShuttingDown = false;
 namespace WTF {
 JGClass comSunWebkitFileSystem;
 
-bool CheckAndClearException(JNIEnv* env)
+static std::atomic<uint64_t> javaCallCount { 0 };
+
+uint64_t JavaCallCount()
 {
+    return javaCallCount.load(std::memory_order_relaxed);
+}
+
+bool CheckAndClearExceptionAt(JNIEnv* env, const char* file, int line)
+{
+    if (UNLIKELY(JavaCallProfiler::isEnabled())) {
+        javaCallCount.fetch_add(1, std::memory_order_relaxed);
+        JavaCallProfiler::didCall(file, line);
+    }
     if (JNI_TRUE == env->ExceptionCheck()) {
         env->ExceptionDescribe();
         env->ExceptionClear();
@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include <wtf/java/JavaCallProfiler.h>
 #include <wtf/java/JavaRef.h>
 
 #include <jni.h>
@@ -42,10 +43,19 @@ ALWAYS_INLINE JNIEnv* JNICALL GetJavaEnv()
 {
     void* env;
     jvm->GetEnv(&env, JNI_VERSION_1_2);
+    if (UNLIKELY(JavaCallProfiler::isEnabled()))
+        JavaCallProfiler::willCall();
     return (JNIEnv*)env;
 }
 
-bool CheckAndClearException(JNIEnv* env);
+bool CheckAndClearExceptionAt(JNIEnv* env, const char* file, int line);
+// Identifies the call site for JavaCallProfiler.
+#define CheckAndClearException(env) CheckAndClearExceptionAt(env, __FILE__, __LINE__)
+
+// The number of CheckAndClearException() calls made while JavaCallProfiler
+// was enabled. Nearly every call into Java is followed by one, so this
+// approximates the number of calls.
+uint64_t JavaCallCount();
 
 JLObject PL_GetLogger(JNIEnv* env, const char* name);
 void PL_ResumeCount(JNIEnv* env, jobject perfLogger, const char* probe);
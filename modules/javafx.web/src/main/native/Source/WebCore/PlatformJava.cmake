@@ -21,6 +21,7 @@ list(APPEND WebCore_INCLUDE_DIRECTORIES
     "${WEBCORE_DIR}/platform/network"
     "${WEBCORE_DIR}/platform/network/java"
     "${WEBCORE_DIR}/bindings/java"
+    "${WEBCORE_DIR}/loader/cache/java"
     "${WEBCORE_DIR}/page/java"
     "${WEBCORE_DIR}/bridge/jni"
     "${WEBKITLEGACY_DIR}"
@@ -76,6 +77,12 @@ list(APPEND WebCore_LIBRARIES
     ${JAVA_JVM_LIBRARY}
 )
 
+if (USE_HARFBUZZ_SHAPING)
+    list(APPEND WebCore_LIBRARIES
+        HarfBuzz::HarfBuzz
+    )
+endif ()
+
 add_definitions(-DSTATICALLY_LINKED_WITH_JavaScriptCore)
 add_definitions(-DSTATICALLY_LINKED_WITH_WTF)
 
@@ -86,8 +93,11 @@ list(APPEND WebCore_PRIVATE_FRAMEWORK_HEADERS
     bindings/java/JavaNodeFilterCondition.h
     bridge/jni/jsc/BridgeUtils.h
     dom/DOMStringList.h
+    platform/graphics/java/GlyphMetricsTableJava.h
+    platform/graphics/java/HarfBuzzFontJava.h
     platform/graphics/java/ImageBufferJavaBackend.h
     platform/graphics/java/ImageJava.h
+    platform/graphics/java/PathJava.h
     platform/graphics/java/PlatformContextJava.h
     platform/graphics/java/RQRef.h
     platform/graphics/java/RenderingQueue.h
@@ -109,3 +119,6 @@ list(APPEND WebCore_PRIVATE_FRAMEWORK_HEADERS
 list(APPEND WebCore_UNIFIED_SOURCE_LIST_FILES
     "SourcesJava.txt"
 )
+
+MAKE_HASH_TOOLS(${WEBCORE_DIR}/platform/java/MIMETypeExtensionData)
+list(APPEND WebCore_SOURCES ${WebCore_DERIVED_SOURCES_DIR}/MIMETypeExtensionData.cpp)
@@ -36,6 +36,10 @@
 #include "StyleSheetContents.h"
 #include "TextResourceDecoder.h"
 
+#if PLATFORM(JAVA)
+#include "SharedResourceCacheJava.h"
+#endif
+
 namespace WebCore {
 
 CachedCSSStyleSheet::CachedCSSStyleSheet(CachedResourceRequest&& request, PAL::SessionID sessionID, const CookieJar* cookieJar)
@@ -176,6 +180,16 @@ void CachedCSSStyleSheet::destroyDecodedData()
 
 RefPtr<StyleSheetContents> CachedCSSStyleSheet::restoreParsedStyleSheet(const CSSParserContext& context, CachePolicy cachePolicy, FrameLoader& loader)
 {
+#if PLATFORM(JAVA)
+    // Another page may have parsed the same bytes into a resource the memory cache has since replaced.
+    if (!m_parsedStyleSheetCache && m_data && canUseSheet(MIMETypeCheckHint::Strict, nullptr)) {
+        if (auto sheet = SharedResourceCacheJava::singleton().styleSheet(url(), *m_data, encoding(), context)) {
+            m_parsedStyleSheetCache = WTFMove(sheet);
+            m_parsedStyleSheetCache->addedToMemoryCache();
+            setDecodedSize(m_parsedStyleSheetCache->estimatedSizeInBytes());
+        }
+    }
+#endif
     if (!m_parsedStyleSheetCache)
         return nullptr;
     if (!m_parsedStyleSheetCache->subresourcesAllowReuse(cachePolicy, loader)) {
@@ -206,6 +220,11 @@ void CachedCSSStyleSheet::saveParsedStyleSheet(Ref<StyleSheetContents>&& sheet)
     m_parsedStyleSheetCache->addedToMemoryCache();
 
     setDecodedSize(m_parsedStyleSheetCache->estimatedSizeInBytes());
+
+#if PLATFORM(JAVA)
+    if (m_data)
+        SharedResourceCacheJava::singleton().addStyleSheet(url(), *m_data, encoding(), *m_parsedStyleSheetCache);
+#endif
 }
 
 }
@@ -34,6 +34,10 @@
 #include "SharedBuffer.h"
 #include "TextResourceDecoder.h"
 
+#if PLATFORM(JAVA)
+#include "SharedResourceCacheJava.h"
+#endif
+
 namespace WebCore {
 
 CachedScript::CachedScript(CachedResourceRequest&& request, PAL::SessionID sessionID, const CookieJar* cookieJar)
@@ -103,7 +107,12 @@ unsigned CachedScript::scriptHash()
 void CachedScript::finishLoading(const FragmentedSharedBuffer* data, const NetworkLoadMetrics& metrics)
 {
     if (data) {
+#if PLATFORM(JAVA)
+        // Pages loading the same script share its bytes.
+        m_data = SharedResourceCacheJava::singleton().scriptData(url(), data->makeContiguous());
+#else
         m_data = data->makeContiguous();
+#endif
         setEncodedSize(data->size());
     } else {
         m_data = nullptr;
@@ -124,6 +124,11 @@ public:
     void prune();
     void pruneSoon();
     unsigned size() const { return m_liveSize + m_deadSize; }
+    unsigned liveSize() const { return m_liveSize; }
+    unsigned deadSize() const { return m_deadSize; }
+    unsigned capacity() const { return m_capacity; }
+    unsigned minDeadCapacity() const { return m_minDeadCapacity; }
+    unsigned maxDeadCapacity() const { return m_maxDeadCapacity; }
 
     void setDeadDecodedDataDeletionInterval(Seconds interval) { m_deadDecodedDataDeletionInterval = interval; }
     Seconds deadDecodedDataDeletionInterval() const { return m_deadDecodedDataDeletionInterval; }
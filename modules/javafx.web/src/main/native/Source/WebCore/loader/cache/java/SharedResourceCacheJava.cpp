@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "SharedResourceCacheJava.h"
+
+#include "CSSParserContext.h"
+#include "StyleSheetContents.h"
+#include <wtf/MainThread.h>
+#include <wtf/SHA1.h>
+#include <wtf/URL.h>
+
+#include "com_sun_webkit_SharedResourceCache.h"
+
+namespace WebCore {
+
+static const char styleSheetType[] = "css";
+static const char scriptType[] = "script";
+
+SharedResourceCacheJava& SharedResourceCacheJava::singleton()
+{
+    static NeverDestroyed<SharedResourceCacheJava> sharedResourceCache;
+    return sharedResourceCache;
+}
+
+void SharedResourceCacheJava::setCapacity(uint64_t capacity)
+{
+    m_capacity = capacity;
+    shrink(m_capacity);
+}
+
+void SharedResourceCacheJava::clear()
+{
+    shrink(0);
+}
+
+String SharedResourceCacheJava::computeKey(const char* type, const URL& url, const FragmentedSharedBuffer& data, const String& encoding)
+{
+    SHA1 sha1;
+    data.forEachSegment([&](auto& segment) {
+        sha1.addBytes(segment.data(), segment.size());
+    });
+    // The same bytes decode to different text in another encoding.
+    sha1.addBytes(encoding.utf8());
+    SHA1::Digest digest;
+    sha1.computeHash(digest);
+    return makeString(type, ' ', SHA1::hexDigest(digest).data(), ' ', url.stringWithoutFragmentIdentifier());
+}
+
+RefPtr<StyleSheetContents> SharedResourceCacheJava::styleSheet(const URL& url, const FragmentedSharedBuffer& data, const String& encoding, const CSSParserContext& context)
+{
+    ASSERT(isMainThread());
+    if (!m_capacity || data.size() > m_capacity / maximumEntryCapacityFraction)
+        return nullptr;
+
+    String key = computeKey(styleSheetType, url, data, encoding);
+    auto it = m_entries.find(key);
+    // Contexts must be identical so we know we would get the same exact result if we parsed again.
+    if (it == m_entries.end() || it->value.styleSheet->parserContext() != context) {
+        m_statistics.misses++;
+        return nullptr;
+    }
+
+    m_statistics.hits++;
+    m_lruList.appendOrMoveToLast(key);
+    return it->value.styleSheet;
+}
+
+void SharedResourceCacheJava::addStyleSheet(const URL& url, const FragmentedSharedBuffer& data, const String& encoding, StyleSheetContents& sheet)
+{
+    ASSERT(isMainThread());
+    ASSERT(sheet.isCacheable());
+    if (!m_capacity || data.size() > m_capacity / maximumEntryCapacityFraction)
+        return;
+
+    uint64_t size = sheet.estimatedSizeInBytes();
+    if (size > m_capacity / maximumEntryCapacityFraction)
+        return;
+
+    // Like the memory cache, the cache counts as a user of the contents,
+    // so that CSSOM changes in any page copy them first.
+    sheet.addedToMemoryCache();
+    insert(computeKey(styleSheetType, url, data, encoding), { &sheet, nullptr, size });
+}
+
+Ref<SharedBuffer> SharedResourceCacheJava::scriptData(const URL& url, Ref<SharedBuffer>&& data)
+{
+    ASSERT(isMainThread());
+    if (!m_capacity || data->isEmpty() || data->size() > m_capacity / maximumEntryCapacityFraction)
+        return WTFMove(data);
+
+    String key = computeKey(scriptType, url, data.get(), { });
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+        m_statistics.hits++;
+        m_lruList.appendOrMoveToLast(key);
+        return *it->value.scriptData;
+    }
+
+    m_statistics.misses++;
+    uint64_t size = data->size();
+    insert(key, { nullptr, data.copyRef(), size });
+    return WTFMove(data);
+}
+
+void SharedResourceCacheJava::insert(const String& key, Entry&& entry)
+{
+    removeEntry(key);
+    (entry.styleSheet ? m_styleSheetSize : m_scriptSize) += entry.size;
+    m_entries.add(key, WTFMove(entry));
+    m_lruList.appendOrMoveToLast(key);
+    shrink(m_capacity);
+}
+
+void SharedResourceCacheJava::removeEntry(const String& key)
+{
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return;
+
+    auto entry = WTFMove(it->value);
+    m_entries.remove(it);
+    m_lruList.remove(key);
+    if (entry.styleSheet) {
+        m_styleSheetSize -= entry.size;
+        entry.styleSheet->removedFromMemoryCache();
+    } else
+        m_scriptSize -= entry.size;
+}
+
+void SharedResourceCacheJava::shrink(uint64_t targetSize)
+{
+    while (size() > targetSize && !m_lruList.isEmpty()) {
+        String key = m_lruList.first();
+        removeEntry(key);
+    }
+}
+
+} // namespace WebCore
+
+using namespace WebCore;
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_SharedResourceCache_twkSetCapacity
+  (JNIEnv*, jclass, jlong capacity)
+{
+    ASSERT(isMainThread());
+    ASSERT(capacity >= 0);
+    SharedResourceCacheJava::singleton().setCapacity(capacity);
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_SharedResourceCache_twkGetCapacity
+  (JNIEnv*, jclass)
+{
+    return SharedResourceCacheJava::singleton().capacity();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_SharedResourceCache_twkClear
+  (JNIEnv*, jclass)
+{
+    ASSERT(isMainThread());
+    SharedResourceCacheJava::singleton().clear();
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_SharedResourceCache_twkGetStyleSheetSize
+  (JNIEnv*, jclass)
+{
+    return SharedResourceCacheJava::singleton().styleSheetSize();
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_SharedResourceCache_twkGetScriptSize
+  (JNIEnv*, jclass)
+{
+    return SharedResourceCacheJava::singleton().scriptSize();
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_SharedResourceCache_twkGetHitCount
+  (JNIEnv*, jclass)
+{
+    return SharedResourceCacheJava::singleton().statistics().hits;
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_SharedResourceCache_twkGetMissCount
+  (JNIEnv*, jclass)
+{
+    return SharedResourceCacheJava::singleton().statistics().misses;
+}
+
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include "SharedBuffer.h"
+#include <wtf/Forward.h>
+#include <wtf/HashMap.h>
+#include <wtf/ListHashSet.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/text/StringHash.h>
+
+namespace WebCore {
+
+class CSSParserContext;
+class StyleSheetContents;
+
+// Keeps parsed stylesheets and script source bytes for all pages of the
+// process, keyed by URL and content hash, so that pages loading the same
+// resource share one copy even when the memory cache reloads it. Script
+// sources share their bytes; the compiled code is then shared by the code
+// cache of the common VM, which is keyed by the source text. Entries over
+// the capacity are evicted, least recently used first.
+class SharedResourceCacheJava {
+    WTF_MAKE_NONCOPYABLE(SharedResourceCacheJava); WTF_MAKE_FAST_ALLOCATED;
+    friend NeverDestroyed<SharedResourceCacheJava>;
+public:
+    static SharedResourceCacheJava& singleton();
+
+    struct Statistics {
+        uint64_t hits { 0 };
+        uint64_t misses { 0 };
+    };
+
+    static constexpr uint64_t defaultCapacity = 32 * 1024 * 1024;
+
+    // A capacity of 0 disables the cache.
+    void setCapacity(uint64_t);
+    uint64_t capacity() const { return m_capacity; }
+    uint64_t size() const { return m_styleSheetSize + m_scriptSize; }
+    uint64_t styleSheetSize() const { return m_styleSheetSize; }
+    uint64_t scriptSize() const { return m_scriptSize; }
+    const Statistics& statistics() const { return m_statistics; }
+    void clear();
+
+    // Returns the contents parsed from the same bytes at the URL by another
+    // resource, if they were parsed in the same context.
+    RefPtr<StyleSheetContents> styleSheet(const URL&, const FragmentedSharedBuffer&, const String& encoding, const CSSParserContext&);
+    void addStyleSheet(const URL&, const FragmentedSharedBuffer&, const String& encoding, StyleSheetContents&);
+
+    // Returns a buffer with the same bytes loaded earlier from the URL, or
+    // the given buffer, which is kept for later loads.
+    Ref<SharedBuffer> scriptData(const URL&, Ref<SharedBuffer>&&);
+
+private:
+    struct Entry {
+        RefPtr<StyleSheetContents> styleSheet;
+        RefPtr<SharedBuffer> scriptData;
+        uint64_t size { 0 };
+    };
+
+    // No single entry may take more than this share of the capacity.
+    static constexpr uint64_t maximumEntryCapacityFraction = 8;
+
+    SharedResourceCacheJava() = default;
+
+    static String computeKey(const char* type, const URL&, const FragmentedSharedBuffer&, const String& encoding);
+    void insert(const String& key, Entry&&);
+    void removeEntry(const String& key);
+    void shrink(uint64_t targetSize);
+
+    uint64_t m_capacity { defaultCapacity };
+    uint64_t m_styleSheetSize { 0 };
+    uint64_t m_scriptSize { 0 };
+    HashMap<String, Entry> m_entries;
+    // Keys in order of use, least recently used first.
+    ListHashSet<String> m_lruList;
+    Statistics m_statistics;
+};
+
+} // namespace WebCore
@@ -39,6 +39,15 @@ if ($option eq "ColorData") {
     my $gperf = $ENV{GPERF} ? $ENV{GPERF} : ($customGperf ? $customGperf : "gperf");
     system("\"$gperf\" --key-positions=\"*\" -D -s 2 $colorDataGperf --output-file=$colorDataGenerated") == 0 || die "calling gperf failed: $?";
 
+} elsif ($option eq "MIMETypeExtensionData") {
+    my $mimeTypeExtensionDataGenerated = "$outdir/MIMETypeExtensionData.cpp";
+    my $mimeTypeExtensionDataGperf     = shift;
+    my $customGperf                    = shift;
+
+    $mimeTypeExtensionDataGperf =~ s/\\/\//g;
+    my $gperf = $ENV{GPERF} ? $ENV{GPERF} : ($customGperf ? $customGperf : "gperf");
+    system("\"$gperf\" --key-positions=\"*\" -D -s 2 $mimeTypeExtensionDataGperf --output-file=$mimeTypeExtensionDataGenerated") == 0 || die "calling gperf failed: $?";
+
 } else {
     die "Unknown option.";
 }
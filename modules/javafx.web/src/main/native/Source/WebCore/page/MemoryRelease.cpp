@@ -64,6 +64,10 @@
 #include <wtf/spi/darwin/OSVariantSPI.h>
 #endif
 
+#if PLATFORM(JAVA)
+#include "SharedResourceCacheJava.h"
+#endif
+
 namespace WebCore {
 
 static void releaseNoncriticalMemory(MaintainMemoryCache maintainMemoryCache)
@@ -85,8 +89,12 @@ static void releaseNoncriticalMemory(MaintainMemoryCache maintainMemoryCache)
 #endif
     }
 
-    if (maintainMemoryCache == MaintainMemoryCache::No)
+    if (maintainMemoryCache == MaintainMemoryCache::No) {
         MemoryCache::singleton().pruneDeadResourcesToSize(0);
+#if PLATFORM(JAVA)
+        SharedResourceCacheJava::singleton().clear();
+#endif
+    }
 
     InlineStyleSheetOwner::clearCache();
     HTMLNameCache::clear();
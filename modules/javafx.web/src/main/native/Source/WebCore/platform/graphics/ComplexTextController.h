@@ -49,6 +49,9 @@ namespace WebCore {
 class FontCascade;
 class Font;
 class TextRun;
+#if USE(HARFBUZZ_SHAPING)
+class HarfBuzzFontJava;
+#endif
 
 enum GlyphIterationStyle { IncludePartialGlyphs, ByWholeGlyphs };
 
@@ -160,6 +163,9 @@ private:
     void collectComplexTextRuns();
 
     void collectComplexTextRunsForCharacters(const UChar*, unsigned length, unsigned stringLocation, const Font*);
+#if USE(HARFBUZZ_SHAPING)
+    void collectComplexTextRunsWithHarfBuzz(HarfBuzzFontJava&, const UChar*, unsigned length, unsigned stringLocation, const Font&);
+#endif
     void adjustGlyphsAndAdvances();
 
     unsigned indexOfCurrentRun(unsigned& leftmostGlyph);
@@ -49,6 +49,8 @@
 #endif
 
 #if PLATFORM(JAVA)
+#include "GlyphMetricsTableJava.h"
+#include "HarfBuzzFontJava.h"
 #include "PlatformJavaClasses.h"
 #include "RQRef.h"
 #endif
@@ -195,6 +197,10 @@ public:
 
 #if PLATFORM(JAVA)
     RefPtr<RQRef> nativeFontData() const { return m_jFont; }
+    GlyphMetricsTableJava* glyphMetrics() const { return m_glyphMetrics.get(); }
+#if USE(HARFBUZZ_SHAPING)
+    HarfBuzzFontJava* harfBuzzFont() const { return m_harfBuzzFont.get(); }
+#endif
 #endif
 
     unsigned hash() const;
@@ -281,6 +287,10 @@ private:
 
 #if PLATFORM(JAVA)
     RefPtr<RQRef> m_jFont;
+    RefPtr<GlyphMetricsTableJava> m_glyphMetrics;
+#if USE(HARFBUZZ_SHAPING)
+    RefPtr<HarfBuzzFontJava> m_harfBuzzFont;
+#endif
 #endif
 
     float m_size { 0 };
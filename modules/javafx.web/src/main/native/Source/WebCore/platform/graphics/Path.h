@@ -46,8 +46,8 @@ typedef struct CGPath PlatformPath;
 
 #elif PLATFORM(JAVA)
 #include <wtf/RefPtr.h>
-#include "RQRef.h"
-typedef RefPtr<WebCore::RQRef> PlatformPath;
+#include "PathJava.h"
+typedef WebCore::PathJava PlatformPath;
 
 #else
 
@@ -57,7 +57,7 @@ typedef void PlatformPath;
 
 #if !USE(CAIRO)
 #if PLATFORM(JAVA)
-typedef RefPtr<WebCore::RQRef> PlatformPathPtr;
+typedef RefPtr<WebCore::PathJava> PlatformPathPtr;
 #else
 typedef PlatformPath* PlatformPathPtr;
 #endif
@@ -250,6 +250,10 @@ private:
     void swap(Path&);
 #endif
 
+#if PLATFORM(JAVA)
+    PathJava& mutablePath();
+#endif
+
 #if USE(CAIRO)
     cairo_t* ensureCairoPath();
     void appendElement(PathElement::Type, Vector<FloatPoint, 3>&&);
@@ -31,6 +31,12 @@
 
 #include "PlatformJavaClasses.h"
 
+#if USE(HARFBUZZ_SHAPING)
+#include "HarfBuzzFontJava.h"
+#include "SurrogatePairAwareTextIterator.h"
+#include <hb.h>
+#endif
+
 namespace WebCore {
 
 namespace {
@@ -152,6 +158,62 @@ FloatSize jGetInitialAdvance(JLObject jRun)
     return jGetGlyphPosAndAdvance(jRun, 0).location() - FloatPoint();
 }
 
+#if USE(HARFBUZZ_SHAPING)
+
+struct ScriptRun {
+    unsigned startIndex;
+    unsigned endIndex;
+    hb_script_t script;
+};
+
+std::optional<ScriptRun> findNextScriptRun(const UChar* characters, unsigned length, unsigned offset)
+{
+    hb_unicode_funcs_t* unicodeFunctions = hb_unicode_funcs_get_default();
+    SurrogatePairAwareTextIterator textIterator(characters + offset, offset, length, length);
+    UChar32 character;
+    unsigned clusterLength = 0;
+    if (!textIterator.consume(character, clusterLength))
+        return std::nullopt;
+
+    hb_script_t currentScript = hb_unicode_script(unicodeFunctions, character);
+    unsigned startIndex = offset;
+    for (textIterator.advance(clusterLength); textIterator.consume(character, clusterLength); textIterator.advance(clusterLength)) {
+        if (FontCascade::treatAsZeroWidthSpace(character))
+            continue;
+
+        // Common and inherited characters take the script of the text
+        // around them, see http://www.unicode.org/reports/tr24/#Common.
+        hb_script_t nextScript = hb_unicode_script(unicodeFunctions, character);
+        if (nextScript == HB_SCRIPT_INHERITED || nextScript == HB_SCRIPT_COMMON)
+            continue;
+        if (currentScript == HB_SCRIPT_INHERITED || currentScript == HB_SCRIPT_COMMON) {
+            currentScript = nextScript;
+            continue;
+        }
+        if (currentScript != nextScript)
+            return ScriptRun { startIndex, textIterator.currentIndex(), currentScript };
+    }
+
+    return ScriptRun { startIndex, textIterator.currentIndex(), currentScript };
+}
+
+// Glyphs of a composite Java font carry the index of the fallback font in
+// their high bits. HarfBuzz only sees the primary font, so text that falls
+// back to another one is left to the Java text layout.
+bool usesOnlyPrimaryFont(const Font& font, const UChar* characters, unsigned length)
+{
+    SurrogatePairAwareTextIterator textIterator(characters, 0, length, length);
+    UChar32 character;
+    unsigned clusterLength = 0;
+    for (; textIterator.consume(character, clusterLength); textIterator.advance(clusterLength)) {
+        if (static_cast<unsigned>(font.glyphForCharacter(character)) >> 24)
+            return false;
+    }
+    return true;
+}
+
+#endif // USE(HARFBUZZ_SHAPING)
+
 }
 
 ComplexTextController::ComplexTextRun::ComplexTextRun(JLObject jRun, const Font& font, const UChar* characters, unsigned stringLocation, unsigned stringLength)
@@ -205,6 +267,14 @@ void ComplexTextController::collectComplexTextRunsForCharacters(const UChar* cha
         return;
     }
 
+#if USE(HARFBUZZ_SHAPING)
+    auto* harfBuzzFont = font->platformData().harfBuzzFont();
+    if (harfBuzzFont && harfBuzzFont->isUsable() && usesOnlyPrimaryFont(*font, characters, length)) {
+        collectComplexTextRunsWithHarfBuzz(*harfBuzzFont, characters, length, stringLocation, *font);
+        return;
+    }
+#endif
+
     JNIEnv* env = WTF::GetJavaEnv();
     static jmethodID getTextRuns_mID = env->GetMethodID(
         PG_GetFontClass(env),
@@ -230,4 +300,59 @@ void ComplexTextController::collectComplexTextRunsForCharacters(const UChar* cha
     }
 }
 
+#if USE(HARFBUZZ_SHAPING)
+
+void ComplexTextController::collectComplexTextRunsWithHarfBuzz(HarfBuzzFontJava& harfBuzzFont, const UChar* characters, unsigned length, unsigned stringLocation, const Font& font)
+{
+    Vector<ScriptRun> scriptRuns;
+    for (unsigned offset = 0; offset < length; ) {
+        auto run = findNextScriptRun(characters, length, offset);
+        if (!run)
+            break;
+        scriptRuns.append(*run);
+        offset = run->endIndex;
+    }
+
+    hb_direction_t direction = HB_DIRECTION_INVALID;
+    if (!m_mayUseNaturalWritingDirection || m_run.directionalOverride())
+        direction = m_run.rtl() ? HB_DIRECTION_RTL : HB_DIRECTION_LTR;
+
+    Vector<RefPtr<ComplexTextRun>, 16> wordRuns;
+    for (unsigned i = 0; i < scriptRuns.size(); ++i) {
+        auto& scriptRun = scriptRuns[m_run.rtl() ? scriptRuns.size() - i - 1 : i];
+
+        // Each word, with the spaces that follow it, is shaped on its own so
+        // that the result can be cached and reused wherever the word recurs.
+        for (unsigned wordStart = scriptRun.startIndex; wordStart < scriptRun.endIndex; ) {
+            unsigned wordEnd = wordStart;
+            while (wordEnd < scriptRun.endIndex && characters[wordEnd] != ' ')
+                ++wordEnd;
+            while (wordEnd < scriptRun.endIndex && characters[wordEnd] == ' ')
+                ++wordEnd;
+
+            auto& word = harfBuzzFont.shape(characters + wordStart, wordEnd - wordStart, scriptRun.script, direction);
+
+            Vector<FloatSize> advances = word.advances;
+            Vector<unsigned> indices;
+            indices.reserveInitialCapacity(word.glyphs.size());
+            for (unsigned glyphIndex = 0; glyphIndex < word.glyphs.size(); ++glyphIndex) {
+                indices.uncheckedAppend(wordStart + word.clusters[glyphIndex]);
+                if (font.isZeroWidthSpaceGlyph(word.glyphs[glyphIndex]))
+                    advances[glyphIndex] = { };
+            }
+            FloatSize initialAdvance = word.origins.isEmpty() ? FloatSize { } : toFloatSize(word.origins[0]);
+            wordRuns.append(ComplexTextRun::create(advances, word.origins, word.glyphs, indices, initialAdvance, font, characters, stringLocation, length, wordStart, wordEnd, word.isLTR));
+            wordStart = wordEnd;
+        }
+
+        // Order the words of the run the same way as the runs themselves.
+        if (m_run.rtl())
+            wordRuns.reverse();
+        m_complexTextRuns.appendVector(WTFMove(wordRuns));
+        wordRuns.clear();
+    }
+}
+
+#endif // USE(HARFBUZZ_SHAPING)
+
 }  // namespace WebCore
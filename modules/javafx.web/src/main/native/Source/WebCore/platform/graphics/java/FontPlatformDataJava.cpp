@@ -60,6 +60,10 @@ RefPtr<RQRef> getJavaFont(const String& family, float size, bool italic, bool bo
 
 FontPlatformData::FontPlatformData(RefPtr<RQRef> font, float size)
     : m_jFont(font)
+    , m_glyphMetrics(font ? RefPtr<GlyphMetricsTableJava> { GlyphMetricsTableJava::create(font) } : nullptr)
+#if USE(HARFBUZZ_SHAPING)
+    , m_harfBuzzFont(font ? RefPtr<HarfBuzzFontJava> { HarfBuzzFontJava::create(font, size) } : nullptr)
+#endif
     , m_size(size)
 {
 }
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "GlyphMetricsTableJava.h"
+
+#include "PlatformJavaClasses.h"
+
+namespace WebCore {
+
+namespace {
+
+// Pages are only filled on the main thread, so one buffer serves all fonts.
+// It is large enough for a page of bounding boxes, four floats per glyph.
+jfloat metricsBuffer[256 * 4];
+
+jobject metricsByteBuffer(JNIEnv* env)
+{
+    static JGObject byteBuffer(env->NewDirectByteBuffer(metricsBuffer, sizeof(metricsBuffer)));
+    return byteBuffer;
+}
+
+bool fetchMetrics(const RQRef& font, const char* methodName, jmethodID& mid, unsigned firstGlyph, unsigned count)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    jobject byteBuffer = metricsByteBuffer(env);
+    if (!byteBuffer)
+        return false;
+
+    if (!mid) {
+        mid = env->GetMethodID(PG_GetFontClass(env), methodName, "(IILjava/nio/ByteBuffer;)V");
+        ASSERT(mid);
+    }
+
+    env->CallVoidMethod(font, mid, static_cast<jint>(firstGlyph), static_cast<jint>(count), byteBuffer);
+    return !WTF::CheckAndClearException(env);
+}
+
+}
+
+auto GlyphMetricsTableJava::page(Glyph glyph) -> Page&
+{
+    unsigned pageNumber = static_cast<unsigned>(glyph) / pageSize;
+    auto result = m_pages.add(pageNumber, nullptr);
+    if (result.isNewEntry) {
+        result.iterator->value = makeUnique<Page>();
+        static jmethodID getGlyphAdvances_mID;
+        if (m_font && fetchMetrics(*m_font, "getGlyphAdvances", getGlyphAdvances_mID, pageNumber * pageSize, pageSize))
+            std::copy_n(metricsBuffer, pageSize, result.iterator->value->advances.begin());
+    }
+    return *result.iterator->value;
+}
+
+float GlyphMetricsTableJava::advance(Glyph glyph)
+{
+    return page(glyph).advances[static_cast<unsigned>(glyph) % pageSize];
+}
+
+FloatRect GlyphMetricsTableJava::bounds(Glyph glyph)
+{
+    auto& glyphPage = page(glyph);
+    if (!glyphPage.bounds) {
+        glyphPage.bounds = makeUnique<std::array<FloatRect, pageSize>>();
+        unsigned firstGlyph = static_cast<unsigned>(glyph) / pageSize * pageSize;
+        static jmethodID getGlyphBoundingBoxes_mID;
+        if (m_font && fetchMetrics(*m_font, "getGlyphBoundingBoxes", getGlyphBoundingBoxes_mID, firstGlyph, pageSize)) {
+            const jfloat* values = metricsBuffer;
+            for (auto& rect : *glyphPage.bounds) {
+                rect = { values[0], values[1], values[2], values[3] };
+                values += 4;
+            }
+        }
+    }
+    return (*glyphPage.bounds)[static_cast<unsigned>(glyph) % pageSize];
+}
+
+} // namespace WebCore
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include "FloatRect.h"
+#include "Glyph.h"
+#include "RQRef.h"
+#include <array>
+#include <wtf/HashMap.h>
+#include <wtf/RefCounted.h>
+
+namespace WebCore {
+
+// Advances and bounding boxes of the glyphs of one com.sun.webkit.graphics.WCFont.
+// Metrics are fetched from Java a page at a time through a direct buffer, so
+// measuring text costs one JNI call per 256 glyphs instead of one per glyph.
+// Bounding boxes need the glyph outlines and are only fetched for pages whose
+// bounds have been asked for. FontPlatformData owns the table, which makes it
+// shared by every Font made from the same Java font.
+class GlyphMetricsTableJava : public RefCounted<GlyphMetricsTableJava> {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static Ref<GlyphMetricsTableJava> create(RefPtr<RQRef> font) { return adoptRef(*new GlyphMetricsTableJava(WTFMove(font))); }
+
+    float advance(Glyph);
+    FloatRect bounds(Glyph);
+
+private:
+    explicit GlyphMetricsTableJava(RefPtr<RQRef> font)
+        : m_font(WTFMove(font))
+    {
+    }
+
+    static constexpr unsigned pageSize = 256;
+
+    struct Page {
+        WTF_MAKE_STRUCT_FAST_ALLOCATED;
+        std::array<float, pageSize> advances { };
+        std::unique_ptr<std::array<FloatRect, pageSize>> bounds;
+    };
+
+    Page& page(Glyph);
+
+    RefPtr<RQRef> m_font;
+    // Glyphs of composite fonts carry the slot in their high bits, so the
+    // page numbers are sparse.
+    HashMap<unsigned, std::unique_ptr<Page>, IntHash<unsigned>, WTF::UnsignedWithZeroKeyHashTraits<unsigned>> m_pages;
+};
+
+} // namespace WebCore
@@ -39,23 +39,21 @@ bool GlyphPage::fill(UChar* buffer, unsigned bufferLength)
     if (!jFont)
         return false;
 
-    JLocalRef<jcharArray> jchars(env->NewCharArray(bufferLength));
+    // Pages are filled on the main thread only, so the arrays passed to
+    // Java are allocated once and reused for every page of every font.
+    static JGlobalRef<jcharArray> jchars(env->NewCharArray(2 * GlyphPage::size));
+    static JGlobalRef<jintArray> jglyphs(env->NewIntArray(2 * GlyphPage::size));
     WTF::CheckAndClearException(env); // OOME
-    ASSERT(jchars);
-    if (!jchars)
+    ASSERT(jchars && jglyphs);
+    if (!jchars || !jglyphs || bufferLength > 2 * GlyphPage::size)
         return false;
 
-    jchar* chars = (jchar*)env->GetPrimitiveArrayCritical(jchars, NULL);
-    ASSERT(chars);
-    memcpy(chars, buffer, bufferLength * 2);
-    env->ReleasePrimitiveArrayCritical(jchars, chars, 0);
+    env->SetCharArrayRegion(jchars, 0, bufferLength, reinterpret_cast<const jchar*>(buffer));
 
-    static jmethodID mid = env->GetMethodID(PG_GetFontClass(env), "getGlyphCodes", "([C)[I");
+    static jmethodID mid = env->GetMethodID(PG_GetFontClass(env), "getGlyphCodes", "([CI[I)V");
     ASSERT(mid);
-    JLocalRef<jintArray> jglyphs(static_cast<jintArray>(env->CallObjectMethod(*jFont, mid, (jcharArray)jchars)));
-    WTF::CheckAndClearException(env);
-    ASSERT(jglyphs);
-    if (!jglyphs)
+    env->CallVoidMethod(*jFont, mid, (jcharArray)jchars, (jint)bufferLength, (jintArray)jglyphs);
+    if (WTF::CheckAndClearException(env))
         return false;
 
     Glyph* glyphs = (Glyph*)env->GetPrimitiveArrayCritical(jglyphs, NULL);
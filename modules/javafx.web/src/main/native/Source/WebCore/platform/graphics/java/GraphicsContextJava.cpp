@@ -66,7 +66,7 @@ namespace WebCore {
 static void setGradient(Gradient &gradient,
     AffineTransform& gradientSpaceTransformation, PlatformGraphicsContext* context, jint id)
 {
-    const Vector<GradientColorStop, 2> stops = gradient.stops().stops();
+    const auto& stops = gradient.stops().stops();
     int nStops = stops.size();
 
     FloatPoint p0, p1;
@@ -140,6 +140,12 @@ GraphicsContextJava::GraphicsContextJava(PlatformGraphicsContext* context) // TO
     m_platformContext = context;
 }
 
+GraphicsContextJava::GraphicsContextJava(PlatformGraphicsContext& context)
+    : m_platformContext(&context)
+    , m_ownsPlatformContext(false)
+{
+}
+
 PlatformGraphicsContext* GraphicsContextJava::platformContext() const
 {
     return m_platformContext;
@@ -147,7 +153,8 @@ PlatformGraphicsContext* GraphicsContextJava::platformContext() const
 
 GraphicsContextJava::~GraphicsContextJava()
 {
-    delete m_platformContext;
+    if (m_ownsPlatformContext)
+        delete m_platformContext;
 }
 
 void GraphicsContextJava::save() {
@@ -305,7 +312,7 @@ void GraphicsContextJava::drawFocusRing(const Vector<FloatRect>& rects, float, f
     // "flatten" it, but it can only be done with Area classes which are not
     // available here. That's why a simple algorithm here: unite all the
     // intersecting rects, while leaving standalone rects as is.
-    Vector<IntRect> toDraw;
+    Vector<IntRect, 8> toDraw;
     for (unsigned i = 0; i < rectCount; i++) {
         IntRect focusRect = enclosingIntRect(rects[i]);
         focusRect.inflate(offset);
@@ -748,7 +755,7 @@ void GraphicsContextJava::strokePath(const Path& path)
 
     platformContext()->rq().freeSpace(12)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_STROKE_PATH
-    << copyPath(path.platformPath())
+    << javaPath(path)
     << (jint)fillRule();
 }
 
@@ -765,7 +772,7 @@ static void setClipPath(
     state.clipBounds.intersect(state.transform.mapRect(path.fastBoundingRect()));
     gc.platformContext()->rq().freeSpace(16)
     << jint(com_sun_webkit_graphics_GraphicsDecoder_CLIP_PATH)
-    << copyPath(path.platformPath())
+    << javaPath(path)
     << jint(wrule == WindRule::EvenOdd
        ? com_sun_webkit_graphics_WCPath_RULE_EVENODD
        : com_sun_webkit_graphics_WCPath_RULE_NONZERO)
@@ -891,7 +898,7 @@ void GraphicsContextJava::fillPath(const Path& path)
 
         platformContext()->rq().freeSpace(12)
         << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILL_PATH
-        << copyPath(path.platformPath())
+        << javaPath(path)
         << (jint)fillRule();
     }
 }
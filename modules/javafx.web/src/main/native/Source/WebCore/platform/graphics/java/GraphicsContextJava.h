@@ -74,6 +74,9 @@ class WEBCORE_EXPORT GraphicsContextJava final : public GraphicsContext {
 
 public:
     GraphicsContextJava(PlatformGraphicsContext* context);
+    // Paints through a platform context that outlives this one and is
+    // reused, see PlatformContextJava::reset().
+    GraphicsContextJava(PlatformGraphicsContext& context);
     virtual ~GraphicsContextJava();
 
     bool hasPlatformContext() const override { return true; }
@@ -146,6 +149,7 @@ public:
     void setURLForRect(const URL&, const FloatRect&) override;
 
     PlatformGraphicsContext* m_platformContext;
+    bool m_ownsPlatformContext { true };
 
     void didUpdateState(const GraphicsContextState&, GraphicsContextState::StateChangeFlags) override;
     void fillRoundedRectImpl(const FloatRoundedRect&, const Color&) override;
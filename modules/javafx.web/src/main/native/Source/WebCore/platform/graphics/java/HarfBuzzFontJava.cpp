@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "HarfBuzzFontJava.h"
+
+#if USE(HARFBUZZ_SHAPING)
+
+#include "PlatformJavaClasses.h"
+#include <hb.h>
+
+namespace WebCore {
+
+namespace {
+
+// Longer words are shaped every time rather than cached.
+constexpr unsigned maxCachedWordLength = 64;
+// The cache is dropped as a whole once it holds this many words.
+constexpr unsigned maxCachedWordCount = 2048;
+
+inline float harfBuzzPositionToFloat(hb_position_t value)
+{
+    return static_cast<float>(value) / (1 << 16);
+}
+
+inline hb_position_t floatToHarfBuzzPosition(float value)
+{
+    return static_cast<hb_position_t>(value * (1 << 16));
+}
+
+hb_blob_t* referenceTable(hb_face_t*, hb_tag_t tag, void* userData)
+{
+    // Tag 0 asks for the whole font file, which the Java font does not expose.
+    if (!tag)
+        return nullptr;
+
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID getFontTable_mID = env->GetMethodID(PG_GetFontClass(env),
+        "getFontTable", "(I)[B");
+    ASSERT(getFontTable_mID);
+
+    const RQRef& font = *static_cast<const RQRef*>(userData);
+    JLocalRef<jbyteArray> jtable(static_cast<jbyteArray>(env->CallObjectMethod(font, getFontTable_mID, static_cast<jint>(tag))));
+    if (WTF::CheckAndClearException(env) || !jtable)
+        return nullptr;
+
+    jsize length = env->GetArrayLength(jtable);
+    if (!length)
+        return nullptr;
+
+    char* data = static_cast<char*>(fastMalloc(length));
+    env->GetByteArrayRegion(jtable, 0, length, reinterpret_cast<jbyte*>(data));
+    return hb_blob_create(data, length, HB_MEMORY_MODE_WRITABLE, data, fastFree);
+}
+
+}
+
+HarfBuzzFontJava::~HarfBuzzFontJava()
+{
+    if (m_hbFont)
+        hb_font_destroy(m_hbFont);
+    if (m_face)
+        hb_face_destroy(m_face);
+}
+
+void HarfBuzzFontJava::createFont()
+{
+    m_didCreateFont = true;
+    if (!m_font)
+        return;
+
+    // The face does not own the RQRef; this object outlives the face.
+    m_face = hb_face_create_for_tables(referenceTable, m_font.get(), nullptr);
+    if (!hb_face_get_glyph_count(m_face))
+        return;
+
+    m_hbFont = hb_font_create(m_face);
+    if (floorf(m_size) == m_size)
+        hb_font_set_ppem(m_hbFont, m_size, m_size);
+    int scale = floatToHarfBuzzPosition(m_size);
+    hb_font_set_scale(m_hbFont, scale, scale);
+    hb_font_make_immutable(m_hbFont);
+}
+
+bool HarfBuzzFontJava::isUsable()
+{
+    if (!m_didCreateFont)
+        createFont();
+    return m_hbFont;
+}
+
+auto HarfBuzzFontJava::shape(const UChar* characters, unsigned length, uint32_t script, uint32_t direction) -> const ShapedWord&
+{
+    ASSERT(isUsable());
+
+    if (length > maxCachedWordLength) {
+        shape(m_uncachedWord, characters, length, script, direction);
+        return m_uncachedWord;
+    }
+
+    if (m_wordCache.size() >= maxCachedWordCount)
+        m_wordCache.clear();
+
+    auto result = m_wordCache.add(WordCacheKey { String(characters, length), (static_cast<uint64_t>(script) << 8) | direction }, ShapedWord { });
+    if (result.isNewEntry)
+        shape(result.iterator->value, characters, length, script, direction);
+    return result.iterator->value;
+}
+
+void HarfBuzzFontJava::shape(ShapedWord& word, const UChar* characters, unsigned length, uint32_t script, uint32_t direction)
+{
+    hb_buffer_t* buffer = hb_buffer_create();
+    hb_buffer_add_utf16(buffer, reinterpret_cast<const uint16_t*>(characters), length, 0, length);
+    hb_buffer_set_script(buffer, static_cast<hb_script_t>(script));
+    if (direction != HB_DIRECTION_INVALID)
+        hb_buffer_set_direction(buffer, static_cast<hb_direction_t>(direction));
+    hb_buffer_guess_segment_properties(buffer);
+    hb_shape(m_hbFont, buffer, nullptr, 0);
+
+    unsigned glyphCount = hb_buffer_get_length(buffer);
+    hb_glyph_info_t* glyphInfos = hb_buffer_get_glyph_infos(buffer, nullptr);
+    hb_glyph_position_t* glyphPositions = hb_buffer_get_glyph_positions(buffer, nullptr);
+
+    word.glyphs.resize(glyphCount);
+    word.clusters.resize(glyphCount);
+    word.advances.resize(glyphCount);
+    word.origins.resize(glyphCount);
+    word.isLTR = HB_DIRECTION_IS_FORWARD(hb_buffer_get_direction(buffer));
+
+    // HarfBuzz returns the shaping result in visual order.
+    for (unsigned i = 0; i < glyphCount; ++i) {
+        word.glyphs[i] = glyphInfos[i].codepoint;
+        word.clusters[i] = glyphInfos[i].cluster;
+        word.advances[i] = { harfBuzzPositionToFloat(glyphPositions[i].x_advance), harfBuzzPositionToFloat(glyphPositions[i].y_advance) };
+        word.origins[i] = { harfBuzzPositionToFloat(glyphPositions[i].x_offset), harfBuzzPositionToFloat(glyphPositions[i].y_offset) };
+    }
+
+    hb_buffer_destroy(buffer);
+}
+
+} // namespace WebCore
+
+#endif // USE(HARFBUZZ_SHAPING)
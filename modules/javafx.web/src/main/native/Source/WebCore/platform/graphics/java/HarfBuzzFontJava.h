@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#if USE(HARFBUZZ_SHAPING)
+
+#include "FloatPoint.h"
+#include "Glyph.h"
+#include "RQRef.h"
+#include <wtf/HashMap.h>
+#include <wtf/RefCounted.h>
+#include <wtf/Vector.h>
+#include <wtf/text/StringHash.h>
+
+typedef struct hb_face_t hb_face_t;
+typedef struct hb_font_t hb_font_t;
+
+namespace WebCore {
+
+// Shapes text natively with HarfBuzz for one com.sun.webkit.graphics.WCFont.
+// The face reads its OpenType tables from the Java font on demand through a
+// blob callback, so the font file is never opened twice. Shaped words are
+// cached, which makes relayout of the same text cost no JNI calls at all.
+class HarfBuzzFontJava : public RefCounted<HarfBuzzFontJava> {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static Ref<HarfBuzzFontJava> create(RefPtr<RQRef> font, float size) { return adoptRef(*new HarfBuzzFontJava(WTFMove(font), size)); }
+    ~HarfBuzzFontJava();
+
+    struct ShapedWord {
+        Vector<Glyph> glyphs;
+        // Indices of the source characters, relative to the start of the word.
+        Vector<unsigned> clusters;
+        Vector<FloatSize> advances;
+        Vector<FloatPoint> origins;
+        bool isLTR { true };
+    };
+
+    // Returns false if the Java font has no OpenType tables to shape with.
+    bool isUsable();
+
+    // script is an hb_script_t and direction an hb_direction_t, where
+    // HB_DIRECTION_INVALID lets HarfBuzz guess the direction from the text.
+    const ShapedWord& shape(const UChar* characters, unsigned length, uint32_t script, uint32_t direction);
+
+private:
+    HarfBuzzFontJava(RefPtr<RQRef> font, float size)
+        : m_font(WTFMove(font))
+        , m_size(size)
+    {
+    }
+
+    void createFont();
+    void shape(ShapedWord&, const UChar* characters, unsigned length, uint32_t script, uint32_t direction);
+
+    RefPtr<RQRef> m_font;
+    float m_size;
+    hb_face_t* m_face { nullptr };
+    hb_font_t* m_hbFont { nullptr };
+    bool m_didCreateFont { false };
+
+    using WordCacheKey = std::pair<String, uint64_t>;
+    HashMap<WordCacheKey, ShapedWord> m_wordCache;
+    // Scratch result for text too long to be worth caching.
+    ShapedWord m_uncachedWord;
+};
+
+} // namespace WebCore
+
+#endif // USE(HARFBUZZ_SHAPING)
@@ -108,11 +108,18 @@ JLObject ImageBufferJavaBackend::getWCImage() const
 
 void *ImageBufferJavaBackend::getData() const
 {
+    if (m_pixels && m_pixelsAreCurrent)
+        return m_pixels;
+
+    // Pixels written since the last upload exist only in the buffer that
+    // is about to be overwritten.
+    ASSERT(m_dirtyRect.isEmpty());
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     //RenderQueue need to be processed before pixel buffer extraction.
     //For that purpose it has to be in actual state.
-    context().platformContext()->rq().flushBuffer();
+    m_context->platformContext()->rq().flushBuffer();
 
     static jmethodID midGetBGRABytes = env->GetMethodID(
         PG_GetImageClass(env),
@@ -126,25 +133,36 @@ void *ImageBufferJavaBackend::getData() const
     }
     JLObject byteBuffer(pixelBuf);
 
-    return env->GetDirectBufferAddress(byteBuffer);
+    m_pixels = env->GetDirectBufferAddress(byteBuffer);
+    m_pixelsAreCurrent = true;
+    return m_pixels;
 }
 
-void ImageBufferJavaBackend::update() const
+void ImageBufferJavaBackend::uploadDirtyPixels() const
 {
+    if (m_dirtyRect.isEmpty())
+        return;
+
     JNIEnv* env = WTF::GetJavaEnv();
 
-    static jmethodID midUpdateByteBuffer = env->GetMethodID(
+    static jmethodID midDrawPixelBuffer = env->GetMethodID(
         PG_GetImageClass(env),
         "drawPixelBuffer",
-        "()V");
-    ASSERT(midUpdateByteBuffer);
+        "(IIII)V");
+    ASSERT(midDrawPixelBuffer);
 
-    env->CallObjectMethod(getWCImage(), midUpdateByteBuffer);
+    env->CallVoidMethod(getWCImage(), midDrawPixelBuffer,
+        m_dirtyRect.x(), m_dirtyRect.y(), m_dirtyRect.width(), m_dirtyRect.height());
     WTF::CheckAndClearException(env);
+    m_dirtyRect = { };
 }
 
 GraphicsContext& ImageBufferJavaBackend::context() const
 {
+    // The caller may draw into the image, so pending pixels have to reach
+    // it first and the resident copy has to be read back before next use.
+    uploadDirtyPixels();
+    m_pixelsAreCurrent = false;
     return *m_context;
 }
 
@@ -159,11 +177,13 @@ IntSize ImageBufferJavaBackend::backendSize() const
 
 RefPtr<NativeImage> ImageBufferJavaBackend::copyNativeImage(BackingStoreCopy) const
 {
+    uploadDirtyPixels();
     return NativeImage::create((m_image.get()));
 }
 
 RefPtr<Image> ImageBufferJavaBackend::copyImage(BackingStoreCopy, PreserveResolution) const
 {
+    uploadDirtyPixels();
     return BufferImage::create(m_image);
 }
 
@@ -187,7 +207,8 @@ String ImageBufferJavaBackend::toDataURL(const String& mimeType, std::optional<d
     if (MIMETypeRegistry::isSupportedImageMIMETypeForEncoding(mimeType)) {
         // RenderQueue need to be processed before pixel buffer extraction.
         // For that purpose it has to be in actual state.
-        context().platformContext()->rq().flushBuffer();
+        uploadDirtyPixels();
+        m_context->platformContext()->rq().flushBuffer();
 
         JNIEnv* env = WTF::GetJavaEnv();
 
@@ -214,7 +235,8 @@ Vector<uint8_t> ImageBufferJavaBackend::toData(const String& mimeType, std::opti
     if (MIMETypeRegistry::isSupportedImageMIMETypeForEncoding(mimeType)) {
         // RenderQueue need to be processed before pixel buffer extraction.
         // For that purpose it has to be in actual state.
-        context().platformContext()->rq().flushBuffer();
+        uploadDirtyPixels();
+        m_context->platformContext()->rq().flushBuffer();
 
         JNIEnv* env = WTF::GetJavaEnv();
 
@@ -257,7 +279,6 @@ void ImageBufferJavaBackend::putPixelBuffer(const PixelBuffer& sourcePixelBuffer
         return;
 
     putPixelBuffer(sourcePixelBuffer, srcRect, dstPoint, destFormat, data);
-    update();
 }
 
 std::optional<PixelBuffer> ImageBufferJavaBackend::getPixelBuffer(const PixelBufferFormat& outputFormat, const IntRect& srcRect, void* data) const
@@ -269,7 +290,17 @@ void ImageBufferJavaBackend::putPixelBuffer(const PixelBuffer& sourcePixelBuffer
     const IntRect& srcRect, const IntPoint& dstPoint, AlphaPremultiplication destFormat, void* data)
 {
     ImageBufferBackend::putPixelBuffer(sourcePixelBuffer, srcRect, dstPoint, destFormat, data);
-    update();
+
+    // The same destination rectangle as ImageBufferBackend::putPixelBuffer.
+    auto srcRectScaled = toBackendCoordinates(srcRect);
+    auto destinationRect = intersection({ IntPoint::zero(), sourcePixelBuffer.size() }, srcRectScaled);
+    destinationRect.moveBy(toBackendCoordinates(dstPoint));
+    if (srcRectScaled.x() < 0)
+        destinationRect.setX(destinationRect.x() - srcRectScaled.x());
+    if (srcRectScaled.y() < 0)
+        destinationRect.setY(destinationRect.y() - srcRectScaled.y());
+    destinationRect.intersect(backendRect());
+    m_dirtyRect.unite(destinationRect);
 }
 
 size_t ImageBufferJavaBackend::calculateMemoryCost(const Parameters& parameters)
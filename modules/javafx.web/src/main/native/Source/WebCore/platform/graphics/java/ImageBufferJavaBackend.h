@@ -45,7 +45,7 @@ public:
 
     JLObject getWCImage() const;
     void* getData() const;
-    void update() const;
+    void uploadDirtyPixels() const;
 
     GraphicsContext& context() const override;
     void flushContext() override;
@@ -79,6 +79,15 @@ protected:
     PlatformImagePtr m_image;
     std::unique_ptr<GraphicsContext> m_context;
     IntSize m_backendSize;
+
+    // The pixels of the image stay resident in the direct buffer of the
+    // Java image. They only need to be read back once something may have
+    // drawn into the image, and pixels written by putPixelBuffer are only
+    // uploaded, as the union of the changed rectangles, before the image is
+    // drawn into or painted.
+    mutable void* m_pixels { nullptr };
+    mutable bool m_pixelsAreCurrent { false };
+    mutable IntRect m_dirtyRect;
 };
 
 } // namespace WebCore
@@ -26,16 +26,16 @@
 #include "config.h"
 
 #include "Path.h"
+#include "AffineTransform.h"
 #include "FloatRect.h"
 #include "PlatformContextJava.h"
 #include "PlatformJavaClasses.h"
-#include "NotImplemented.h"
 #include "GraphicsContextJava.h"
 #include "RQRef.h"
 #include "GraphicsContext.h"
 #include "ImageBuffer.h"
 
-#include <wtf/text/WTFString.h>
+#include <wtf/MathExtras.h>
 #include <wtf/java/JavaRef.h>
 
 #include "com_sun_webkit_graphics_WCPathIterator.h"
@@ -43,6 +43,16 @@
 
 namespace WebCore {
 
+static_assert(PathJava::MoveTo == com_sun_webkit_graphics_WCPathIterator_SEG_MOVETO, "Verbs must match WCPathIterator");
+static_assert(PathJava::LineTo == com_sun_webkit_graphics_WCPathIterator_SEG_LINETO, "Verbs must match WCPathIterator");
+static_assert(PathJava::QuadTo == com_sun_webkit_graphics_WCPathIterator_SEG_QUADTO, "Verbs must match WCPathIterator");
+static_assert(PathJava::CubicTo == com_sun_webkit_graphics_WCPathIterator_SEG_CUBICTO, "Verbs must match WCPathIterator");
+static_assert(PathJava::Close == com_sun_webkit_graphics_WCPathIterator_SEG_CLOSE, "Verbs must match WCPathIterator");
+
+// Curves are flattened to within this distance for hit-testing.
+static constexpr float flatteningTolerance = 0.25f;
+static constexpr unsigned maxFlatteningSegments = 128;
+
 static GraphicsContext& scratchContext()
 {
     static auto img = ImageBuffer::create(FloatSize(1.f, 1.f), RenderingMode::Unaccelerated, 1, DestinationColorSpace::SRGB(), PixelFormat::BGRA8);
@@ -50,36 +60,558 @@ static GraphicsContext& scratchContext()
     return context;
 }
 
-RefPtr<RQRef> createEmptyPath()
+static FloatPoint quadPoint(const FloatPoint& p0, const FloatPoint& p1, const FloatPoint& p2, float t)
 {
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mid = env->GetMethodID(PG_GetGraphicsManagerClass(env),
-        "createWCPath", "()Lcom/sun/webkit/graphics/WCPath;");
-    ASSERT(mid);
+    float mt = 1 - t;
+    return FloatPoint(
+        mt * mt * p0.x() + 2 * mt * t * p1.x() + t * t * p2.x(),
+        mt * mt * p0.y() + 2 * mt * t * p1.y() + t * t * p2.y());
+}
 
-    JLObject ref(env->CallObjectMethod(PL_GetGraphicsManager(env), mid));
-    ASSERT(ref);
-    WTF::CheckAndClearException(env);
-    return RQRef::create(ref);
+static FloatPoint cubicPoint(const FloatPoint& p0, const FloatPoint& p1, const FloatPoint& p2, const FloatPoint& p3, float t)
+{
+    float mt = 1 - t;
+    float a = mt * mt * mt;
+    float b = 3 * mt * mt * t;
+    float c = 3 * mt * t * t;
+    float d = t * t * t;
+    return FloatPoint(
+        a * p0.x() + b * p1.x() + c * p2.x() + d * p3.x(),
+        a * p0.y() + b * p1.y() + c * p2.y() + d * p3.y());
+}
+
+// Wang's formula: the number of line segments needed to keep a Bezier curve
+// of the given degree within flatteningTolerance of its flattened form.
+static unsigned flatteningSegmentCount(float maxSecondDifference, unsigned degree)
+{
+    float n = std::sqrt(degree * (degree - 1) * maxSecondDifference / (8 * flatteningTolerance));
+    if (!(n > 1))
+        return 1;
+    return std::min(static_cast<unsigned>(std::ceil(n)), maxFlatteningSegments);
+}
+
+static float secondDifference(const FloatPoint& p0, const FloatPoint& p1, const FloatPoint& p2)
+{
+    return std::hypot(p0.x() - 2 * p1.x() + p2.x(), p0.y() - 2 * p1.y() + p2.y());
 }
 
-RefPtr<RQRef> copyPath(RefPtr<RQRef> p)
+PathJava::PathJava(const PathJava& other)
+    : RefCounted<PathJava>()
+    , m_verbs(other.m_verbs)
+    , m_coords(other.m_coords)
+    , m_currentPoint(other.m_currentPoint)
+    , m_subpathStart(other.m_subpathStart)
+    , m_fastBoundingRect(other.m_fastBoundingRect)
+    , m_boundingRect(other.m_boundingRect)
+    , m_javaPath(other.m_javaPath)
 {
-    if (!p) {
-        return createEmptyPath();
+}
+
+void PathJava::didChange()
+{
+    m_fastBoundingRect = std::nullopt;
+    m_boundingRect = std::nullopt;
+    m_javaPath = nullptr;
+}
+
+void PathJava::clear()
+{
+    m_verbs.clear();
+    m_coords.clear();
+    m_currentPoint = { };
+    m_subpathStart = { };
+    didChange();
+}
+
+void PathJava::appendPoint(const FloatPoint& p)
+{
+    m_coords.append(p.x());
+    m_coords.append(p.y());
+}
+
+void PathJava::moveTo(const FloatPoint& p)
+{
+    if (!m_verbs.isEmpty() && m_verbs.last() == MoveTo) {
+        // Like Path2D, collapse consecutive moves.
+        m_coords[m_coords.size() - 2] = p.x();
+        m_coords[m_coords.size() - 1] = p.y();
+    } else {
+        m_verbs.append(MoveTo);
+        appendPoint(p);
     }
+    m_currentPoint = p;
+    m_subpathStart = p;
+    didChange();
+}
+
+void PathJava::ensureCurrentPoint(const FloatPoint& p)
+{
+    if (m_verbs.isEmpty())
+        moveTo(p);
+}
+
+void PathJava::lineTo(const FloatPoint& p)
+{
+    ensureCurrentPoint(p);
+    m_verbs.append(LineTo);
+    appendPoint(p);
+    m_currentPoint = p;
+    didChange();
+}
+
+void PathJava::quadTo(const FloatPoint& cp, const FloatPoint& p)
+{
+    ensureCurrentPoint(cp);
+    m_verbs.append(QuadTo);
+    appendPoint(cp);
+    appendPoint(p);
+    m_currentPoint = p;
+    didChange();
+}
+
+void PathJava::cubicTo(const FloatPoint& cp1, const FloatPoint& cp2, const FloatPoint& p)
+{
+    ensureCurrentPoint(cp1);
+    m_verbs.append(CubicTo);
+    appendPoint(cp1);
+    appendPoint(cp2);
+    appendPoint(p);
+    m_currentPoint = p;
+    didChange();
+}
+
+void PathJava::close()
+{
+    if (m_verbs.isEmpty() || m_verbs.last() == Close)
+        return;
+    m_verbs.append(Close);
+    m_currentPoint = m_subpathStart;
+    didChange();
+}
+
+void PathJava::appendArcSegments(const FloatPoint& center, float radiusX, float radiusY, float rotation, float startAngle, float sweep)
+{
+    float cosRotation = std::cos(rotation);
+    float sinRotation = std::sin(rotation);
+    auto pointAt = [&](float angle) {
+        float x = radiusX * std::cos(angle);
+        float y = radiusY * std::sin(angle);
+        return FloatPoint(center.x() + x * cosRotation - y * sinRotation, center.y() + x * sinRotation + y * cosRotation);
+    };
+    auto tangentAt = [&](float angle, float scale) {
+        float x = -radiusX * std::sin(angle) * scale;
+        float y = radiusY * std::cos(angle) * scale;
+        return FloatSize(x * cosRotation - y * sinRotation, x * sinRotation + y * cosRotation);
+    };
+
+    // Connect to the start of the arc the way Path2D.append(arc, true) does.
+    FloatPoint start = pointAt(startAngle);
+    if (m_verbs.isEmpty())
+        moveTo(start);
+    else if (m_verbs.last() == Close || m_currentPoint != start)
+        lineTo(start);
+
+    // One cubic per quarter turn is within 0.03% of the true arc.
+    unsigned segments = std::max(1.0f, std::ceil(std::abs(sweep) / piOverTwoFloat - 0.001f));
+    float delta = sweep / segments;
+    float k = 4.0f / 3 * std::tan(delta / 4);
+    float angle = startAngle;
+    FloatPoint from = start;
+    for (unsigned i = 0; i < segments; ++i) {
+        float nextAngle = i == segments - 1 ? startAngle + sweep : angle + delta;
+        FloatPoint to = pointAt(nextAngle);
+        cubicTo(from + tangentAt(angle, k), to - tangentAt(nextAngle, k), to);
+        angle = nextAngle;
+        from = to;
+    }
+}
+
+void PathJava::addArc(const FloatPoint& center, float radiusX, float radiusY, float rotation, float startAngle, float endAngle, bool anticlockwise)
+{
+    // Same normalization as WCPathImpl.addArc used to do; the canvas code has
+    // already clamped full turns.
+    constexpr float twoPi = 2 * piFloat;
+    float sweep = endAngle - startAngle;
+    if (!anticlockwise && startAngle > endAngle)
+        sweep = twoPi - std::fmod(startAngle - endAngle, twoPi);
+    else if (anticlockwise && startAngle < endAngle)
+        sweep = -(twoPi - std::fmod(endAngle - startAngle, twoPi));
+    sweep = std::clamp(sweep, -twoPi, twoPi);
+
+    appendArcSegments(center, radiusX, radiusY, rotation, startAngle, sweep);
+}
+
+void PathJava::addArcTo(const FloatPoint& p1, const FloatPoint& p2, float radius)
+{
+    ensureCurrentPoint(p1);
+    FloatPoint p0 = m_currentPoint;
+    if (!radius || p0 == p1 || p1 == p2) {
+        lineTo(p1);
+        return;
+    }
+
+    FloatSize v1 = p0 - p1;
+    FloatSize v2 = p2 - p1;
+    double length1 = std::hypot(v1.width(), v1.height());
+    double length2 = std::hypot(v2.width(), v2.height());
+    double cosPhi = (v1.width() * v2.width() + v1.height() * v2.height()) / (length1 * length2);
+    if (std::abs(cosPhi) >= 1 - 1e-6) {
+        // The three points are collinear.
+        lineTo(p1);
+        return;
+    }
+
+    double tangentLength = radius / std::tan(std::acos(cosPhi) / 2);
+    FloatPoint t1 = p1 + v1.scaled(tangentLength / length1);
+    FloatPoint t2 = p1 + v2.scaled(tangentLength / length2);
+
+    FloatSize bisector = v1.scaled(1 / length1) + v2.scaled(1 / length2);
+    double bisectorLength = std::hypot(bisector.width(), bisector.height());
+    FloatPoint center = p1 + bisector.scaled(std::hypot(tangentLength, radius) / bisectorLength);
+
+    float startAngle = std::atan2(t1.y() - center.y(), t1.x() - center.x());
+    float endAngle = std::atan2(t2.y() - center.y(), t2.x() - center.x());
+    bool anticlockwise = v1.width() * v2.height() - v1.height() * v2.width() > 0;
+    addArc(center, radius, radius, 0, startAngle, endAngle, anticlockwise);
+}
+
+void PathJava::addRect(const FloatRect& r)
+{
+    moveTo(r.location());
+    lineTo(FloatPoint(r.maxX(), r.y()));
+    lineTo(FloatPoint(r.maxX(), r.maxY()));
+    lineTo(FloatPoint(r.x(), r.maxY()));
+    close();
+}
+
+void PathJava::addEllipse(const FloatRect& r)
+{
+    FloatPoint center = r.center();
+    float radiusX = r.width() / 2;
+    float radiusY = r.height() / 2;
+    moveTo(FloatPoint(center.x() + radiusX, center.y()));
+    appendArcSegments(center, radiusX, radiusY, 0, 0, 2 * piFloat);
+    close();
+}
+
+void PathJava::addPath(const PathJava& other, const AffineTransform& transform)
+{
+    ASSERT(&other != this);
+
+    size_t c = 0;
+    auto point = [&] {
+        FloatPoint p = transform.mapPoint(FloatPoint(other.m_coords[c], other.m_coords[c + 1]));
+        c += 2;
+        return p;
+    };
+    for (auto verb : other.m_verbs) {
+        switch (verb) {
+        case MoveTo:
+            moveTo(point());
+            break;
+        case LineTo:
+            lineTo(point());
+            break;
+        case QuadTo: {
+            FloatPoint cp = point();
+            quadTo(cp, point());
+            break;
+        }
+        case CubicTo: {
+            FloatPoint cp1 = point();
+            FloatPoint cp2 = point();
+            cubicTo(cp1, cp2, point());
+            break;
+        }
+        case Close:
+            close();
+            break;
+        }
+    }
+}
+
+void PathJava::transform(const AffineTransform& transform)
+{
+    for (size_t i = 0; i + 1 < m_coords.size(); i += 2) {
+        FloatPoint p = transform.mapPoint(FloatPoint(m_coords[i], m_coords[i + 1]));
+        m_coords[i] = p.x();
+        m_coords[i + 1] = p.y();
+    }
+    m_currentPoint = transform.mapPoint(m_currentPoint);
+    m_subpathStart = transform.mapPoint(m_subpathStart);
+    didChange();
+}
+
+FloatRect PathJava::fastBoundingRect() const
+{
+    if (m_fastBoundingRect)
+        return *m_fastBoundingRect;
+
+    if (m_coords.isEmpty())
+        return *(m_fastBoundingRect = FloatRect());
+
+    float minX = m_coords[0], maxX = m_coords[0];
+    float minY = m_coords[1], maxY = m_coords[1];
+    for (size_t i = 2; i + 1 < m_coords.size(); i += 2) {
+        minX = std::min(minX, m_coords[i]);
+        maxX = std::max(maxX, m_coords[i]);
+        minY = std::min(minY, m_coords[i + 1]);
+        maxY = std::max(maxY, m_coords[i + 1]);
+    }
+    return *(m_fastBoundingRect = FloatRect(minX, minY, maxX - minX, maxY - minY));
+}
+
+FloatRect PathJava::boundingRect() const
+{
+    if (m_boundingRect)
+        return *m_boundingRect;
+
+    if (m_coords.isEmpty())
+        return *(m_boundingRect = FloatRect());
+
+    float minX = m_coords[0], maxX = m_coords[0];
+    float minY = m_coords[1], maxY = m_coords[1];
+    auto include = [&](const FloatPoint& p) {
+        minX = std::min(minX, p.x());
+        maxX = std::max(maxX, p.x());
+        minY = std::min(minY, p.y());
+        maxY = std::max(maxY, p.y());
+    };
+    auto includeIfInside = [&](float t, const auto& curvePoint) {
+        if (t > 0 && t < 1)
+            include(curvePoint(t));
+    };
+
+    // End points bound lines; curves also need their extrema, where the
+    // derivative along an axis vanishes.
+    FloatPoint current;
+    FloatPoint subpathStart;
+    size_t c = 0;
+    auto point = [&] {
+        FloatPoint p(m_coords[c], m_coords[c + 1]);
+        c += 2;
+        return p;
+    };
+    for (auto verb : m_verbs) {
+        switch (verb) {
+        case MoveTo:
+            current = subpathStart = point();
+            include(current);
+            break;
+        case LineTo:
+            current = point();
+            include(current);
+            break;
+        case QuadTo: {
+            FloatPoint p1 = point();
+            FloatPoint p2 = point();
+            auto curvePoint = [&](float t) { return quadPoint(current, p1, p2, t); };
+            float denominatorX = current.x() - 2 * p1.x() + p2.x();
+            if (denominatorX)
+                includeIfInside((current.x() - p1.x()) / denominatorX, curvePoint);
+            float denominatorY = current.y() - 2 * p1.y() + p2.y();
+            if (denominatorY)
+                includeIfInside((current.y() - p1.y()) / denominatorY, curvePoint);
+            include(p2);
+            current = p2;
+            break;
+        }
+        case CubicTo: {
+            FloatPoint p1 = point();
+            FloatPoint p2 = point();
+            FloatPoint p3 = point();
+            auto curvePoint = [&](float t) { return cubicPoint(current, p1, p2, p3, t); };
+            auto solve = [&](float c0, float c1, float c2, float c3) {
+                // B'(t) / 3 = a2 t^2 + a1 t + a0
+                float a2 = c3 - 3 * c2 + 3 * c1 - c0;
+                float a1 = 2 * (c2 - 2 * c1 + c0);
+                float a0 = c1 - c0;
+                if (std::abs(a2) < 1e-6f) {
+                    if (a1)
+                        includeIfInside(-a0 / a1, curvePoint);
+                    return;
+                }
+                float discriminant = a1 * a1 - 4 * a2 * a0;
+                if (discriminant < 0)
+                    return;
+                float root = std::sqrt(discriminant);
+                includeIfInside((-a1 + root) / (2 * a2), curvePoint);
+                includeIfInside((-a1 - root) / (2 * a2), curvePoint);
+            };
+            solve(current.x(), p1.x(), p2.x(), p3.x());
+            solve(current.y(), p1.y(), p2.y(), p3.y());
+            include(p3);
+            current = p3;
+            break;
+        }
+        case Close:
+            current = subpathStart;
+            break;
+        }
+    }
+    return *(m_boundingRect = FloatRect(minX, minY, maxX - minX, maxY - minY));
+}
+
+// Calls the functor for every edge of the flattened path, including the
+// edges that implicitly close each subpath for filling.
+template<typename Functor>
+void PathJava::forEachEdge(const Functor& functor) const
+{
+    FloatPoint current;
+    FloatPoint subpathStart;
+    size_t c = 0;
+    auto point = [&] {
+        FloatPoint p(m_coords[c], m_coords[c + 1]);
+        c += 2;
+        return p;
+    };
+    auto closeSubpath = [&] {
+        if (current != subpathStart)
+            functor(current, subpathStart);
+        current = subpathStart;
+    };
+
+    for (auto verb : m_verbs) {
+        switch (verb) {
+        case MoveTo:
+            closeSubpath();
+            current = subpathStart = point();
+            break;
+        case LineTo: {
+            FloatPoint p = point();
+            functor(current, p);
+            current = p;
+            break;
+        }
+        case QuadTo: {
+            FloatPoint p1 = point();
+            FloatPoint p2 = point();
+            unsigned n = flatteningSegmentCount(secondDifference(current, p1, p2), 2);
+            FloatPoint from = current;
+            for (unsigned i = 1; i < n; ++i) {
+                FloatPoint to = quadPoint(current, p1, p2, static_cast<float>(i) / n);
+                functor(from, to);
+                from = to;
+            }
+            functor(from, p2);
+            current = p2;
+            break;
+        }
+        case CubicTo: {
+            FloatPoint p1 = point();
+            FloatPoint p2 = point();
+            FloatPoint p3 = point();
+            float difference = std::max(secondDifference(current, p1, p2), secondDifference(p1, p2, p3));
+            unsigned n = flatteningSegmentCount(difference, 3);
+            FloatPoint from = current;
+            for (unsigned i = 1; i < n; ++i) {
+                FloatPoint to = cubicPoint(current, p1, p2, p3, static_cast<float>(i) / n);
+                functor(from, to);
+                from = to;
+            }
+            functor(from, p3);
+            current = p3;
+            break;
+        }
+        case Close:
+            closeSubpath();
+            break;
+        }
+    }
+    closeSubpath();
+}
+
+bool PathJava::contains(const FloatPoint& p, WindRule rule) const
+{
+    if (m_verbs.isEmpty())
+        return false;
+
+    FloatRect bounds = fastBoundingRect();
+    if (p.x() < bounds.x() || p.x() > bounds.maxX() || p.y() < bounds.y() || p.y() > bounds.maxY())
+        return false;
+
+    // Winding number of the flattened path around p.
+    int winding = 0;
+    forEachEdge([&](const FloatPoint& a, const FloatPoint& b) {
+        float side = (b.x() - a.x()) * (p.y() - a.y()) - (p.x() - a.x()) * (b.y() - a.y());
+        if (a.y() <= p.y()) {
+            if (b.y() > p.y() && side > 0)
+                ++winding;
+        } else if (b.y() <= p.y() && side < 0)
+            --winding;
+    });
+
+    return rule == WindRule::EvenOdd ? winding & 1 : winding;
+}
+
+void PathJava::apply(const PathApplierFunction& function) const
+{
+    PathElement element;
+    size_t c = 0;
+    auto point = [&] {
+        FloatPoint p(m_coords[c], m_coords[c + 1]);
+        c += 2;
+        return p;
+    };
+    for (auto verb : m_verbs) {
+        switch (verb) {
+        case MoveTo:
+            element.type = PathElement::Type::MoveToPoint;
+            element.points[0] = point();
+            break;
+        case LineTo:
+            element.type = PathElement::Type::AddLineToPoint;
+            element.points[0] = point();
+            break;
+        case QuadTo:
+            element.type = PathElement::Type::AddQuadCurveToPoint;
+            element.points[0] = point();
+            element.points[1] = point();
+            break;
+        case CubicTo:
+            element.type = PathElement::Type::AddCurveToPoint;
+            element.points[0] = point();
+            element.points[1] = point();
+            element.points[2] = point();
+            break;
+        case Close:
+            element.type = PathElement::Type::CloseSubpath;
+            break;
+        }
+        function(element);
+    }
+}
+
+RefPtr<RQRef> PathJava::javaPath() const
+{
+    if (m_javaPath)
+        return m_javaPath;
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(PG_GetGraphicsManagerClass(env),
-        "createWCPath",
-        "(Lcom/sun/webkit/graphics/WCPath;)Lcom/sun/webkit/graphics/WCPath;");
+        "createWCPath", "([BI[FI)Lcom/sun/webkit/graphics/WCPath;");
     ASSERT(mid);
 
-    JLObject ref(env->CallObjectMethod(PL_GetGraphicsManager(env), mid, (jobject)*p));
+    JLocalRef<jbyteArray> verbs(env->NewByteArray(m_verbs.size()));
+    env->SetByteArrayRegion(verbs, 0, m_verbs.size(), reinterpret_cast<const jbyte*>(m_verbs.data()));
+    JLocalRef<jfloatArray> coords(env->NewFloatArray(m_coords.size()));
+    env->SetFloatArrayRegion(coords, 0, m_coords.size(), m_coords.data());
+
+    JLObject ref(env->CallObjectMethod(PL_GetGraphicsManager(env), mid,
+        (jbyteArray)verbs, (jint)m_verbs.size(), (jfloatArray)coords, (jint)m_coords.size()));
     ASSERT(ref);
     WTF::CheckAndClearException(env);
 
-    return RQRef::create(ref);
+    m_javaPath = RQRef::create(ref);
+    return m_javaPath;
+}
+
+RefPtr<RQRef> javaPath(const Path& path)
+{
+    if (auto platformPath = path.platformPath())
+        return platformPath->javaPath();
+    return PathJava::create()->javaPath();
 }
 
 bool Path::isNull() const
@@ -88,27 +620,22 @@ bool Path::isNull() const
 }
 
 Path::Path()
-    : m_path(createEmptyPath())
 {}
 
 Path::Path(const Path& p)
-    : m_path(copyPath(p.platformPath()))
+    : m_path(p.m_path)
 {}
 
 Path::~Path()
 {}
 
 Path::Path(Path&& other)
-{
-    m_path = other.m_path;
-    other.m_path = nullptr;
-}
+    : m_path(WTFMove(other.m_path))
+{}
 
 Path& Path::operator=(const Path &p)
 {
-    if (this != &p) {
-        m_path = copyPath(p.platformPath());
-    }
+    m_path = p.m_path;
     return *this;
 }
 
@@ -117,374 +644,174 @@ Path& Path::operator=(Path&& other)
     if (this == &other)
         return *this;
 
-    m_path = other.m_path;
-    other.m_path = nullptr;
+    m_path = WTFMove(other.m_path);
     return *this;
 }
 
-bool Path::contains(const FloatPoint& p, WindRule rule) const
+PathJava& Path::mutablePath()
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "contains",
-        "(IDD)Z");
-    ASSERT(mid);
+    // Copies share their PathJava until one of them changes.
+    if (!m_path)
+        m_path = PathJava::create();
+    else if (!m_path->hasOneRef())
+        m_path = m_path->copy();
+    return *m_path;
+}
 
-    jboolean res = env->CallBooleanMethod(*m_path, mid, (jint)rule,
-        (jdouble)p.x(), (jdouble)p.y());
-    WTF::CheckAndClearException(env);
+PlatformPathPtr Path::ensurePlatformPath()
+{
+    if (!m_path)
+        m_path = PathJava::create();
+    return m_path;
+}
 
-    return jbool_to_bool(res);
+bool Path::contains(const FloatPoint& p, WindRule rule) const
+{
+    return m_path && m_path->contains(p, rule);
 }
 
 FloatRect Path::boundingRectSlowCase() const
 {
-    return strokeBoundingRect(nullptr);
+    return m_path->boundingRect();
 }
 
 FloatRect Path::fastBoundingRectSlowCase() const
 {
-    return boundingRect();
+    return m_path->fastBoundingRect();
 }
 
 FloatRect Path::strokeBoundingRect(const Function<void(GraphicsContext&)>& strokeStyleApplier) const
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "getBounds",
-            "()Lcom/sun/webkit/graphics/WCRectangle;");
-    ASSERT(mid);
-
-    JLObject rect(env->CallObjectMethod(*m_path, mid));
-    WTF::CheckAndClearException(env);
-    if (rect) {
-        static jfieldID rectxFID = env->GetFieldID(PG_GetRectangleClass(env), "x", "F");
-        ASSERT(rectxFID);
-        static jfieldID rectyFID = env->GetFieldID(PG_GetRectangleClass(env), "y", "F");
-        ASSERT(rectyFID);
-        static jfieldID rectwFID = env->GetFieldID(PG_GetRectangleClass(env), "w", "F");
-        ASSERT(rectwFID);
-        static jfieldID recthFID = env->GetFieldID(PG_GetRectangleClass(env), "h", "F");
-        ASSERT(recthFID);
-
-        FloatRect bounds(
-            float(env->GetFloatField(rect, rectxFID)),
-            float(env->GetFloatField(rect, rectyFID)),
-            float(env->GetFloatField(rect, rectwFID)),
-            float(env->GetFloatField(rect, recthFID)));
-        WTF::CheckAndClearException(env);
-
-        float thickness;
-        if (strokeStyleApplier) {
-            GraphicsContext& gc = scratchContext();
-            gc.save();
-            strokeStyleApplier(gc);
-            thickness = gc.strokeThickness();
-            gc.restore();
-            bounds.inflate(thickness / 2);
-        }
-        return bounds;
-    } else {
-        return FloatRect();
+    FloatRect bounds = boundingRect();
+    if (strokeStyleApplier) {
+        GraphicsContext& gc = scratchContext();
+        gc.save();
+        strokeStyleApplier(gc);
+        float thickness = gc.strokeThickness();
+        gc.restore();
+        bounds.inflate(thickness / 2);
     }
+    return bounds;
 }
 
 void Path::clear()
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "clear", "()V");
-    ASSERT(mid);
+    if (!m_path)
+        return;
 
-    env->CallVoidMethod(*m_path, mid);
-    WTF::CheckAndClearException(env);
+    if (m_path->hasOneRef())
+        m_path->clear();
+    else
+        m_path = nullptr;
 }
 
 bool Path::isEmptySlowCase() const
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-                                            "isEmpty", "()Z");
-    ASSERT(mid);
-
-    jboolean res = env->CallBooleanMethod(*m_path, mid);
-    WTF::CheckAndClearException(env);
-
-    return jbool_to_bool(res);
+    return m_path->isEmpty();
 }
 
 FloatPoint Path::currentPointSlowCase() const
 {
-    //utatodo: return current point of subpath.
-    float quietNaN = std::numeric_limits<float>::quiet_NaN();
-    return FloatPoint(quietNaN, quietNaN);
+    return m_path->currentPoint();
 }
 
 void Path::moveToSlowCase(const FloatPoint &p)
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "moveTo",
-        "(DD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid, (jdouble)p.x(), (jdouble)p.y());
-    WTF::CheckAndClearException(env);
+    mutablePath().moveTo(p);
 }
 
 void Path::addLineToSlowCase(const FloatPoint &p)
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addLineTo",
-        "(DD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid, (jdouble)p.x(), (jdouble)p.y());
-    WTF::CheckAndClearException(env);
+    mutablePath().lineTo(p);
 }
 
 void Path::addQuadCurveToSlowCase(const FloatPoint &cp, const FloatPoint &p)
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addQuadCurveTo",
-                                            "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid, (jdouble)cp.x(), (jdouble)cp.y(), (jdouble)p.x(), (jdouble)p.y());
-    WTF::CheckAndClearException(env);
+    mutablePath().quadTo(cp, p);
 }
 
 void Path::addBezierCurveToSlowCase(const FloatPoint & controlPoint1,
                             const FloatPoint & controlPoint2,
                             const FloatPoint & controlPoint3)
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "addBezierCurveTo", "(DDDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid,
-                        (jdouble)controlPoint1.x(), (jdouble)controlPoint1.y(),
-                        (jdouble)controlPoint2.x(), (jdouble)controlPoint2.y(),
-                        (jdouble)controlPoint3.x(), (jdouble)controlPoint3.y());
-    WTF::CheckAndClearException(env);
+    mutablePath().cubicTo(controlPoint1, controlPoint2, controlPoint3);
 }
 
 void Path::addArcTo(const FloatPoint & p1, const FloatPoint & p2, float radius)
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArcTo",
-        "(DDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid,
-                        (jdouble)p1.x(), (jdouble)p1.y(),
-                        (jdouble)p2.x(), (jdouble)p2.y(), (jdouble)radius);
-    WTF::CheckAndClearException(env);
+    mutablePath().addArcTo(p1, p2, radius);
 }
 
 void Path::closeSubpath()
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "closeSubpath", "()V");
-    ASSERT(mid);
+    if (isNull())
+        return;
 
-    env->CallVoidMethod(*m_path, mid);
-    WTF::CheckAndClearException(env);
+    mutablePath().close();
 }
 
 void Path::addArcSlowCase(const FloatPoint & p, float radius, float startAngle,
-                  float endAngle, bool clockwise)
+                  float endAngle, bool anticlockwise)
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArc",
-        "(DDDDDZ)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid, (jdouble)p.x(), (jdouble)p.y(),
-        (jdouble)radius, (jdouble)startAngle, (jdouble)endAngle,
-        bool_to_jbool(clockwise));
-    WTF::CheckAndClearException(env);
+    mutablePath().addArc(p, radius, radius, 0, startAngle, endAngle, anticlockwise);
 }
 
 void Path::addRect(const FloatRect& r)
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addRect",
-        "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid, (jdouble)r.x(), (jdouble)r.y(),
-                              (jdouble)r.width(), (jdouble)r.height());
-    WTF::CheckAndClearException(env);
+    mutablePath().addRect(r);
 }
 
-void Path::addEllipse(FloatPoint, float, float, float, float, float, bool)
+void Path::addEllipse(FloatPoint center, float radiusX, float radiusY, float rotation, float startAngle, float endAngle, bool anticlockwise)
 {
-    notImplemented();
+    mutablePath().addArc(center, radiusX, radiusY, rotation, startAngle, endAngle, anticlockwise);
 }
 
-void Path::addPath(const Path&, const AffineTransform&)
+void Path::addPath(const Path& path, const AffineTransform& transform)
 {
-    notImplemented();
+    if (path.isEmpty())
+        return;
+
+    // Hold on to the other path, so that appending a path to itself
+    // appends to a copy.
+    Ref<PathJava> other(*path.m_path);
+    mutablePath().addPath(other, transform);
 }
 
 void Path::addEllipse(const FloatRect& r)
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addEllipse",
-        "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid,
-                        (jdouble)r.x(), (jdouble)r.y(),
-                        (jdouble)r.width(), (jdouble)r.height());
-    WTF::CheckAndClearException(env);
+    mutablePath().addEllipse(r);
 }
 
 void Path::translate(const FloatSize &sz)
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "translate",
-        "(DD)V");
-    ASSERT(mid);
+    if (isNull())
+        return;
 
-    env->CallVoidMethod(*m_path, mid,
-                        (jdouble)sz.width(), (jdouble)sz.height());
-    WTF::CheckAndClearException(env);
+    AffineTransform translation;
+    translation.translate(sz);
+    mutablePath().transform(translation);
 }
 
 void Path::transform(const AffineTransform &at)
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "transform", "(DDDDDD)V");
-    ASSERT(mid);
+    if (isNull())
+        return;
 
-    env->CallVoidMethod(*m_path, mid,
-                        (jdouble)at.a(), (jdouble)at.b(),
-                        (jdouble)at.c(), (jdouble)at.d(),
-                        (jdouble)at.e(), (jdouble)at.f());
-    WTF::CheckAndClearException(env);
+    mutablePath().transform(at);
 }
 
 void Path::applySlowCase(const PathApplierFunction& function) const
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "getPathIterator", "()Lcom/sun/webkit/graphics/WCPathIterator;");
-    ASSERT(mid);
-
-    JLObject iter(env->CallObjectMethod(*m_path, mid));
-    WTF::CheckAndClearException(env);
-
-    if (iter) {
-        static jmethodID midIsDone = env->GetMethodID(PG_GetPathIteratorClass(env),
-            "isDone", "()Z");
-        ASSERT(midIsDone);
-
-        static jmethodID midNext = env->GetMethodID(PG_GetPathIteratorClass(env),
-            "next", "()V");
-        ASSERT(midNext);
-
-        static jmethodID midCurrentSegment = env->GetMethodID(PG_GetPathIteratorClass(env),
-            "currentSegment", "([D)I");
-        ASSERT(midCurrentSegment);
-
-        PathElement pathElement;
-
-        JLocalRef<jdoubleArray> coords(env->NewDoubleArray(6));
-        while(JNI_FALSE == env->CallBooleanMethod(iter, midIsDone)) {
-            jint type = env->CallBooleanMethod(
-                iter,
-                midCurrentSegment,
-                (jdoubleArray)coords);
-            jboolean isCopy = JNI_FALSE;
-            jdouble *data = env->GetDoubleArrayElements(coords, &isCopy);
-            switch (type) {
-            case com_sun_webkit_graphics_WCPathIterator_SEG_MOVETO:
-                pathElement.type = PathElement::Type::MoveToPoint;
-                pathElement.points[0] = FloatPoint(data[0],data[1]);
-                function(pathElement);
-                break;
-            case com_sun_webkit_graphics_WCPathIterator_SEG_LINETO:
-                pathElement.type = PathElement::Type::AddLineToPoint;
-                pathElement.points[0] = FloatPoint(data[0],data[1]);
-                function(pathElement);
-                break;
-            case com_sun_webkit_graphics_WCPathIterator_SEG_QUADTO:
-                pathElement.type = PathElement::Type::AddQuadCurveToPoint;
-                pathElement.points[0] = FloatPoint(data[0],data[1]);
-                pathElement.points[1] = FloatPoint(data[2],data[3]);
-                function(pathElement);
-                break;
-            case com_sun_webkit_graphics_WCPathIterator_SEG_CUBICTO:
-                pathElement.type = PathElement::Type::AddCurveToPoint;
-                pathElement.points[0] = FloatPoint(data[0],data[1]);
-                pathElement.points[1] = FloatPoint(data[2],data[3]);
-                pathElement.points[2] = FloatPoint(data[4],data[5]);
-                function(pathElement);
-                break;
-            case com_sun_webkit_graphics_WCPathIterator_SEG_CLOSE:
-                pathElement.type = PathElement::Type::CloseSubpath;
-                function(pathElement);
-                break;
-            }
-            env->ReleaseDoubleArrayElements(coords, data, JNI_ABORT);
-            env->CallVoidMethod(iter, midNext);
-        }
-        WTF::CheckAndClearException(env);
-    }
+    m_path->apply(function);
 }
+
 bool Path::strokeContains(const FloatPoint& p, const Function<void(GraphicsContext&)>& strokeStyleApplier) const
 {
-    ASSERT(m_path);
     ASSERT(strokeStyleApplier);
 
+    if (isEmpty())
+        return false;
+
     GraphicsContext& gc = scratchContext();
     gc.save();
 
@@ -503,6 +830,9 @@ bool Path::strokeContains(const FloatPoint& p, const Function<void(GraphicsConte
 
     gc.restore();
 
+    // Stroking is left to Prism, which has the stroker.
+    RefPtr<RQRef> path = m_path->javaPath();
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "strokeContains",
@@ -514,7 +844,7 @@ bool Path::strokeContains(const FloatPoint& p, const Function<void(GraphicsConte
     JLocalRef<jdoubleArray> dashArray(env->NewDoubleArray(size));
     env->SetDoubleArrayRegion(dashArray, 0, size, dashes.data());
 
-    jboolean res = env->CallBooleanMethod(*m_path, mid, (jdouble)p.x(),
+    jboolean res = env->CallBooleanMethod(*path, mid, (jdouble)p.x(),
         (jdouble)p.y(), (jdouble) thickness, (jdouble) miterLimit,
         (jint) cap, (jint) join, (jdouble) dashOffset, (jdoubleArray) dashArray);
 
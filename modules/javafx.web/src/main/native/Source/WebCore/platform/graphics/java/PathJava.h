@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include "FloatPoint.h"
+#include "FloatRect.h"
+#include "RQRef.h"
+#include "WindRule.h"
+#include <wtf/Function.h>
+#include <wtf/RefCounted.h>
+#include <wtf/Vector.h>
+
+namespace WebCore {
+
+class AffineTransform;
+struct PathElement;
+
+// Native storage for WebCore::Path. The verbs and coordinates are kept in
+// compact buffers with the layout of com.sun.javafx.geom.Path2D, so that
+// building, measuring and hit-testing a path never leaves native code and
+// painting hands the whole path to Java in a single call.
+//
+// Path shares a PathJava between copies and clones it before mutating, so
+// the Java object made for painting can be reused until the path changes.
+class PathJava : public RefCounted<PathJava> {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    // These match com.sun.webkit.graphics.WCPathIterator.
+    enum Verb : uint8_t {
+        MoveTo = 0,
+        LineTo = 1,
+        QuadTo = 2,
+        CubicTo = 3,
+        Close = 4
+    };
+
+    static Ref<PathJava> create() { return adoptRef(*new PathJava); }
+    Ref<PathJava> copy() const { return adoptRef(*new PathJava(*this)); }
+
+    bool isEmpty() const { return m_verbs.isEmpty(); }
+    size_t elementCount() const { return m_verbs.size(); }
+    bool hasCurrentPoint() const { return !m_verbs.isEmpty(); }
+    FloatPoint currentPoint() const { return m_currentPoint; }
+
+    void clear();
+    void moveTo(const FloatPoint&);
+    void lineTo(const FloatPoint&);
+    void quadTo(const FloatPoint& controlPoint, const FloatPoint& endPoint);
+    void cubicTo(const FloatPoint& controlPoint1, const FloatPoint& controlPoint2, const FloatPoint& endPoint);
+    void close();
+
+    void addArc(const FloatPoint& center, float radiusX, float radiusY, float rotation, float startAngle, float endAngle, bool anticlockwise);
+    void addArcTo(const FloatPoint&, const FloatPoint&, float radius);
+    void addRect(const FloatRect&);
+    void addEllipse(const FloatRect&);
+    void addPath(const PathJava&, const AffineTransform&);
+
+    void transform(const AffineTransform&);
+
+    // The bounds of the control points, and the bounds of the curves.
+    FloatRect fastBoundingRect() const;
+    FloatRect boundingRect() const;
+
+    bool contains(const FloatPoint&, WindRule) const;
+
+    void apply(const Function<void(const PathElement&)>&) const;
+
+    // A com.sun.webkit.graphics.WCPath holding a snapshot of this path,
+    // created on first use after every change.
+    RefPtr<RQRef> javaPath() const;
+
+private:
+    PathJava() = default;
+    PathJava(const PathJava&);
+
+    void appendPoint(const FloatPoint&);
+    void ensureCurrentPoint(const FloatPoint&);
+    void appendArcSegments(const FloatPoint& center, float radiusX, float radiusY, float rotation, float startAngle, float sweep);
+    void didChange();
+
+    template<typename Functor> void forEachEdge(const Functor&) const;
+
+    Vector<uint8_t> m_verbs;
+    Vector<float> m_coords;
+    FloatPoint m_currentPoint;
+    FloatPoint m_subpathStart;
+
+    mutable std::optional<FloatRect> m_fastBoundingRect;
+    mutable std::optional<FloatRect> m_boundingRect;
+    mutable RefPtr<RQRef> m_javaPath;
+};
+
+}
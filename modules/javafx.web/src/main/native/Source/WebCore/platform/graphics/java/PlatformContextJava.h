@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include "AffineTransform.h"
 #include "GraphicsContext.h"
 #include "Path.h"
 #include "RenderingQueue.h"
@@ -34,13 +35,13 @@
 
 namespace WebCore {
 
-    RefPtr<RQRef> copyPath(RefPtr<RQRef> p);
+    RefPtr<RQRef> javaPath(const Path&);
 
     class PlatformContextJava {
         WTF_MAKE_NONCOPYABLE(PlatformContextJava);
     public:
         PlatformContextJava(const JLObject& jRQ, RefPtr<RQRef> jTheme, bool autoFlush = false)
-            : m_rq(RenderingQueue::create(jRQ, com_sun_webkit_graphics_WCRenderQueue_MAX_QUEUE_SIZE / RenderingQueue::MAX_BUFFER_COUNT, autoFlush))
+            : m_rq(RenderingQueue::create(jRQ, RenderingQueue::DEFAULT_BUFFER_SIZE, autoFlush))
             , m_jRenderTheme(jTheme)
         {}
 
@@ -48,6 +49,25 @@ namespace WebCore {
             : PlatformContextJava(jRQ, nullptr, autoFlush)
         {}
 
+        // Makes the context paint into another Java render queue, starting
+        // from the initial state, so that a page can use one context for all
+        // of its paints. Buffers keep their capacity.
+        void reset(const JLObject& jRQ) {
+            m_rq = RenderingQueue::create(jRQ, RenderingQueue::DEFAULT_BUFFER_SIZE, false);
+            m_path.clear();
+            m_dashArray.shrink(0);
+            m_dashOffset = { };
+            m_lineCap = { };
+            m_lineJoin = { };
+            m_miterLimit = { };
+        }
+
+        // Lets go of the render queue once a paint is flushed, so that the
+        // Java queue is not kept alive until the next reset().
+        void releaseRQ() {
+            m_rq = nullptr;
+        }
+
         RenderingQueue& rq() const {
             return *m_rq;
         }
@@ -68,15 +88,8 @@ namespace WebCore {
             m_path.clear();
         }
 
-        void addPath(PlatformPathPtr pPath) {
-            JNIEnv* env = WTF::GetJavaEnv();
-
-            static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-                "addPath", "(Lcom/sun/webkit/graphics/WCPath;)V");
-            ASSERT(mid);
-
-            env->CallVoidMethod((jobject)*m_path.platformPath(), mid, (jobject)*pPath);
-            WTF::CheckAndClearException(env);
+        void addPath(const Path& path) {
+            m_path.addPath(path, AffineTransform());
         }
 
         PlatformPathPtr platformPath() {
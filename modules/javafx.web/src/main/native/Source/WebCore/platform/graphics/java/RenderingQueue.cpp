@@ -31,20 +31,68 @@
 
 #include <wtf/java/JavaRef.h>
 #include <wtf/HashMap.h>
+#include <wtf/Lock.h>
 #include <wtf/NeverDestroyed.h>
 
+#include "com_sun_webkit_graphics_GraphicsDecoder.h"
 #include "com_sun_webkit_graphics_WCRenderQueue.h"
 
 namespace WebCore {
 
 typedef HashMap<char*, RefPtr<ByteBuffer> > Addr2ByteBuffer;
 
+// Only updated on the Event thread, see flushBuffer().
+static uint64_t totalFlushedBytes = 0;
+
 static Addr2ByteBuffer& getAddr2ByteBuffer()
 {
     static NeverDestroyed<Addr2ByteBuffer> container;
     return container.get();
 }
 
+// Every paint and every canvas flush fills at least one buffer of the
+// default size, so those are recycled instead of going back to the heap.
+static constexpr size_t maxFreeBuffers = 8;
+
+static Lock freeBuffersLock;
+
+static Vector<char*, maxFreeBuffers>& freeBuffers()
+{
+    static NeverDestroyed<Vector<char*, maxFreeBuffers>> buffers;
+    return buffers.get();
+}
+
+ByteBuffer::ByteBuffer(int capacity)
+    : m_buffer(nullptr)
+    , m_capacity(capacity)
+    , m_position(0)
+{
+    if (capacity == RenderingQueue::DEFAULT_BUFFER_SIZE) {
+        Locker locker { freeBuffersLock };
+        if (!freeBuffers().isEmpty())
+            m_buffer = freeBuffers().takeLast();
+    }
+    if (!m_buffer)
+        m_buffer = new char[capacity];
+}
+
+void ByteBuffer::retain(RenderingQueue& rq)
+{
+    m_retainedQueues.append(&rq);
+}
+
+ByteBuffer::~ByteBuffer()
+{
+    if (m_capacity == RenderingQueue::DEFAULT_BUFFER_SIZE) {
+        Locker locker { freeBuffersLock };
+        if (freeBuffers().size() < maxFreeBuffers) {
+            freeBuffers().uncheckedAppend(m_buffer);
+            return;
+        }
+    }
+    delete[] m_buffer;
+}
+
 /*static*/
 RefPtr<RenderingQueue> RenderingQueue::create(
     const JLObject &jRQ,
@@ -70,6 +118,19 @@ RenderingQueue& RenderingQueue::freeSpace(int size) {
     return *this;
 }
 
+RenderingQueue& RenderingQueue::replay(RenderingQueue& retained) {
+    freeSpace(8);
+    m_buffer->retain(retained);
+    return *this
+        << (jint)com_sun_webkit_graphics_GraphicsDecoder_REPLAYRQ
+        << retained.getRQRenderingQueue();
+}
+
+/*static*/
+uint64_t RenderingQueue::flushedByteCount() {
+    return totalFlushedBytes;
+}
+
 void RenderingQueue::flush() {
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -109,6 +170,8 @@ RenderingQueue& RenderingQueue::flushBuffer() {
         "fwkAddBuffer", "(Ljava/nio/ByteBuffer;)V");
     ASSERT(midFwkAddBuffer);
 
+    totalFlushedBytes += m_buffer->size();
+
     Addr2ByteBuffer &a2bb = getAddr2ByteBuffer();
     a2bb.set(m_buffer->bufferAddress(), m_buffer);
     env->CallVoidMethod(
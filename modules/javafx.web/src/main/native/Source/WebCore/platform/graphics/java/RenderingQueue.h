@@ -32,10 +32,12 @@
 #include <wtf/java/DbgUtils.h>
 
 #include "RQRef.h"
+#include "com_sun_webkit_graphics_WCRenderQueue.h"
 
 namespace WebCore {
 
 class RQRef;
+class RenderingQueue;
 
 class ByteBuffer : public RefCounted<ByteBuffer> {
     RQ_LOG_INSTANCE_COUNT(ByteBuffer)
@@ -76,22 +78,22 @@ public:
 
     bool isEmpty() { return m_position == 0; }
 
-    ~ByteBuffer() {
-        delete[] m_buffer;
-    }
+    int size() const { return m_position; }
+
+    // Keeps a retained queue alive for as long as this buffer may be decoded.
+    void retain(RenderingQueue&);
+
+    ~ByteBuffer();
 
 private:
-    ByteBuffer(int capacity) :
-        m_buffer(new char[capacity]),
-        m_capacity(capacity),
-        m_position(0)
-    {}
+    ByteBuffer(int capacity);
 
     char* m_buffer;
     int m_capacity;
     int m_position;
     JGObject m_nio_holder;
     Vector< RefPtr<RQRef> > m_refList;
+    Vector< RefPtr<RenderingQueue> > m_retainedQueues;
 };
 
 /*
@@ -108,6 +110,7 @@ class RenderingQueue : public RefCounted<RenderingQueue> {
     RQ_LOG_INSTANCE_COUNT(RenderingQueue)
 public:
     static const size_t MAX_BUFFER_COUNT = 8;
+    static const int DEFAULT_BUFFER_SIZE = com_sun_webkit_graphics_WCRenderQueue_MAX_QUEUE_SIZE / MAX_BUFFER_COUNT;
 
     static RefPtr<RenderingQueue> create(
         const JLObject &jRQ,
@@ -134,6 +137,14 @@ public:
     RenderingQueue& freeSpace(int size);
     RenderingQueue& flushBuffer();
 
+    // The number of bytes all queues have handed over to Java so far.
+    static uint64_t flushedByteCount();
+
+    // Appends a command that decodes the flushed buffers of a retained
+    // queue in place. Unlike DECODERQ, the retained queue is not disposed
+    // of by decoding, so the same recording can be replayed again.
+    RenderingQueue& replay(RenderingQueue& retained);
+
     bool isEmpty() {
         return m_buffer == nullptr || m_buffer->isEmpty();
     }
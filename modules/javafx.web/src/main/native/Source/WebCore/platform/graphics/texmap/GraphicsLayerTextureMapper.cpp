@@ -416,6 +416,13 @@ void GraphicsLayerTextureMapper::commitLayerChanges()
     if (m_changeMask == NoChanges)
         return;
 
+#if PLATFORM(JAVA)
+    // Children report their own damage, and contents repaints are reported
+    // per dirty rect by updateBackingStoreIfNeeded().
+    if (m_changeMask & ~(ChildrenChange | DisplayChange | AnimationStarted))
+        m_layer.setNeedsFullDamage();
+#endif
+
     if (m_changeMask & ChildrenChange) {
         Vector<GraphicsLayer*> rawChildren;
         rawChildren.reserveInitialCapacity(children().size());
@@ -567,6 +574,10 @@ void GraphicsLayerTextureMapper::updateBackingStoreIfNeeded(TextureMapper& textu
     if (dirtyRect.isEmpty())
         return;
 
+#if PLATFORM(JAVA)
+    m_layer.addDamage(dirtyRect);
+#endif
+
     m_backingStore->updateContentsScale(pageScaleFactor() * deviceScaleFactor());
 
     dirtyRect.scale(pageScaleFactor() * deviceScaleFactor());
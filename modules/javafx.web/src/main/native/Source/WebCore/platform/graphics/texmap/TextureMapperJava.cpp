@@ -56,6 +56,15 @@ IntSize TextureMapperJava::maxTextureSize() const
 
 void TextureMapperJava::beginClip(const TransformationMatrix& matrix, const FloatRoundedRect& rect)
 {
+    if (m_currentSurface)
+        m_clipStack.append(FloatRect::infiniteRect());
+    else {
+        FloatRect clipRect = matrix.mapRect(rect.rect());
+        if (!m_clipStack.isEmpty())
+            clipRect.intersect(m_clipStack.last());
+        m_clipStack.append(clipRect);
+    }
+
     GraphicsContext* context = currentContext();
     if (!context)
         return;
@@ -66,10 +75,24 @@ void TextureMapperJava::beginClip(const TransformationMatrix& matrix, const Floa
     context->setCTM(previousTransform);
 }
 
+void TextureMapperJava::endClip()
+{
+    if (!m_clipStack.isEmpty())
+        m_clipStack.removeLast();
+    graphicsContext()->restore();
+}
+
+bool TextureMapperJava::isClippedOut(const FloatRect& rect, const TransformationMatrix& transform) const
+{
+    if (m_currentSurface || m_clipStack.isEmpty())
+        return false;
+    return !transform.mapRect(rect).intersects(m_clipStack.last());
+}
+
 void TextureMapperJava::drawTexture(const BitmapTexture& texture, const FloatRect& targetRect, const TransformationMatrix& transform, float opacity, unsigned /* exposedEdges */)
 {
     GraphicsContext* context = currentContext();
-    if (!context)
+    if (!context || isClippedOut(targetRect, transform))
         return;
 
     const BitmapTextureJava& textureImageBuffer = static_cast<const BitmapTextureJava&>(texture);
@@ -90,7 +113,7 @@ void TextureMapperJava::drawTexture(const BitmapTexture& texture, const FloatRec
 void TextureMapperJava::drawSolidColor(const FloatRect& rect, const TransformationMatrix& transform, const Color& color, bool)
 {
     GraphicsContext* context = currentContext();
-    if (!context)
+    if (!context || isClippedOut(rect, transform))
         return;
 
     context->save();
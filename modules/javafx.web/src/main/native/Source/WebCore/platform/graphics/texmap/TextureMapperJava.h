@@ -29,6 +29,8 @@
 #include "ImageBuffer.h"
 #include "TextureMapper.h"
 #include "GraphicsContext.h"
+#include <wtf/Vector.h>
+
 #if USE(TEXTURE_MAPPER)
 namespace WebCore {
 
@@ -44,7 +46,7 @@ public:
     void drawSolidColor(const FloatRect&, const TransformationMatrix&, const Color&, bool) final;
     void beginClip(const TransformationMatrix&, const FloatRoundedRect&) final;
     void bindSurface(BitmapTexture* surface) final { m_currentSurface = surface;}
-    void endClip() final { graphicsContext()->restore(); }
+    void endClip() final;
     IntRect clipBounds() final { return currentContext()->clipBounds(); }
     IntSize maxTextureSize() const final;
     Ref<BitmapTexture> createTexture() final { return BitmapTextureJava::create(); }
@@ -59,7 +61,12 @@ public:
     void setGraphicsContext(GraphicsContext* context) { m_context = context; }
     GraphicsContext* graphicsContext() { return m_context; }
 private:
+    bool isClippedOut(const FloatRect&, const TransformationMatrix&) const;
+
     RefPtr<BitmapTexture> m_currentSurface;
+    // Device space clips of the root surface, used to skip draws that
+    // fall entirely outside the damaged area.
+    Vector<FloatRect> m_clipStack;
     GraphicsContext* m_context;
 };
 
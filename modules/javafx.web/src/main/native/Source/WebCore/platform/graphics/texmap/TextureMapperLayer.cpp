@@ -144,6 +144,87 @@ void TextureMapperLayer::paint(TextureMapper& textureMapper)
     paintRecursive(options);
 }
 
+#if PLATFORM(JAVA)
+void TextureMapperLayer::addDamage(const FloatRect& rect)
+{
+    m_pendingDamage.unite(rect);
+}
+
+FloatRect TextureMapperLayer::collectDamage()
+{
+    computeTransformsRecursive();
+
+    FloatRect damage = std::exchange(m_detachedDamage, FloatRect());
+    collectDamageRecursive(damage);
+    return damage;
+}
+
+// Bounds in root coordinates of what paintSelf() covers, filter outsets included.
+FloatRect TextureMapperLayer::screenRect() const
+{
+    if (m_state.size.isEmpty() || !m_state.visible || !m_state.contentsVisible || m_currentOpacity < 0.01)
+        return { };
+
+    FloatRect rect = layerRect();
+    if (m_currentFilters.hasOutsets()) {
+        auto outsets = m_currentFilters.outsets();
+        rect.move(-outsets.left(), -outsets.top());
+        rect.expand(outsets.left() + outsets.right(), outsets.top() + outsets.bottom());
+    }
+    return m_layerTransforms.combined.mapRect(rect);
+}
+
+void TextureMapperLayer::collectDamageRecursive(FloatRect& damage)
+{
+    // computeTransformsRecursive() skips such subtrees, and so does painting.
+    if (m_state.size.isEmpty() && m_state.masksToBounds) {
+        discardDamageRecursive(damage);
+        return;
+    }
+
+    FloatRect subtreeDamage;
+    FloatRect rect = screenRect();
+    if (m_needsFullDamage || rect != m_lastScreenRect || m_contentsLayer || m_animations.hasRunningAnimations()) {
+        subtreeDamage.unite(m_lastScreenRect);
+        subtreeDamage.unite(rect);
+    } else if (!m_pendingDamage.isEmpty())
+        subtreeDamage.unite(m_layerTransforms.combined.mapRect(m_pendingDamage));
+    m_lastScreenRect = rect;
+    m_pendingDamage = FloatRect();
+    m_needsFullDamage = false;
+
+    if (m_state.maskLayer)
+        m_state.maskLayer->collectDamageRecursive(subtreeDamage);
+    if (m_state.backdropLayer)
+        m_state.backdropLayer->collectDamageRecursive(subtreeDamage);
+    if (m_state.replicaLayer)
+        m_state.replicaLayer->collectDamageRecursive(subtreeDamage);
+    for (auto* child : m_children)
+        child->collectDamageRecursive(subtreeDamage);
+
+    // A reflection repeats the whole subtree somewhere else.
+    if (m_state.replicaLayer && !subtreeDamage.isEmpty())
+        subtreeDamage = FloatRect::infiniteRect();
+    damage.unite(subtreeDamage);
+}
+
+void TextureMapperLayer::discardDamageRecursive(FloatRect& damage)
+{
+    if (m_state.replicaLayer && !m_lastScreenRect.isEmpty())
+        damage = FloatRect::infiniteRect();
+    damage.unite(m_lastScreenRect);
+    m_lastScreenRect = FloatRect();
+    m_pendingDamage = FloatRect();
+
+    if (m_state.maskLayer)
+        m_state.maskLayer->discardDamageRecursive(damage);
+    if (m_state.backdropLayer)
+        m_state.backdropLayer->discardDamageRecursive(damage);
+    for (auto* child : m_children)
+        child->discardDamageRecursive(damage);
+}
+#endif
+
 void TextureMapperLayer::paintSelf(TextureMapperPaintOptions& options)
 {
     if (!m_state.visible || !m_state.contentsVisible)
@@ -536,6 +617,9 @@ void TextureMapperLayer::addChild(TextureMapperLayer* childLayer)
 void TextureMapperLayer::removeFromParent()
 {
     if (m_parent) {
+#if PLATFORM(JAVA)
+        discardDamageRecursive(m_parent->rootLayer().m_detachedDamage);
+#endif
         size_t index = m_parent->m_children.find(this);
         ASSERT(index != notFound);
         m_parent->m_children.remove(index);
@@ -547,8 +631,12 @@ void TextureMapperLayer::removeFromParent()
 void TextureMapperLayer::removeAllChildren()
 {
     auto oldChildren = WTFMove(m_children);
-    for (auto* child : oldChildren)
+    for (auto* child : oldChildren) {
+#if PLATFORM(JAVA)
+        child->discardDamageRecursive(rootLayer().m_detachedDamage);
+#endif
         child->m_parent = nullptr;
+    }
 }
 
 void TextureMapperLayer::setMaskLayer(TextureMapperLayer* maskLayer)
@@ -103,6 +103,16 @@ public:
 
     void paint(TextureMapper&);
 
+#if PLATFORM(JAVA)
+    // Damage is what has to be composited again: the old and new screen
+    // bounds of layers that moved, changed or animate, plus repainted parts
+    // of layer contents. collectDamage() is called on the root layer once
+    // per frame, after animations and backing stores have been updated.
+    void addDamage(const FloatRect&);
+    void setNeedsFullDamage() { m_needsFullDamage = true; }
+    FloatRect collectDamage();
+#endif
+
     void addChild(TextureMapperLayer*);
 
 private:
@@ -115,6 +125,11 @@ private:
         return const_cast<TextureMapperLayer&>(*this);
     }
     void computeTransformsRecursive();
+#if PLATFORM(JAVA)
+    FloatRect screenRect() const;
+    void collectDamageRecursive(FloatRect&);
+    void discardDamageRecursive(FloatRect&);
+#endif
 
     static void sortByZOrder(Vector<TextureMapperLayer* >& array);
 
@@ -221,6 +236,12 @@ private:
 #endif
     bool m_isBackdrop { false };
     bool m_isReplica { false };
+#if PLATFORM(JAVA)
+    FloatRect m_pendingDamage;
+    FloatRect m_lastScreenRect;
+    FloatRect m_detachedDamage;
+    bool m_needsFullDamage { false };
+#endif
 
     struct {
         TransformationMatrix localTransform;
@@ -28,52 +28,52 @@
 #include "MIMETypeRegistry.h"
 #include <wtf/text/CString.h>
 
+#include "MIMETypeExtensionData.h"
 #include "PlatformJavaClasses.h"
 
 namespace WebCore {
 
-struct ExtensionMap {
-    const char* extension;
+// Longest extension in MIMETypeExtensionData.gperf is well below this; anything longer
+// cannot be in the table and is rejected before hashing.
+static constexpr unsigned maxExtensionLength = 16;
+
+struct PreferredExtension {
     const char* mimeType;
+    const char* extension;
 };
 
-static const ExtensionMap extensionMap [] = {
-    { "bmp", "image/bmp" },
-    { "css", "text/css" },
-    { "cur", "image/x-icon" },
-    { "gif", "image/gif" },
-    { "html", "text/html" },
-    { "htm", "text/html" },
-    { "ico", "image/x-icon" },
-    { "jpeg", "image/jpeg" },
-    { "jpg", "image/jpeg" },
-    { "js", "application/x-javascript" },
-    { "mp3", "audio/mpeg"},
-    { "pdf", "application/pdf" },
-    { "png", "image/png" },
-    { "rss", "application/rss+xml" },
-    { "svg", "image/svg+xml" },
-    { "svgz", "image/svg+xml" },
-    { "swf", "application/x-shockwave-flash" },
-    { "text", "text/plain" },
-    { "tif", "image/tiff" },
-    { "tiff", "image/tiff" },
-    { "txt", "text/plain" },
-    { "xbm", "image/x-xbitmap" },
-    { "xml", "text/xml" },
-    { "xsl", "text/xsl" },
-    { "xht", "application/xhtml+xml" },
-    { "xhtml", "application/xhtml+xml" },
-    { "wml", "text/vnd.wap.wml" },
-    { "wmlc", "application/vnd.wap.wmlc" },
+// Reverse mapping for the MIME types that have more than one extension in
+// MIMETypeExtensionData.gperf, or whose extension is not the obvious one.
+static const PreferredExtension preferredExtensions[] = {
+    { "application/x-javascript", "js" },
+    { "application/xhtml+xml", "xhtml" },
+    { "image/jpeg", "jpg" },
+    { "image/svg+xml", "svg" },
+    { "image/tiff", "tiff" },
+    { "image/x-icon", "ico" },
+    { "text/html", "html" },
+    { "text/javascript", "js" },
+    { "text/plain", "txt" },
 };
 
 String MIMETypeRegistry::mimeTypeForExtension(const String& extension)
 {
-    for (auto& entry : extensionMap) {
-        if (equalIgnoringASCIICase(extension, entry.extension))
-            return entry.mimeType;
+    unsigned length = extension.length();
+    if (!length || length > maxExtensionLength)
+        return String();
+
+    // The table is a compile-time perfect hash, so a lookup is a single probe with no
+    // allocation and no call into Java.
+    char buffer[maxExtensionLength];
+    for (unsigned i = 0; i < length; ++i) {
+        UChar c = extension[i];
+        if (!isASCII(c))
+            return String();
+        buffer[i] = static_cast<char>(c);
     }
+
+    if (auto* entry = findMIMETypeExtension(buffer, length))
+        return entry->mimeType;
     return String();
 }
 
@@ -84,10 +84,18 @@ bool MIMETypeRegistry::isApplicationPluginMIMEType(const String&)
 
 String MIMETypeRegistry::preferredExtensionForMIMEType(const String& mimeType)
 {
-    for (auto& entry : extensionMap) {
+    for (auto& entry : preferredExtensions) {
         if (equalIgnoringASCIICase(mimeType, entry.mimeType))
             return entry.extension;
     }
+
+    // Otherwise the subtype usually is the extension, e.g. image/png or font/woff2.
+    size_t slash = mimeType.find('/');
+    if (slash != notFound) {
+        String subtype = mimeType.substring(slash + 1);
+        if (equalIgnoringASCIICase(mimeTypeForExtension(subtype), mimeType))
+            return subtype.convertToASCIILowercase();
+    }
     return emptyString();
 }
 
@@ -183,7 +183,11 @@ bool SocketStreamHandleImpl::sendPendingData()
 
 size_t SocketStreamHandleImpl::bufferedAmount()
 {
+#if PLATFORM(JAVA)
+    return m_buffer.size() + platformBufferedAmount();
+#else
     return m_buffer.size();
+#endif
 }
 
 } // namespace WebCore
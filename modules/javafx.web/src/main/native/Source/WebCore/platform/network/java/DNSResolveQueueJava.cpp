@@ -28,28 +28,135 @@
 
 #if PLATFORM(JAVA)
 
-#include "NotImplemented.h"
+#include "PlatformJavaClasses.h"
+#include "com_sun_webkit_network_DNSResolver.h"
+#include <wtf/CompletionHandler.h>
+#include <wtf/MainThread.h>
 
 namespace WebCore {
 
+static jclass GetDNSResolverClass(JNIEnv* env)
+{
+    static JGClass dnsResolverClass(env->FindClass(
+            "com/sun/webkit/network/DNSResolver"));
+    ASSERT(dnsResolverClass);
+    return dnsResolverClass;
+}
+
 void DNSResolveQueueJava::updateIsUsingProxy()
 {
-    notImplemented();
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            GetDNSResolverClass(env),
+            "fwkIsUsingProxy",
+            "()Z");
+    ASSERT(mid);
+
+    jboolean isUsingProxy = env->CallStaticBooleanMethod(GetDNSResolverClass(env), mid);
+    if (WTF::CheckAndClearException(env)) {
+        m_isUsingProxy = true;
+        return;
+    }
+    m_isUsingProxy = jbool_to_bool(isUsingProxy);
+}
+
+// The lookup warms the JVM address cache shared with the Java loaders,
+// the request count is released by DNSResolver.twkPrefetchComplete().
+void DNSResolveQueueJava::platformResolve(const String& hostname)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            GetDNSResolverClass(env),
+            "fwkPrefetch",
+            "(Ljava/lang/String;)V");
+    ASSERT(mid);
+
+    env->CallStaticVoidMethod(
+            GetDNSResolverClass(env),
+            mid,
+            (jstring) hostname.toJavaString(env));
+    if (WTF::CheckAndClearException(env))
+        decrementRequestCount();
 }
 
-void DNSResolveQueueJava::platformResolve(const String& /* hostname */)
+void DNSResolveQueueJava::resolve(const String& hostname, uint64_t identifier, DNSCompletionHandler&& completionHandler)
 {
-    notImplemented();
+    ASSERT(isMainThread());
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            GetDNSResolverClass(env),
+            "fwkResolve",
+            "(Ljava/lang/String;J)V");
+    ASSERT(mid);
+
+    m_completionHandlers.set(identifier, WTFMove(completionHandler));
+    env->CallStaticVoidMethod(
+            GetDNSResolverClass(env),
+            mid,
+            (jstring) hostname.toJavaString(env),
+            (jlong) identifier);
+    if (WTF::CheckAndClearException(env))
+        didResolve(identifier, makeUnexpected(DNSError::Unknown));
 }
 
-void DNSResolveQueueJava::resolve(const String& /* hostname */, uint64_t /* identifier */, DNSCompletionHandler&& /* completionHandler */)
+void DNSResolveQueueJava::stopResolve(uint64_t identifier)
 {
-    notImplemented();
+    ASSERT(isMainThread());
+    // The lookup itself still completes and populates the cache.
+    didResolve(identifier, makeUnexpected(DNSError::Cancelled));
 }
 
-void DNSResolveQueueJava::stopResolve(uint64_t /* identifier */)
+void DNSResolveQueueJava::didResolve(uint64_t identifier, DNSAddressesOrError&& result)
 {
-    notImplemented();
+    ASSERT(isMainThread());
+    if (auto completionHandler = m_completionHandlers.take(identifier))
+        completionHandler(WTFMove(result));
+}
+
+}
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_DNSResolver_twkPrefetchComplete
+  (JNIEnv*, jclass)
+{
+    WebCore::DNSResolveQueue::singleton().decrementRequestCount();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_DNSResolver_twkDidResolve
+  (JNIEnv* env, jclass, jlong identifier, jobjectArray addresses)
+{
+    using namespace WebCore;
+    auto& queue = static_cast<DNSResolveQueueJava&>(DNSResolveQueue::singleton());
+    if (!addresses) {
+        queue.didResolve(identifier, makeUnexpected(DNSError::CannotResolve));
+        return;
+    }
+
+    Vector<IPAddress> result;
+    jsize count = env->GetArrayLength(addresses);
+    for (jsize i = 0; i < count; ++i) {
+        JLocalRef<jbyteArray> address(static_cast<jbyteArray>(env->GetObjectArrayElement(addresses, i)));
+        jsize length = env->GetArrayLength(address);
+        if (length == sizeof(struct in_addr)) {
+            struct in_addr ipv4;
+            env->GetByteArrayRegion(address, 0, length, reinterpret_cast<jbyte*>(&ipv4));
+            result.append(IPAddress { ipv4 });
+        } else if (length == sizeof(struct in6_addr)) {
+            struct in6_addr ipv6;
+            env->GetByteArrayRegion(address, 0, length, reinterpret_cast<jbyte*>(&ipv6));
+            result.append(IPAddress { ipv6 });
+        }
+    }
+
+    if (result.isEmpty()) {
+        queue.didResolve(identifier, makeUnexpected(DNSError::CannotResolve));
+        return;
+    }
+    queue.didResolve(identifier, WTFMove(result));
 }
 
 }
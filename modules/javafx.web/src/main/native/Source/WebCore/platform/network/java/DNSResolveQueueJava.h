@@ -26,6 +26,7 @@
 #pragma once
 
 #include "DNSResolveQueue.h"
+#include <wtf/HashMap.h>
 
 namespace WebCore {
 
@@ -35,9 +36,13 @@ public:
     void resolve(const String& hostname, uint64_t identifier, DNSCompletionHandler&&) final;
     void stopResolve(uint64_t identifier) final;
 
+    void didResolve(uint64_t identifier, DNSAddressesOrError&&);
+
 private:
     void updateIsUsingProxy() final;
     void platformResolve(const String&) final;
+
+    HashMap<uint64_t, DNSCompletionHandler> m_completionHandlers;
 };
 
 using DNSResolveQueuePlatform = DNSResolveQueueJava;
@@ -0,0 +1,562 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "DiskCacheJava.h"
+
+#include "CacheValidation.h"
+#include "HTTPHeaderNames.h"
+#include "PlatformJavaClasses.h"
+#include "ResourceRequest.h"
+#include <wtf/FileSystem.h>
+#include <wtf/MainThread.h>
+#include <wtf/SHA1.h>
+#include <wtf/persistence/PersistentDecoder.h>
+#include <wtf/persistence/PersistentEncoder.h>
+
+#include "com_sun_webkit_DiskCache.h"
+
+namespace WebCore {
+
+// Bump when the layout of the index changes; older indexes are discarded.
+static const uint32_t indexVersion = 1;
+static const char indexFileName[] = "index";
+static const char bodyFileExtension[] = ".body";
+static const char temporaryFileExtension[] = ".tmp";
+static const Seconds writeIndexDelay = 1_s;
+
+static void encodeResponse(WTF::Persistence::Encoder& encoder, const ResourceResponse& response)
+{
+    Vector<std::pair<String, String>> headers;
+    for (const auto& header : response.httpHeaderFields()) {
+        // Cookies are handled by the Java network stack and must not be
+        // replayed from the cache.
+        if (header.keyAsHTTPHeaderName == HTTPHeaderName::SetCookie || header.keyAsHTTPHeaderName == HTTPHeaderName::SetCookie2)
+            continue;
+        headers.append({ header.key, header.value });
+    }
+
+    encoder << response.url().string();
+    encoder << static_cast<int32_t>(response.httpStatusCode());
+    encoder << response.httpStatusText();
+    encoder << response.mimeType();
+    encoder << response.textEncodingName();
+    encoder << static_cast<int64_t>(response.expectedContentLength());
+    encoder << headers;
+}
+
+static std::optional<ResourceResponse> decodeResponse(WTF::Persistence::Decoder& decoder)
+{
+    std::optional<String> url;
+    decoder >> url;
+    std::optional<int32_t> statusCode;
+    decoder >> statusCode;
+    std::optional<String> statusText;
+    decoder >> statusText;
+    std::optional<String> mimeType;
+    decoder >> mimeType;
+    std::optional<String> textEncodingName;
+    decoder >> textEncodingName;
+    std::optional<int64_t> expectedContentLength;
+    decoder >> expectedContentLength;
+    std::optional<Vector<std::pair<String, String>>> headers;
+    decoder >> headers;
+    if (!url || !statusCode || !statusText || !mimeType || !textEncodingName || !expectedContentLength || !headers)
+        return std::nullopt;
+
+    ResourceResponse response(URL(URL(), *url), *mimeType, *expectedContentLength, *textEncodingName);
+    response.setHTTPStatusCode(*statusCode);
+    response.setHTTPStatusText(*statusText);
+    for (const auto& header : *headers)
+        response.setHTTPHeaderField(header.first, header.second);
+    return response;
+}
+
+// The request headers named by the Vary header of the response, or
+// std::nullopt if the response varies on something we cannot compare.
+static std::optional<Vector<std::pair<String, String>>> varyingRequestHeaders(const ResourceRequest& request, const ResourceResponse& response)
+{
+    Vector<std::pair<String, String>> result;
+    String vary = response.httpHeaderField(HTTPHeaderName::Vary);
+    for (auto& name : vary.split(',')) {
+        String headerName = name.stripWhiteSpace();
+        if (headerName == "*")
+            return std::nullopt;
+        if (!headerName.isEmpty())
+            result.append({ headerName, request.httpHeaderField(headerName) });
+    }
+    return result;
+}
+
+static String cacheURL(const ResourceRequest& request)
+{
+    return request.url().stringWithoutFragmentIdentifier().toString();
+}
+
+static bool requestWantsValidation(const ResourceRequest& request)
+{
+    if (request.cachePolicy() == ResourceRequestCachePolicy::RefreshAnyCacheData)
+        return true;
+    return parseCacheControlDirectives(request.httpHeaderFields()).noCache;
+}
+
+DiskCacheJava& DiskCacheJava::singleton()
+{
+    static NeverDestroyed<DiskCacheJava> diskCache;
+    return diskCache;
+}
+
+DiskCacheJava::DiskCacheJava()
+    : m_ioQueue(WorkQueue::create("com.sun.webkit.DiskCache", WorkQueue::QOS::Utility))
+    , m_writeIndexTimer(*this, &DiskCacheJava::writeIndex)
+{
+}
+
+void DiskCacheJava::setDirectory(const String& directory, uint64_t capacity)
+{
+    ASSERT(isMainThread());
+    if (m_writeIndexTimer.isActive()) {
+        m_writeIndexTimer.stop();
+        writeIndex();
+    }
+    // Finish the writes to the current directory, which may be reopened.
+    m_ioQueue->dispatchSync([] { });
+
+    m_records.clear();
+    m_pendingRecords.clear();
+    m_latestWrites.clear();
+    m_size = 0;
+    m_generation++;
+    m_directory = directory.isEmpty() ? String() : directory;
+    m_capacity = capacity;
+    if (!isEnabled())
+        return;
+
+    FileSystem::makeAllDirectories(m_directory);
+    loadIndex();
+    removeUnknownFiles();
+    shrink();
+}
+
+void DiskCacheJava::clear()
+{
+    ASSERT(isMainThread());
+    if (!isEnabled())
+        return;
+
+    m_writeIndexTimer.stop();
+    m_records.clear();
+    m_pendingRecords.clear();
+    m_latestWrites.clear();
+    m_size = 0;
+    m_generation++;
+    m_ioQueue->dispatch([directory = m_directory.isolatedCopy()] {
+        for (auto& fileName : FileSystem::listDirectory(directory))
+            FileSystem::deleteFile(FileSystem::pathByAppendingComponent(directory, fileName));
+    });
+}
+
+bool DiskCacheJava::canUseCache(const ResourceRequest& request)
+{
+    if (request.httpMethod() != "GET" || !request.url().protocolIsInHTTPFamily())
+        return false;
+    if (request.httpBody() || request.hasHTTPHeaderField(HTTPHeaderName::Range))
+        return false;
+    if (request.cachePolicy() == ResourceRequestCachePolicy::DoNotUseAnyCache)
+        return false;
+    return !parseCacheControlDirectives(request.httpHeaderFields()).noStore;
+}
+
+bool DiskCacheJava::isStorable(const ResourceRequest& request, const ResourceResponse& response)
+{
+    if (!canUseCache(request) || request.hasHTTPHeaderField(HTTPHeaderName::Authorization))
+        return false;
+    if (response.httpStatusCode() == 206 || !isStatusCodeCacheableByDefault(response.httpStatusCode()))
+        return false;
+    if (response.cacheControlContainsNoStore() || !varyingRequestHeaders(request, response))
+        return false;
+    // Without validators an entry is only useful while it is fresh.
+    return response.hasCacheValidatorFields()
+        || computeFreshnessLifetimeForHTTPFamily(response, WallTime::now()) > 0_s;
+}
+
+std::optional<DiskCacheJava::Entry> DiskCacheJava::retrieve(const ResourceRequest& request)
+{
+    ASSERT(isMainThread());
+    // A conditional request revalidates the memory cache of WebCore, whose
+    // validators must reach the server unchanged.
+    if (!isEnabled() || request.isConditional()
+        || request.cachePolicy() == ResourceRequestCachePolicy::ReloadIgnoringCacheData) {
+        return std::nullopt;
+    }
+
+    String key = computeKey(request);
+    auto it = m_records.find(key);
+    if (it == m_records.end()) {
+        m_statistics.misses++;
+        return std::nullopt;
+    }
+
+    auto& record = it->value;
+    bool matches = record.url == cacheURL(request);
+    for (const auto& header : record.varyingRequestHeaders)
+        matches = matches && request.httpHeaderField(header.first) == header.second;
+    if (!matches) {
+        m_statistics.misses++;
+        return std::nullopt;
+    }
+
+    auto body = SharedBuffer::createWithContentsOfFile(bodyPath(key));
+    if (!body || body->size() != record.bodySize) {
+        removeRecord(key);
+        scheduleIndexWrite();
+        m_statistics.misses++;
+        return std::nullopt;
+    }
+
+    bool needsValidation = false;
+    switch (request.cachePolicy()) {
+    case ResourceRequestCachePolicy::ReturnCacheDataElseLoad:
+    case ResourceRequestCachePolicy::ReturnCacheDataDontLoad:
+        // History navigations use whatever is stored.
+        break;
+    default:
+        needsValidation = requestWantsValidation(request)
+            || record.response.cacheControlContainsNoCache()
+            || computeCurrentAge(record.response, record.responseTimestamp) > computeFreshnessLifetimeForHTTPFamily(record.response, record.responseTimestamp);
+        break;
+    }
+    if (needsValidation && !record.response.hasCacheValidatorFields()) {
+        m_statistics.misses++;
+        return std::nullopt;
+    }
+
+    record.lastAccess = WallTime::now();
+    scheduleIndexWrite();
+    if (!needsValidation)
+        m_statistics.hits++;
+    return Entry { record.response, body.releaseNonNull(), needsValidation };
+}
+
+void DiskCacheJava::addValidationHeaders(ResourceRequest& request, const ResourceResponse& response)
+{
+    String eTag = response.httpHeaderField(HTTPHeaderName::ETag);
+    if (!eTag.isEmpty())
+        request.setHTTPHeaderField(HTTPHeaderName::IfNoneMatch, eTag);
+    String lastModified = response.httpHeaderField(HTTPHeaderName::LastModified);
+    if (!lastModified.isEmpty())
+        request.setHTTPHeaderField(HTTPHeaderName::IfModifiedSince, lastModified);
+}
+
+void DiskCacheJava::store(const ResourceRequest& request, const ResourceResponse& response, WallTime responseTimestamp, Vector<uint8_t>&& body)
+{
+    ASSERT(isMainThread());
+    if (!isEnabled() || body.size() > maximumEntrySize())
+        return;
+    auto varyingHeaders = varyingRequestHeaders(request, response);
+    if (!varyingHeaders)
+        return;
+
+    String key = computeKey(request);
+    // The write replaces the body of the stored entry, whose headers must
+    // not be served with the new body.
+    if (auto it = m_records.find(key); it != m_records.end()) {
+        m_size -= it->value.bodySize;
+        m_records.remove(it);
+        scheduleIndexWrite();
+    }
+    uint64_t writeID = ++m_lastWriteID;
+    m_latestWrites.set(key, writeID);
+    m_pendingRecords.set(writeID, Record {
+        cacheURL(request),
+        response,
+        responseTimestamp,
+        WTFMove(*varyingHeaders),
+        body.size(),
+        WallTime::now()
+    });
+
+    // The body is written to a temporary file and renamed, so that a body
+    // mapped by a load in progress is never modified.
+    m_ioQueue->dispatch([key = key.isolatedCopy(), path = bodyPath(key).isolatedCopy(), body = WTFMove(body), generation = m_generation, writeID] {
+        String temporaryPath = makeString(path, temporaryFileExtension);
+        auto handle = FileSystem::openFile(temporaryPath, FileSystem::FileOpenMode::Write);
+        bool written = FileSystem::isHandleValid(handle)
+            && FileSystem::writeToFile(handle, body.data(), body.size()) == static_cast<int>(body.size());
+        FileSystem::closeFile(handle);
+        written = written && FileSystem::moveFile(temporaryPath, path);
+        if (!written)
+            FileSystem::deleteFile(temporaryPath);
+
+        callOnMainThread([key = key.isolatedCopy(), written, generation, writeID] {
+            auto& diskCache = DiskCacheJava::singleton();
+            if (generation != diskCache.m_generation)
+                return;
+            auto record = diskCache.m_pendingRecords.take(writeID);
+            // A later store of the key replaces the body on the same queue,
+            // so the file may already hold its body rather than this one.
+            auto latest = diskCache.m_latestWrites.find(key);
+            if (latest == diskCache.m_latestWrites.end() || latest->value != writeID)
+                return;
+            diskCache.m_latestWrites.remove(latest);
+            if (!written)
+                return;
+            diskCache.insert(key, WTFMove(record));
+            diskCache.m_statistics.stores++;
+            diskCache.shrink();
+            diskCache.scheduleIndexWrite();
+        });
+    });
+}
+
+std::optional<ResourceResponse> DiskCacheJava::update(const ResourceRequest& request, const ResourceResponse& validatingResponse)
+{
+    ASSERT(isMainThread());
+    auto it = m_records.find(computeKey(request));
+    if (it == m_records.end())
+        return std::nullopt;
+
+    auto& record = it->value;
+    updateResponseHeadersAfterRevalidation(record.response, validatingResponse);
+    record.responseTimestamp = WallTime::now();
+    record.lastAccess = record.responseTimestamp;
+    m_statistics.validations++;
+    scheduleIndexWrite();
+    return record.response;
+}
+
+void DiskCacheJava::remove(const ResourceRequest& request)
+{
+    ASSERT(isMainThread());
+    String key = computeKey(request);
+    if (!m_records.contains(key))
+        return;
+    removeRecord(key);
+    scheduleIndexWrite();
+}
+
+String DiskCacheJava::computeKey(const ResourceRequest& request)
+{
+    SHA1 sha1;
+    sha1.addBytes(cacheURL(request).utf8());
+    return String(sha1.computeHexDigest().data());
+}
+
+String DiskCacheJava::bodyPath(const String& key) const
+{
+    return FileSystem::pathByAppendingComponent(m_directory, makeString(key, bodyFileExtension));
+}
+
+void DiskCacheJava::loadIndex()
+{
+    auto data = FileSystem::readEntireFile(FileSystem::pathByAppendingComponent(m_directory, indexFileName));
+    if (!data)
+        return;
+
+    WTF::Persistence::Decoder decoder({ data->data(), data->size() });
+    std::optional<uint32_t> version;
+    decoder >> version;
+    std::optional<uint64_t> count;
+    decoder >> count;
+    if (!version || *version != indexVersion || !count)
+        return;
+
+    HashMap<String, Record> records;
+    for (uint64_t i = 0; i < *count; i++) {
+        std::optional<String> key;
+        decoder >> key;
+        std::optional<String> url;
+        decoder >> url;
+        std::optional<WallTime> responseTimestamp;
+        decoder >> responseTimestamp;
+        std::optional<WallTime> lastAccess;
+        decoder >> lastAccess;
+        std::optional<uint64_t> bodySize;
+        decoder >> bodySize;
+        std::optional<Vector<std::pair<String, String>>> varyingHeaders;
+        decoder >> varyingHeaders;
+        if (!key || !url || !responseTimestamp || !lastAccess || !bodySize || !varyingHeaders)
+            return;
+        auto response = decodeResponse(decoder);
+        if (!response)
+            return;
+        records.set(*key, Record { WTFMove(*url), WTFMove(*response), *responseTimestamp, WTFMove(*varyingHeaders), *bodySize, *lastAccess });
+    }
+    if (!decoder.verifyChecksum())
+        return;
+
+    for (auto& entry : records) {
+        if (FileSystem::fileSize(bodyPath(entry.key)) == entry.value.bodySize)
+            insert(entry.key, WTFMove(entry.value));
+    }
+}
+
+void DiskCacheJava::removeUnknownFiles()
+{
+    // Bodies written after the index was last saved, or left behind by an
+    // interrupted write, are not accounted for and would never be evicted.
+    HashSet<String> fileNames;
+    fileNames.add(String(indexFileName));
+    for (const auto& key : m_records.keys())
+        fileNames.add(makeString(key, bodyFileExtension).isolatedCopy());
+
+    m_ioQueue->dispatch([directory = m_directory.isolatedCopy(), fileNames = WTFMove(fileNames)] {
+        for (auto& fileName : FileSystem::listDirectory(directory)) {
+            if (!fileNames.contains(fileName))
+                FileSystem::deleteFile(FileSystem::pathByAppendingComponent(directory, fileName));
+        }
+    });
+}
+
+void DiskCacheJava::scheduleIndexWrite()
+{
+    if (isEnabled() && !m_writeIndexTimer.isActive())
+        m_writeIndexTimer.startOneShot(writeIndexDelay);
+}
+
+void DiskCacheJava::writeIndex()
+{
+    if (!isEnabled())
+        return;
+
+    WTF::Persistence::Encoder encoder;
+    encoder << indexVersion;
+    encoder << static_cast<uint64_t>(m_records.size());
+    for (const auto& entry : m_records) {
+        const auto& record = entry.value;
+        encoder << entry.key;
+        encoder << record.url;
+        encoder << record.responseTimestamp;
+        encoder << record.lastAccess;
+        encoder << record.bodySize;
+        encoder << record.varyingRequestHeaders;
+        encodeResponse(encoder, record.response);
+    }
+    encoder.encodeChecksum();
+
+    Vector<uint8_t> data(encoder.buffer(), encoder.bufferSize());
+    m_ioQueue->dispatch([path = FileSystem::pathByAppendingComponent(m_directory, indexFileName).isolatedCopy(), data = WTFMove(data)] {
+        String temporaryPath = makeString(path, temporaryFileExtension);
+        auto handle = FileSystem::openFile(temporaryPath, FileSystem::FileOpenMode::Write);
+        if (!FileSystem::isHandleValid(handle))
+            return;
+        bool written = FileSystem::writeToFile(handle, data.data(), data.size()) == static_cast<int>(data.size());
+        FileSystem::closeFile(handle);
+        if (!written || !FileSystem::moveFile(temporaryPath, path))
+            FileSystem::deleteFile(temporaryPath);
+    });
+}
+
+void DiskCacheJava::insert(const String& key, Record&& record)
+{
+    auto it = m_records.find(key);
+    if (it != m_records.end())
+        m_size -= it->value.bodySize;
+    m_size += record.bodySize;
+    m_records.set(key, WTFMove(record));
+}
+
+void DiskCacheJava::removeRecord(const String& key)
+{
+    auto record = m_records.take(key);
+    m_size -= record.bodySize;
+    m_ioQueue->dispatch([path = bodyPath(key).isolatedCopy()] {
+        FileSystem::deleteFile(path);
+    });
+}
+
+void DiskCacheJava::shrink()
+{
+    if (m_size <= m_capacity)
+        return;
+
+    // Evict the least recently used entries down to 90% of the capacity,
+    // so that the next few stores do not each trigger an eviction.
+    Vector<std::pair<WallTime, String>> entries;
+    for (const auto& entry : m_records)
+        entries.append({ entry.value.lastAccess, entry.key });
+    std::sort(entries.begin(), entries.end());
+
+    uint64_t targetSize = m_capacity - m_capacity / 10;
+    for (const auto& entry : entries) {
+        if (m_size <= targetSize)
+            break;
+        removeRecord(entry.second);
+    }
+    scheduleIndexWrite();
+}
+
+} // namespace WebCore
+
+using namespace WebCore;
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_DiskCache_twkSetDirectory
+  (JNIEnv* env, jclass, jstring directory, jlong capacity)
+{
+    ASSERT(isMainThread());
+    ASSERT(capacity >= 0);
+    DiskCacheJava::singleton().setDirectory(String(env, directory), capacity);
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_DiskCache_twkClear
+  (JNIEnv*, jclass)
+{
+    ASSERT(isMainThread());
+    DiskCacheJava::singleton().clear();
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_DiskCache_twkGetSize
+  (JNIEnv*, jclass)
+{
+    return DiskCacheJava::singleton().size();
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_DiskCache_twkGetHitCount
+  (JNIEnv*, jclass)
+{
+    return DiskCacheJava::singleton().statistics().hits;
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_DiskCache_twkGetMissCount
+  (JNIEnv*, jclass)
+{
+    return DiskCacheJava::singleton().statistics().misses;
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_DiskCache_twkGetValidationCount
+  (JNIEnv*, jclass)
+{
+    return DiskCacheJava::singleton().statistics().validations;
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_DiskCache_twkGetStoreCount
+  (JNIEnv*, jclass)
+{
+    return DiskCacheJava::singleton().statistics().stores;
+}
+
+}
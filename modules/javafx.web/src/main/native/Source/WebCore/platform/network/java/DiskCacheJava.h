@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include "ResourceResponse.h"
+#include "SharedBuffer.h"
+#include "Timer.h"
+#include <wtf/HashMap.h>
+#include <wtf/HashSet.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/WallTime.h>
+#include <wtf/WorkQueue.h>
+#include <wtf/text/StringHash.h>
+
+namespace WebCore {
+
+class ResourceRequest;
+
+// A persistent HTTP cache sitting between WebCore and the Java network
+// stack. Responses are kept in an index that is written to
+// <directory>/index, bodies in one file per entry that is mapped into memory
+// when the entry is used. The cache is disabled until a directory is set.
+class DiskCacheJava {
+    WTF_MAKE_NONCOPYABLE(DiskCacheJava); WTF_MAKE_FAST_ALLOCATED;
+    friend NeverDestroyed<DiskCacheJava>;
+public:
+    static DiskCacheJava& singleton();
+
+    struct Entry {
+        ResourceResponse response;
+        Ref<SharedBuffer> body;
+        bool needsValidation { false };
+    };
+
+    struct Statistics {
+        uint64_t hits { 0 };
+        uint64_t misses { 0 };
+        uint64_t validations { 0 };
+        uint64_t stores { 0 };
+    };
+
+    // An empty directory disables the cache. Entries already stored in
+    // the directory are reused.
+    void setDirectory(const String& directory, uint64_t capacity);
+    bool isEnabled() const { return !m_directory.isNull(); }
+    const String& directory() const { return m_directory; }
+    uint64_t capacity() const { return m_capacity; }
+    uint64_t size() const { return m_size; }
+    uint64_t maximumEntrySize() const { return m_capacity / maximumEntryCapacityFraction; }
+    const Statistics& statistics() const { return m_statistics; }
+    void clear();
+
+    // Whether the response to the request may come from, or go to, the
+    // cache at all.
+    static bool canUseCache(const ResourceRequest&);
+    static bool isStorable(const ResourceRequest&, const ResourceResponse&);
+
+    std::optional<Entry> retrieve(const ResourceRequest&);
+    static void addValidationHeaders(ResourceRequest&, const ResourceResponse&);
+    void store(const ResourceRequest&, const ResourceResponse&, WallTime responseTimestamp, Vector<uint8_t>&& body);
+    // Refreshes the stored response with the headers of a 304 response
+    // and returns the merged response, if the request has an entry.
+    std::optional<ResourceResponse> update(const ResourceRequest&, const ResourceResponse& validatingResponse);
+    void remove(const ResourceRequest&);
+
+private:
+    struct Record {
+        String url;
+        ResourceResponse response;
+        WallTime responseTimestamp;
+        Vector<std::pair<String, String>> varyingRequestHeaders;
+        uint64_t bodySize { 0 };
+        WallTime lastAccess;
+    };
+
+    // No single entry may take more than this share of the capacity.
+    static constexpr uint64_t maximumEntryCapacityFraction = 8;
+
+    DiskCacheJava();
+
+    static String computeKey(const ResourceRequest&);
+    String bodyPath(const String& key) const;
+    void loadIndex();
+    void removeUnknownFiles();
+    void scheduleIndexWrite();
+    void writeIndex();
+    void insert(const String& key, Record&&);
+    void removeRecord(const String& key);
+    void shrink();
+
+    String m_directory;
+    uint64_t m_capacity { 0 };
+    uint64_t m_size { 0 };
+    HashMap<String, Record> m_records;
+    // Records whose body is still being written, by write. Two stores of
+    // the same key can be in flight at once, so only the latest write of
+    // each key is inserted when it completes.
+    HashMap<uint64_t, Record> m_pendingRecords;
+    HashMap<String, uint64_t> m_latestWrites;
+    uint64_t m_lastWriteID { 0 };
+    // Changes whenever the cache is cleared or moved, to drop the writes
+    // started before.
+    uint64_t m_generation { 0 };
+    Statistics m_statistics;
+    Ref<WorkQueue> m_ioQueue;
+    Timer m_writeIndexTimer;
+};
+
+} // namespace WebCore
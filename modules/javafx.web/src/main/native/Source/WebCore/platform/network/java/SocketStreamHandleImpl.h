@@ -55,6 +55,7 @@ public:
 
     void didOpen();
     void didReceiveData(const uint8_t* data, int length);
+    void didSendData(uint64_t sentByteCount);
     void didFail(int errorCode, const String& errorDescription);
     void didClose();
 
@@ -64,13 +65,28 @@ protected:
     void platformSendHandshake(const uint8_t* data, size_t length, const std::optional<CookieRequestHeaderFieldProxy>&, Function<void(bool, bool)>&&) final;
     void platformClose() final;
     size_t bufferedAmount() final;
+    size_t platformBufferedAmount() const { return static_cast<size_t>(m_sendQueued - m_sendWritten); }
     bool sendPendingData();
 
 private:
     SocketStreamHandleImpl(const URL&, Page*, SocketStreamHandleClient&, const StorageSessionProvider*);
 
+    void scheduleFlush();
+    void flush();
+
     RefPtr<const StorageSessionProvider> m_storageSessionProvider;
     JGObject m_ref;
+
+    // Outgoing bytes are copied into a ring buffer owned by the Java
+    // peer and handed over in batches. The counters only grow, their
+    // difference modulo the ring size gives the positions.
+    JGObject m_sendByteBuffer;
+    uint8_t* m_sendBuffer { nullptr };
+    size_t m_sendBufferSize { 0 };
+    uint64_t m_sendQueued { 0 };
+    uint64_t m_sendFlushed { 0 };
+    uint64_t m_sendWritten { 0 };
+    bool m_flushScheduled { false };
     StreamBuffer<uint8_t, 1024 * 1024> m_buffer;
     static const unsigned maxBufferSize = 100 * 1024 * 1024;
 };
@@ -30,6 +30,7 @@
 #include "SocketStreamError.h"
 #include "SocketStreamHandleClient.h"
 #include "com_sun_webkit_network_SocketStreamHandle.h"
+#include <wtf/MainThread.h>
 #include <wtf/java/JavaEnv.h>
 
 namespace WebCore {
@@ -68,7 +69,20 @@ SocketStreamHandleImpl::SocketStreamHandleImpl(const URL& url, Page* page,
             bool_to_jbool(ssl),
             (jobject) PageSupplementJava::from(page)->jWebPage(),
             ptr_to_jlong(this)));
-    WTF::CheckAndClearException(env);
+    if (WTF::CheckAndClearException(env) || !m_ref)
+        return;
+
+    static jmethodID getSendBufferMID = env->GetMethodID(
+            GetSocketStreamHandleClass(env),
+            "fwkGetSendBuffer",
+            "()Ljava/nio/ByteBuffer;");
+    ASSERT(getSendBufferMID);
+
+    m_sendByteBuffer = JLObject(env->CallObjectMethod(m_ref, getSendBufferMID));
+    if (WTF::CheckAndClearException(env) || !m_sendByteBuffer)
+        return;
+    m_sendBuffer = static_cast<uint8_t*>(env->GetDirectBufferAddress(m_sendByteBuffer));
+    m_sendBufferSize = static_cast<size_t>(env->GetDirectBufferCapacity(m_sendByteBuffer));
 }
 
 SocketStreamHandleImpl::~SocketStreamHandleImpl()
@@ -87,26 +101,51 @@ SocketStreamHandleImpl::~SocketStreamHandleImpl()
 
 std::optional<size_t> SocketStreamHandleImpl::platformSendInternal(const uint8_t* data, size_t len)
 {
-    JNIEnv* env = WTF::GetJavaEnv();
+    if (!m_sendBuffer)
+        return { };
 
-    JLByteArray byteArray = env->NewByteArray(len);
-    env->SetByteArrayRegion(
-            (jbyteArray) byteArray,
-            (jsize) 0,
-            (jsize) len,
-            (const jbyte*) data);
+    // Whatever does not fit in the ring stays in m_buffer and is moved
+    // over by sendPendingData() once the Java peer reports progress.
+    size_t count = std::min(len, m_sendBufferSize - platformBufferedAmount());
+    size_t offset = static_cast<size_t>(m_sendQueued % m_sendBufferSize);
+    size_t head = std::min(count, m_sendBufferSize - offset);
+    memcpy(m_sendBuffer + offset, data, head);
+    memcpy(m_sendBuffer, data + head, count - head);
+    m_sendQueued += count;
+
+    if (count)
+        scheduleFlush();
+    return { count };
+}
+
+// Frames sent during the same run loop iteration are flushed together.
+void SocketStreamHandleImpl::scheduleFlush()
+{
+    if (m_flushScheduled)
+        return;
+    m_flushScheduled = true;
+    callOnMainThread([protectedThis = Ref { *this }] {
+        protectedThis->m_flushScheduled = false;
+        protectedThis->flush();
+    });
+}
+
+void SocketStreamHandleImpl::flush()
+{
+    if (m_sendFlushed == m_sendQueued || m_state == Closed)
+        return;
+
+    JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(
             GetSocketStreamHandleClass(env),
-            "fwkSend",
-            "([B)I");
+            "fwkFlush",
+            "(J)V");
     ASSERT(mid);
 
-    jint res = env->CallIntMethod(m_ref, mid, (jbyteArray) byteArray);
-    if (WTF::CheckAndClearException(env)) {
-        return { };
-    }
-    return { static_cast<size_t>(res) };
+    env->CallVoidMethod(m_ref, mid, static_cast<jlong>(m_sendQueued));
+    WTF::CheckAndClearException(env);
+    m_sendFlushed = m_sendQueued;
 }
 
 void SocketStreamHandleImpl::platformClose()
@@ -136,6 +175,23 @@ void SocketStreamHandleImpl::didReceiveData(const uint8_t* data, int length)
     m_client.didReceiveSocketStreamData(*this, data, length);
 }
 
+void SocketStreamHandleImpl::didSendData(uint64_t sentByteCount)
+{
+    m_sendWritten = sentByteCount;
+    if (m_state != Open && m_state != Closing)
+        return;
+
+    if (!m_buffer.isEmpty()) {
+        sendPendingData();
+        return;
+    }
+    if (m_state == Closing && !platformBufferedAmount()) {
+        disconnect();
+        return;
+    }
+    m_client.didUpdateBufferedAmount(*this, bufferedAmount());
+}
+
 void SocketStreamHandleImpl::didFail(int errorCode, const String& errorDescription)
 {
     if (m_state == Open) {
@@ -170,15 +226,25 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_SocketStreamHandle_twkDidOpen
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_SocketStreamHandle_twkDidReceiveData
-  (JNIEnv* env, jclass, jbyteArray buffer, jint len, jlong data)
+  (JNIEnv* env, jclass, jobject byteBuffer, jint position, jint length, jlong data)
+{
+    using namespace WebCore;
+    SocketStreamHandleImpl* handle =
+            static_cast<SocketStreamHandleImpl*>(jlong_to_ptr(data));
+    ASSERT(handle);
+    const uint8_t* address =
+            static_cast<const uint8_t*>(env->GetDirectBufferAddress(byteBuffer));
+    handle->didReceiveData(address + position, length);
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_SocketStreamHandle_twkDidSendData
+  (JNIEnv*, jclass, jlong sentByteCount, jlong data)
 {
     using namespace WebCore;
     SocketStreamHandleImpl* handle =
             static_cast<SocketStreamHandleImpl*>(jlong_to_ptr(data));
     ASSERT(handle);
-    jbyte* p = env->GetByteArrayElements(buffer, NULL);
-    handle->didReceiveData((const uint8_t*) p, len);
-    env->ReleaseByteArrayElements(buffer, p, JNI_ABORT);
+    handle->didSendData(static_cast<uint64_t>(sentByteCount));
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_SocketStreamHandle_twkDidFail
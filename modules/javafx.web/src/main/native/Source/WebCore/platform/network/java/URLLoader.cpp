@@ -127,17 +127,58 @@ std::unique_ptr<URLLoader> URLLoader::loadAsynchronously(NetworkingContext* cont
 {
     std::unique_ptr<URLLoader> result = std::unique_ptr<URLLoader>(new URLLoader());
     result->m_target = std::unique_ptr<AsynchronousTarget>(new AsynchronousTarget(handle));
+
+    ResourceRequest networkRequest = request;
+    auto& diskCache = DiskCacheJava::singleton();
+    if (diskCache.isEnabled() && DiskCacheJava::canUseCache(request)) {
+        auto cachedEntry = diskCache.retrieve(request);
+        if (cachedEntry && !cachedEntry->needsValidation) {
+            // Deliver from the event loop, as a network load would.
+            result->m_cachedEntry = WTFMove(cachedEntry);
+            result->m_cachedEntryTimer.startOneShot(0_s);
+            return result;
+        }
+        if (cachedEntry) {
+            DiskCacheJava::addValidationHeaders(networkRequest, cachedEntry->response);
+        }
+        result->m_target = std::unique_ptr<CachingTarget>(new CachingTarget(
+                WTFMove(result->m_target),
+                request,
+                WTFMove(cachedEntry)));
+    }
+
     result->m_ref = load(
             true,
             context,
-            request,
+            networkRequest,
             result->m_target.get());
     return result;
 }
 
+void URLLoader::deliverCachedEntry()
+{
+    auto cachedEntry = std::exchange(m_cachedEntry, std::nullopt);
+    ASSERT(cachedEntry);
+
+    // The client may cancel the load, and so delete this loader, from
+    // any of the callbacks.
+    WeakPtr weakThis { *this };
+    m_target->didReceiveResponse(cachedEntry->response);
+    if (!weakThis) {
+        return;
+    }
+    m_target->didReceiveData(cachedEntry->body.ptr(), cachedEntry->body->size());
+    if (!weakThis) {
+        return;
+    }
+    m_target->didFinishLoading();
+}
+
 void URLLoader::cancel()
 {
     using namespace URLLoaderJavaInternal;
+    m_cachedEntryTimer.stop();
+    m_cachedEntry = std::nullopt;
     if (m_ref) {
         JNIEnv* env = WTF::GetJavaEnv();
         initRefs(env);
@@ -155,8 +196,29 @@ void URLLoader::loadSynchronously(NetworkingContext* context,
                                   ResourceResponse& response,
                                   Vector<uint8_t>& data)
 {
-    SynchronousTarget target(request, error, response, data);
-    load(false, context, request, &target);
+    auto& diskCache = DiskCacheJava::singleton();
+    if (!diskCache.isEnabled() || !DiskCacheJava::canUseCache(request)) {
+        SynchronousTarget target(request, error, response, data);
+        load(false, context, request, &target);
+        return;
+    }
+
+    auto target = std::unique_ptr<SynchronousTarget>(
+            new SynchronousTarget(request, error, response, data));
+    auto cachedEntry = diskCache.retrieve(request);
+    if (cachedEntry && !cachedEntry->needsValidation) {
+        target->didReceiveResponse(cachedEntry->response);
+        target->didReceiveData(cachedEntry->body.ptr(), cachedEntry->body->size());
+        target->didFinishLoading();
+        return;
+    }
+
+    ResourceRequest networkRequest = request;
+    if (cachedEntry) {
+        DiskCacheJava::addValidationHeaders(networkRequest, cachedEntry->response);
+    }
+    CachingTarget cachingTarget(WTFMove(target), request, WTFMove(cachedEntry));
+    load(false, context, networkRequest, &cachingTarget);
 }
 
 JLObject URLLoader::load(bool asynchronous,
@@ -377,6 +439,90 @@ void URLLoader::SynchronousTarget::didFail(const ResourceError& error)
     m_response.setHTTPStatusCode(404);
 }
 
+URLLoader::CachingTarget::CachingTarget(std::unique_ptr<Target>&& target,
+                                        const ResourceRequest& request,
+                                        std::optional<DiskCacheJava::Entry>&& cachedEntry)
+    : m_target(WTFMove(target))
+    , m_request(request)
+    , m_cachedEntry(WTFMove(cachedEntry))
+{
+}
+
+void URLLoader::CachingTarget::didSendData(long totalBytesSent,
+                                           long totalBytesToBeSent)
+{
+    m_target->didSendData(totalBytesSent, totalBytesToBeSent);
+}
+
+bool URLLoader::CachingTarget::willSendRequest(const ResourceResponse& response)
+{
+    // Entries are keyed on the requested URL, which the final response of
+    // a redirect chain does not answer.
+    m_redirected = true;
+    return m_target->willSendRequest(response);
+}
+
+void URLLoader::CachingTarget::didReceiveResponse(
+        const ResourceResponse& response)
+{
+    auto& diskCache = DiskCacheJava::singleton();
+    if (response.isNotModified()) {
+        auto updatedResponse = diskCache.update(m_request, response);
+        if (m_cachedEntry && updatedResponse) {
+            // Our own revalidation: the body follows from the cache once
+            // the Java loader finishes.
+            m_notModified = true;
+            m_target->didReceiveResponse(*updatedResponse);
+            return;
+        }
+        m_target->didReceiveResponse(response);
+        return;
+    }
+
+    m_response = response;
+    m_responseTimestamp = WallTime::now();
+    m_shouldStore = !m_redirected && DiskCacheJava::isStorable(m_request, response);
+    if (!m_shouldStore) {
+        diskCache.remove(m_request);
+    }
+    m_target->didReceiveResponse(response);
+}
+
+void URLLoader::CachingTarget::didReceiveData(const SharedBuffer* data, int length)
+{
+    if (m_notModified) {
+        return;
+    }
+    if (m_shouldStore) {
+        m_data.append(data->data(), length);
+        if (m_data.size() > DiskCacheJava::singleton().maximumEntrySize()) {
+            m_shouldStore = false;
+            m_data.clear();
+        }
+    }
+    m_target->didReceiveData(data, length);
+}
+
+void URLLoader::CachingTarget::didFinishLoading()
+{
+    if (m_notModified) {
+        // The client may cancel the load, and so delete this target.
+        WeakPtr weakThis { *this };
+        m_target->didReceiveData(m_cachedEntry->body.ptr(), m_cachedEntry->body->size());
+        if (!weakThis) {
+            return;
+        }
+    } else if (m_shouldStore) {
+        DiskCacheJava::singleton().store(m_request, m_response, m_responseTimestamp, WTFMove(m_data));
+    }
+    m_target->didFinishLoading();
+}
+
+void URLLoader::CachingTarget::didFail(const ResourceError& error)
+{
+    m_target->didFail(error);
+}
+
 } // namespace WebCore
 
 static WebCore::ResourceResponse setupResponse(JNIEnv* env,
@@ -436,9 +582,24 @@ static WebCore::ResourceResponse setupResponse(JNIEnv* env,
     URL kurl = URL(URL(), String(env, url));
     response.setURL(kurl);
 
-    // Setup mime type for local resources
-    if (/*kurl.hasPath()*/kurl.pathEnd() != kurl.pathStart() && kurl.protocol() == String("file")) {
-        response.setMimeType(MIMETypeRegistry::mimeTypeForPath(kurl.path().toString()));
+    // Setup mime type for local resources, including those the application
+    // loads from its class path. The type reported by the Java URLConnection
+    // comes from the JDK's file name map, which the application can replace
+    // with URLConnection.setFileNameMap(), so it takes precedence. The native
+    // extension table answers for the extensions that map does not know,
+    // such as .wasm, for which WebAssembly streaming compilation requires
+    // application/wasm.
+    if (/*kurl.hasPath()*/kurl.pathEnd() != kurl.pathStart()
+            && (kurl.protocolIs("file") || kurl.protocolIs("jar") || kurl.protocolIs("jrt"))
+            && (String(env, contentType).isEmpty()
+                || equalLettersIgnoringASCIICase(response.mimeType(), "content/unknown"))) {
+        auto path = kurl.path();
+        size_t dot = path.reverseFind('.');
+        String mimeType;
+        if (dot != notFound && path.find('/', dot) == notFound) {
+            mimeType = MIMETypeRegistry::mimeTypeForExtension(path.substring(dot + 1).toString());
+        }
+        response.setMimeType(mimeType.isEmpty() ? defaultMIMEType() : mimeType);
     }
     return response;
 }
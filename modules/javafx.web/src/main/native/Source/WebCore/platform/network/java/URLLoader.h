@@ -25,8 +25,12 @@
 
 #pragma once
 
+#include "DiskCacheJava.h"
+#include "ResourceRequest.h"
+#include "Timer.h"
 #include <wtf/java/JavaRef.h>
 #include <wtf/Vector.h>
+#include <wtf/WeakPtr.h>
 #include <wtf/text/WTFString.h>
 
 namespace WebCore {
@@ -35,10 +39,8 @@ class FormData;
 class NetworkingContext;
 class ResourceError;
 class ResourceHandle;
-class ResourceRequest;
-class ResourceResponse;
 
-class URLLoader {
+class URLLoader : public CanMakeWeakPtr<URLLoader> {
 public:
     static std::unique_ptr<URLLoader> loadAsynchronously(NetworkingContext* context,
                                                     ResourceHandle* handle,
@@ -71,6 +73,7 @@ private:
                          const ResourceRequest& request,
                          Target* target);
     static JLObjectArray toJava(const FormData* formData);
+    void deliverCachedEntry();
 
     class AsynchronousTarget : public Target {
     public:
@@ -106,8 +109,36 @@ private:
         Vector<uint8_t>& m_data;
     };
 
+    // Stores the response in the disk cache, or completes the load from
+    // the cache when the server answers a revalidation with 304.
+    class CachingTarget : public Target, public CanMakeWeakPtr<CachingTarget> {
+    public:
+        CachingTarget(std::unique_ptr<Target>&& target,
+                      const ResourceRequest& request,
+                      std::optional<DiskCacheJava::Entry>&& cachedEntry);
+
+        void didSendData(long totalBytesSent, long totalBytesToBeSent) final;
+        bool willSendRequest(const ResourceResponse& response) final;
+        void didReceiveResponse(const ResourceResponse& response) final;
+        void didReceiveData(const SharedBuffer* data, int length) final;
+        void didFinishLoading() final;
+        void didFail(const ResourceError& error) final;
+    private:
+        std::unique_ptr<Target> m_target;
+        ResourceRequest m_request;
+        std::optional<DiskCacheJava::Entry> m_cachedEntry;
+        ResourceResponse m_response;
+        WallTime m_responseTimestamp;
+        Vector<uint8_t> m_data;
+        bool m_redirected { false };
+        bool m_shouldStore { false };
+        bool m_notModified { false };
+    };
+
     JGObject m_ref;
-    std::unique_ptr<AsynchronousTarget> m_target;
+    std::unique_ptr<Target> m_target;
+    std::optional<DiskCacheJava::Entry> m_cachedEntry;
+    Timer m_cachedEntryTimer { *this, &URLLoader::deliverCachedEntry };
 };
 
 } // namespace WebCore
@@ -118,6 +118,8 @@ list(APPEND WebKitLegacy_SOURCES
 
     java/WebCoreSupport/ColorChooserJava.cpp
     java/WebCoreSupport/ContextMenuClientJava.cpp
+    java/WebCoreSupport/DamageTracker.cpp
+    java/WebCoreSupport/DisplayListCache.cpp
     java/WebCoreSupport/PopupMenuJava.cpp
     java/WebCoreSupport/SearchPopupMenuJava.cpp
     java/WebCoreSupport/DragClientJava.cpp
@@ -131,6 +133,10 @@ list(APPEND WebKitLegacy_SOURCES
     java/WebCoreSupport/ChromeClientJava.cpp
     java/WebCoreSupport/BackForwardList.cpp
     java/WebCoreSupport/PageCacheJava.cpp
+    java/WebCoreSupport/MemoryCacheJava.cpp
+    java/WebCoreSupport/JSEngineJava.cpp
+    java/WebCoreSupport/JSProfilerJava.cpp
+    java/WebCoreSupport/MemoryPressureJava.cpp
 
     java/storage/WebDatabaseProviderJava.cpp
 )
@@ -43,6 +43,18 @@ namespace WebKit {
 // Instead, queue up a batch of items to sync and actually do the sync at the following interval.
 static const Seconds StorageSyncInterval { 1_s };
 
+// Under a sustained write storm the interval is doubled per busy interval, up to this cap,
+// so that a page rewriting the same keys in a loop does not turn into one transaction per second.
+static const Seconds MaxStorageSyncInterval { 8_s };
+
+// Number of changes within one interval above which the interval backs off. It relaxes back
+// towards StorageSyncInterval once fewer than a quarter of this many changes are seen.
+static const unsigned StorageSyncBackoffThreshold = 100;
+
+// Number of rows read by performImport() before they are made visible to the main thread
+// and pending point lookups are serviced.
+static const unsigned ImportBatchSize = 256;
+
 // A sane limit on how many items we'll schedule to sync all at once.  This makes it
 // much harder to starve the rest of LocalStorage and the OS's IO subsystem in general.
 static const int MaxiumItemsToSync = 100;
@@ -50,6 +62,7 @@ static const int MaxiumItemsToSync = 100;
 inline StorageAreaSync::StorageAreaSync(RefPtr<StorageSyncManager>&& storageSyncManager, Ref<StorageAreaImpl>&& storageArea, const String& databaseIdentifier)
     : m_syncTimer(*this, &StorageAreaSync::syncTimerFired)
     , m_itemsCleared(false)
+    , m_syncInterval(StorageSyncInterval)
     , m_finalSyncScheduled(false)
     , m_storageArea(WTFMove(storageArea))
     , m_syncManager(WTFMove(storageSyncManager))
@@ -116,8 +129,9 @@ void StorageAreaSync::scheduleItemForSync(const String& key, const String& value
     ASSERT(!m_finalSyncScheduled);
 
     m_changedItems.set(key, value);
+    ++m_itemsChangedSinceLastSync;
     if (!m_syncTimer.isActive()) {
-        m_syncTimer.startOneShot(StorageSyncInterval);
+        startSyncTimer();
 
         // The following is balanced by the call to enableSuddenTermination in the
         // syncTimerFired function.
@@ -132,8 +146,9 @@ void StorageAreaSync::scheduleClear()
 
     m_changedItems.clear();
     m_itemsCleared = true;
+    ++m_itemsChangedSinceLastSync;
     if (!m_syncTimer.isActive()) {
-        m_syncTimer.startOneShot(StorageSyncInterval);
+        startSyncTimer();
 
         // The following is balanced by the call to enableSuddenTermination in the
         // syncTimerFired function.
@@ -152,7 +167,7 @@ void StorageAreaSync::scheduleCloseDatabase()
     m_syncCloseDatabase = true;
 
     if (!m_syncTimer.isActive()) {
-        m_syncTimer.startOneShot(StorageSyncInterval);
+        startSyncTimer();
 
         // The following is balanced by the call to enableSuddenTermination in the
         // syncTimerFired function.
@@ -160,6 +175,25 @@ void StorageAreaSync::scheduleCloseDatabase()
     }
 }
 
+void StorageAreaSync::startSyncTimer()
+{
+    ASSERT(isMainThread());
+    ASSERT(!m_syncTimer.isActive());
+    m_syncTimer.startOneShot(m_syncInterval);
+}
+
+void StorageAreaSync::updateSyncInterval(unsigned itemsInInterval)
+{
+    ASSERT(isMainThread());
+
+    if (itemsInInterval >= StorageSyncBackoffThreshold)
+        m_syncInterval = std::min(m_syncInterval * 2, MaxStorageSyncInterval);
+    else if (itemsInInterval < StorageSyncBackoffThreshold / 4)
+        m_syncInterval = std::max(m_syncInterval / 2, StorageSyncInterval);
+
+    StorageTracker::tracker().didUpdateSyncInterval(m_databaseIdentifier, m_syncInterval);
+}
+
 void StorageAreaSync::syncTimerFired()
 {
     ASSERT(isMainThread());
@@ -171,11 +205,13 @@ void StorageAreaSync::syncTimerFired()
         // Do not schedule another sync if we're still trying to complete the
         // previous one. But, if we're shutting down, schedule it anyway.
         if (m_syncInProgress && !m_finalSyncScheduled) {
-            ASSERT(!m_syncTimer.isActive());
-            m_syncTimer.startOneShot(StorageSyncInterval);
+            startSyncTimer();
             return;
         }
 
+        if (!m_finalSyncScheduled)
+            updateSyncInterval(std::exchange(m_itemsChangedSinceLastSync, 0));
+
         if (m_itemsCleared) {
             m_itemsPendingSync.clear();
             m_clearItemsWhileSyncing = true;
@@ -218,8 +254,7 @@ void StorageAreaSync::syncTimerFired()
 
     if (partialSync) {
         // If we didn't finish syncing, then we need to finish the job later.
-        ASSERT(!m_syncTimer.isActive());
-        m_syncTimer.startOneShot(StorageSyncInterval);
+        startSyncTimer();
     } else {
         // The following is balanced by the calls to disableSuddenTermination in the
         // scheduleItemForSync, scheduleClear, and scheduleFinalSync functions.
@@ -320,6 +355,8 @@ void StorageAreaSync::performImport()
     ASSERT(!isMainThread());
     ASSERT(!m_database.isOpen());
 
+    m_importStartTime = MonotonicTime::now();
+
     openDatabase(SkipIfNonExistent);
     if (!m_database.isOpen()) {
         markImported();
@@ -333,39 +370,134 @@ void StorageAreaSync::performImport()
         return;
     }
 
-    HashMap<String, String> itemMap;
+    // Read the table in batches so that a main thread waiting in itemBeforeImportComplete()
+    // sees items as soon as they are read, and can have a point lookup serviced in between.
+    Vector<std::pair<String, String>> batch;
+    performPendingLookups();
 
     int result = query->step();
     while (result == SQLITE_ROW) {
-        itemMap.set(query->columnText(0), query->columnBlobAsString(1));
+        batch.append({ query->columnText(0), query->columnBlobAsString(1) });
+        if (batch.size() >= ImportBatchSize) {
+            publishImportedItems(batch);
+            performPendingLookups();
+        }
         result = query->step();
     }
 
-    if (result != SQLITE_DONE) {
+    if (result != SQLITE_DONE)
         LOG_ERROR("Error reading items from ItemTable for local storage");
-        markImported();
+
+    // Even on error, keep what was read: some of it may already have been handed out.
+    publishImportedItems(batch);
+    markImported();
+}
+
+void StorageAreaSync::publishImportedItems(Vector<std::pair<String, String>>& items)
+{
+    ASSERT(!isMainThread());
+
+    if (items.isEmpty())
+        return;
+
+    Locker locker { m_importLock };
+    for (auto& item : items)
+        m_importedItems.set(WTFMove(item.first), WTFMove(item.second));
+    items.clear();
+    m_importCondition.notifyAll();
+}
+
+void StorageAreaSync::performPendingLookups()
+{
+    ASSERT(!isMainThread());
+
+    HashSet<String> keys;
+    {
+        Locker locker { m_importLock };
+        if (m_pendingLookups.isEmpty())
+            return;
+        keys = std::exchange(m_pendingLookups, { });
+    }
+
+    auto lookup = m_database.prepareStatement("SELECT value FROM ItemTable WHERE key=?"_s);
+    if (!lookup) {
+        // The main thread keeps waiting and is released when the import completes.
+        LOG_ERROR("Unable to prepare item lookup for local storage");
         return;
     }
 
-    m_storageArea->importItems(WTFMove(itemMap));
+    Vector<std::pair<String, String>> found;
+    Vector<String> absent;
+    while (!keys.isEmpty()) {
+        auto key = keys.takeAny();
+        lookup->bindText(1, key);
+        if (lookup->step() == SQLITE_ROW)
+            found.append({ WTFMove(key), lookup->columnBlobAsString(0) });
+        else
+            absent.append(WTFMove(key));
+        lookup->reset();
+    }
 
-    markImported();
+    // Move the strings, so that none of them is still referenced by this thread once the
+    // main thread can see them.
+    Locker locker { m_importLock };
+    for (auto& item : found)
+        m_importedItems.set(WTFMove(item.first), WTFMove(item.second));
+    for (auto& key : absent)
+        m_keysAbsentFromDatabase.add(WTFMove(key));
+    m_importCondition.notifyAll();
 }
 
 void StorageAreaSync::markImported()
 {
+    unsigned itemCount;
+    {
+        Locker locker { m_importLock };
+        if (m_importComplete)
+            return;
+        itemCount = m_importedItems.size();
+        if (!m_importedItems.isEmpty())
+            m_storageArea->importItems(std::exchange(m_importedItems, { }));
+        m_keysAbsentFromDatabase.clear();
+        m_pendingLookups.clear();
+        m_importComplete = true;
+        m_importCondition.notifyAll();
+    }
+
+    StorageTracker::tracker().didImportOrigin(m_databaseIdentifier, MonotonicTime::now() - m_importStartTime, itemCount);
+}
+
+bool StorageAreaSync::itemBeforeImportComplete(const String& key, String& value)
+{
+    ASSERT(isMainThread());
+
+    // Fast path. We set m_storageArea to 0 only after m_importComplete being true.
+    if (!m_storageArea)
+        return false;
+
     Locker locker { m_importLock };
-    m_importComplete = true;
-    m_importCondition.notifyOne();
+    while (!m_importComplete) {
+        auto it = m_importedItems.find(key);
+        if (it != m_importedItems.end()) {
+            // The string was created on the storage thread and stays referenced by
+            // m_importedItems, so hand out a copy of our own.
+            value = it->value.isolatedCopy();
+            return true;
+        }
+        if (m_keysAbsentFromDatabase.contains(key)) {
+            value = String();
+            return true;
+        }
+        m_pendingLookups.add(key.isolatedCopy());
+        m_importCondition.wait(m_importLock);
+    }
+    return false;
 }
 
-// FIXME: In the future, we should allow use of StorageAreas while it's importing (when safe to do so).
-// Blocking everything until the import is complete is by far the simplest and safest thing to do, but
-// there is certainly room for safe optimization: Key/length will never be able to make use of such an
-// optimization (since the order of iteration can change as items are being added). Get can return any
-// item currently in the map. Get/remove can work whether or not it's in the map, but we'll need a list
-// of items the import should not overwrite. Clear can also work, but it'll need to kill the import
-// job first.
+// Reads of a single item go through itemBeforeImportComplete() and don't need to wait for the
+// whole table. Everything else still blocks: key/length depend on the full map (the order of
+// iteration can change as items are being added), and mutations need the old value for storage
+// events and quota accounting.
 void StorageAreaSync::blockUntilImportComplete()
 {
     ASSERT(isMainThread());
@@ -481,7 +613,9 @@ void StorageAreaSync::performSync()
         m_syncInProgress = true;
     }
 
+    auto syncStartTime = MonotonicTime::now();
     sync(clearItems, items);
+    StorageTracker::tracker().didSyncOrigin(m_databaseIdentifier, MonotonicTime::now() - syncStartTime, items.size());
 
     {
         Locker locker { m_syncLock };
@@ -29,7 +29,10 @@
 #include <WebCore/Timer.h>
 #include <wtf/Condition.h>
 #include <wtf/HashMap.h>
+#include <wtf/HashSet.h>
 #include <wtf/Lock.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/Vector.h>
 #include <wtf/text/StringHash.h>
 
 namespace WebCore {
@@ -48,6 +51,11 @@ public:
     void scheduleFinalSync();
     void blockUntilImportComplete();
 
+    // Looks up a single item while the import is still running, without waiting for the
+    // whole table. Returns false if the import has already completed, in which case the
+    // caller should consult the StorageMap instead.
+    bool itemBeforeImportComplete(const String& key, String& value);
+
     void scheduleItemForSync(const String& key, const String& value);
     void scheduleClear();
     void scheduleCloseDatabase();
@@ -57,10 +65,16 @@ public:
 private:
     StorageAreaSync(RefPtr<WebCore::StorageSyncManager>&&, Ref<StorageAreaImpl>&&, const String& databaseIdentifier);
 
+    void startSyncTimer();
+    void updateSyncInterval(unsigned itemsInInterval);
+
     WebCore::Timer m_syncTimer;
     HashMap<String, String> m_changedItems;
     bool m_itemsCleared;
 
+    Seconds m_syncInterval;
+    unsigned m_itemsChangedSinceLastSync { 0 };
+
     bool m_finalSyncScheduled;
 
     RefPtr<StorageAreaImpl> m_storageArea;
@@ -85,6 +99,8 @@ private:
     void syncTimerFired();
     void openDatabase(OpenDatabaseParamType openingStrategy);
     void sync(bool clearItems, const HashMap<String, String>& items);
+    void publishImportedItems(Vector<std::pair<String, String>>&);
+    void performPendingLookups();
 
     const String m_databaseIdentifier;
 
@@ -100,6 +116,12 @@ private:
     mutable Lock m_importLock;
     Condition m_importCondition;
     bool m_importComplete WTF_GUARDED_BY_LOCK(m_importLock);
+    // Items read so far by an import that is still in progress, plus the results of any
+    // point lookups requested by the main thread. Moved into the StorageMap on completion.
+    HashMap<String, String> m_importedItems WTF_GUARDED_BY_LOCK(m_importLock);
+    HashSet<String> m_keysAbsentFromDatabase WTF_GUARDED_BY_LOCK(m_importLock);
+    HashSet<String> m_pendingLookups WTF_GUARDED_BY_LOCK(m_importLock);
+    MonotonicTime m_importStartTime;
     void markImported();
     void migrateItemTableIfNeeded();
 };
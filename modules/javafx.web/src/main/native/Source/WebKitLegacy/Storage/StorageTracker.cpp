@@ -583,6 +583,40 @@ bool StorageTracker::canDeleteOrigin(const String& originIdentifier)
     return m_originsBeingDeleted.contains(originIdentifier);
 }
 
+void StorageTracker::didImportOrigin(const String& originIdentifier, Seconds duration, unsigned itemCount)
+{
+    Locker locker { m_originMetricsMutex };
+    auto& metrics = m_originMetrics.add(originIdentifier.isolatedCopy(), StorageOriginMetrics { }).iterator->value;
+    metrics.importDuration = duration;
+    metrics.importedItemCount = itemCount;
+}
+
+void StorageTracker::didSyncOrigin(const String& originIdentifier, Seconds duration, unsigned itemCount)
+{
+    Locker locker { m_originMetricsMutex };
+    auto& metrics = m_originMetrics.add(originIdentifier.isolatedCopy(), StorageOriginMetrics { }).iterator->value;
+    ++metrics.syncCount;
+    metrics.syncedItemCount += itemCount;
+    metrics.lastSyncDuration = duration;
+    metrics.maxSyncDuration = std::max(metrics.maxSyncDuration, duration);
+    metrics.totalSyncDuration += duration;
+}
+
+void StorageTracker::didUpdateSyncInterval(const String& originIdentifier, Seconds interval)
+{
+    Locker locker { m_originMetricsMutex };
+    m_originMetrics.add(originIdentifier.isolatedCopy(), StorageOriginMetrics { }).iterator->value.syncInterval = interval;
+}
+
+std::optional<StorageOriginMetrics> StorageTracker::metricsForOrigin(const String& originIdentifier)
+{
+    Locker locker { m_originMetricsMutex };
+    auto it = m_originMetrics.find(originIdentifier);
+    if (it == m_originMetrics.end())
+        return std::nullopt;
+    return it->value;
+}
+
 void StorageTracker::cancelDeletingOrigin(const String& originIdentifier)
 {
     if (!m_isActive)
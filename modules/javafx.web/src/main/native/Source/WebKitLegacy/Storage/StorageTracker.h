@@ -26,6 +26,7 @@
 #pragma once
 
 #include <WebCore/SQLiteDatabase.h>
+#include <wtf/HashMap.h>
 #include <wtf/HashSet.h>
 #include <wtf/Seconds.h>
 #include <wtf/Vector.h>
@@ -41,6 +42,18 @@ struct SecurityOriginData;
 
 namespace WebKit {
 
+// Latency figures for the LocalStorage database of a single origin, as seen by StorageAreaSync.
+struct StorageOriginMetrics {
+    Seconds importDuration;
+    unsigned importedItemCount { 0 };
+    uint64_t syncCount { 0 };
+    uint64_t syncedItemCount { 0 };
+    Seconds lastSyncDuration;
+    Seconds maxSyncDuration;
+    Seconds totalSyncDuration;
+    Seconds syncInterval;
+};
+
 class StorageTracker {
     WTF_MAKE_NONCOPYABLE(StorageTracker);
     WTF_MAKE_FAST_ALLOCATED;
@@ -65,6 +78,13 @@ public:
 
     void syncFileSystemAndTrackerDatabase();
 
+    // Called by StorageAreaSync, from either thread.
+    void didImportOrigin(const String& originIdentifier, Seconds duration, unsigned itemCount);
+    void didSyncOrigin(const String& originIdentifier, Seconds duration, unsigned itemCount);
+    void didUpdateSyncInterval(const String& originIdentifier, Seconds interval);
+
+    std::optional<StorageOriginMetrics> metricsForOrigin(const String& originIdentifier);
+
 private:
     explicit StorageTracker(const String& storagePath);
 
@@ -107,6 +127,9 @@ private:
     OriginSet m_originSet;
     OriginSet m_originsBeingDeleted;
 
+    Lock m_originMetricsMutex;
+    HashMap<String, StorageOriginMetrics> m_originMetrics WTF_GUARDED_BY_LOCK(m_originMetricsMutex);
+
     std::unique_ptr<WebCore::StorageThread> m_thread;
 
     bool m_isActive;
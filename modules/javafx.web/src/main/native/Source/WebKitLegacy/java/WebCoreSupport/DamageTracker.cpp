@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "DamageTracker.h"
+
+#include <WebCore/RenderingQueue.h>
+#include <wtf/JSONValues.h>
+#include <wtf/java/JavaEnv.h>
+
+namespace WebCore {
+
+// Every rectangle costs a separate walk of the render tree, so a region
+// made of many slivers is cheaper to paint as one rectangle.
+static constexpr size_t maxRectsToPaint = 8;
+// Painting the bounding box is accepted if it adds at most a third.
+static constexpr uint64_t boundsAreaRatio = 4;
+static constexpr size_t maxRecentFrames = 120;
+
+static uint64_t area(const IntRect& rect)
+{
+    return static_cast<uint64_t>(rect.width()) * rect.height();
+}
+
+bool DamageTracker::add(const IntRect& rect)
+{
+    if (rect.isEmpty())
+        return false;
+
+    bool wasEmpty = m_damage.isEmpty();
+    m_damage.unite(Region(rect));
+    return wasEmpty;
+}
+
+void DamageTracker::scroll(const IntRect& scrollRect, const IntSize& delta)
+{
+    if (m_damage.isEmpty() || !m_damage.intersects(Region(scrollRect)))
+        return;
+
+    Region scrolled = m_damage;
+    scrolled.intersect(Region(scrollRect));
+    scrolled.translate(delta);
+    scrolled.intersect(Region(scrollRect));
+    m_damage.subtract(Region(scrollRect));
+    m_damage.unite(scrolled);
+}
+
+Vector<IntRect> DamageTracker::take(const IntRect& clip)
+{
+    Region damage = std::exchange(m_damage, Region());
+    damage.intersect(Region(clip));
+    if (damage.isEmpty())
+        return { };
+
+    IntRect bounds = damage.bounds();
+    if (damage.isRect() || damage.totalArea() * boundsAreaRatio >= area(bounds) * (boundsAreaRatio - 1))
+        return { bounds };
+
+    auto rects = damage.rects();
+    if (rects.size() > maxRectsToPaint)
+        return { bounds };
+    return { rects.begin(), rects.size() };
+}
+
+void DamageTracker::beginFrame()
+{
+    m_inFrame = true;
+    m_currentFrame = { };
+    m_currentFrame.layoutTime = std::exchange(m_pendingLayoutTime, { });
+    m_frameStartQueueBytes = RenderingQueue::flushedByteCount();
+    m_frameStartJavaCalls = WTF::JavaCallCount();
+}
+
+void DamageTracker::didLayout(Seconds layoutTime)
+{
+    if (m_inFrame)
+        m_currentFrame.layoutTime += layoutTime;
+    else
+        m_pendingLayoutTime += layoutTime;
+}
+
+void DamageTracker::didPaint(const IntRect& rect, Seconds paintTime)
+{
+    if (!m_inFrame)
+        return;
+    ++m_currentFrame.rectCount;
+    m_currentFrame.area += area(rect);
+    m_currentFrame.paintTime += paintTime;
+}
+
+void DamageTracker::endFrame()
+{
+    if (!m_inFrame)
+        return;
+    m_inFrame = false;
+    if (!m_currentFrame.rectCount)
+        return;
+
+    // Calls made by other threads during the frame are counted too.
+    m_currentFrame.queueBytes = RenderingQueue::flushedByteCount() - m_frameStartQueueBytes;
+    m_currentFrame.javaCalls = WTF::JavaCallCount() - m_frameStartJavaCalls;
+
+    ++m_frameCount;
+    m_totalArea += m_currentFrame.area;
+    m_totalPaintTime += m_currentFrame.paintTime;
+    m_totalLayoutTime += m_currentFrame.layoutTime;
+    m_totalQueueBytes += m_currentFrame.queueBytes;
+    m_totalJavaCalls += m_currentFrame.javaCalls;
+    m_maxPaintTime = std::max(m_maxPaintTime, m_currentFrame.paintTime);
+
+    if (m_recentFrames.size() == maxRecentFrames)
+        m_recentFrames.removeFirst();
+    m_recentFrames.append(m_currentFrame);
+}
+
+void DamageTracker::didReplayTiles(unsigned recorded, unsigned reused)
+{
+    m_tilesRecorded += recorded;
+    m_tilesReused += reused;
+}
+
+String DamageTracker::statistics() const
+{
+    auto recent = JSON::Array::create();
+    for (auto& frame : m_recentFrames) {
+        auto object = JSON::Object::create();
+        object->setInteger("rectCount"_s, frame.rectCount);
+        object->setDouble("area"_s, frame.area);
+        object->setDouble("paintMillis"_s, frame.paintTime.milliseconds());
+        object->setDouble("layoutMillis"_s, frame.layoutTime.milliseconds());
+        object->setDouble("queueBytes"_s, frame.queueBytes);
+        object->setDouble("javaCalls"_s, frame.javaCalls);
+        recent->pushObject(WTFMove(object));
+    }
+
+    auto result = JSON::Object::create();
+    result->setDouble("frameCount"_s, m_frameCount);
+    result->setDouble("totalArea"_s, m_totalArea);
+    result->setDouble("totalPaintMillis"_s, m_totalPaintTime.milliseconds());
+    result->setDouble("maxPaintMillis"_s, m_maxPaintTime.milliseconds());
+    result->setDouble("totalLayoutMillis"_s, m_totalLayoutTime.milliseconds());
+    result->setDouble("totalQueueBytes"_s, m_totalQueueBytes);
+    result->setDouble("totalJavaCalls"_s, m_totalJavaCalls);
+    result->setDouble("tilesRecorded"_s, m_tilesRecorded);
+    result->setDouble("tilesReused"_s, m_tilesReused);
+    result->setArray("recentFrames"_s, WTFMove(recent));
+    return result->toJSONString();
+}
+
+void DamageTracker::resetStatistics()
+{
+    m_recentFrames.clear();
+    m_frameCount = 0;
+    m_totalArea = 0;
+    m_totalPaintTime = { };
+    m_maxPaintTime = { };
+    m_totalLayoutTime = { };
+    m_totalQueueBytes = 0;
+    m_totalJavaCalls = 0;
+    m_tilesRecorded = 0;
+    m_tilesReused = 0;
+}
+
+} // namespace WebCore
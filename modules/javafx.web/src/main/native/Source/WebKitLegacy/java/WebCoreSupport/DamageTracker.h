@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <WebCore/IntRect.h>
+#include <WebCore/Region.h>
+#include <wtf/Deque.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/Vector.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebCore {
+
+// Collects the areas ChromeClientJava invalidates between two page updates
+// as a Region, so that only the invalidated rectangles are painted rather
+// than their bounding box. Also keeps per-frame paint statistics.
+class DamageTracker {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    // Returns true if there was no damage before, i.e. if an update has
+    // to be scheduled.
+    bool add(const IntRect&);
+    bool isEmpty() const { return m_damage.isEmpty(); }
+    // Moves pending damage along with scrolled content.
+    void scroll(const IntRect& scrollRect, const IntSize& delta);
+
+    // Removes all damage and returns the rectangles within the clip that
+    // have to be painted. Regions that are too fragmented are painted as
+    // their bounding box.
+    Vector<IntRect> take(const IntRect& clip);
+
+    void beginFrame();
+    // Style and layout updates count towards the frame that paints them,
+    // even when they run before it has begun.
+    void didLayout(Seconds);
+    void didPaint(const IntRect&, Seconds);
+    void endFrame();
+    // Counts the display list tiles recorded anew and those replayed as
+    // they were cached.
+    void didReplayTiles(unsigned recorded, unsigned reused);
+
+    String statistics() const;
+    void resetStatistics();
+
+private:
+    struct Frame {
+        unsigned rectCount { 0 };
+        uint64_t area { 0 };
+        Seconds paintTime;
+        Seconds layoutTime;
+        uint64_t queueBytes { 0 };
+        uint64_t javaCalls { 0 };
+    };
+
+    Region m_damage;
+
+    bool m_inFrame { false };
+    Frame m_currentFrame;
+    Seconds m_pendingLayoutTime;
+    uint64_t m_frameStartQueueBytes { 0 };
+    uint64_t m_frameStartJavaCalls { 0 };
+    Deque<Frame> m_recentFrames;
+    uint64_t m_frameCount { 0 };
+    uint64_t m_totalArea { 0 };
+    Seconds m_totalPaintTime;
+    Seconds m_maxPaintTime;
+    Seconds m_totalLayoutTime;
+    uint64_t m_totalQueueBytes { 0 };
+    uint64_t m_totalJavaCalls { 0 };
+    uint64_t m_tilesRecorded { 0 };
+    uint64_t m_tilesReused { 0 };
+};
+
+} // namespace WebCore
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "DisplayListCache.h"
+
+namespace WebCore {
+
+// Enough to cover a 4K view; the recordings hold commands, not pixels.
+static constexpr unsigned maxTileCount = 144;
+
+static int floorToTile(int value)
+{
+    int tile = value / DisplayListCache::tileSize;
+    if (value < 0 && tile * DisplayListCache::tileSize != value)
+        --tile;
+    return tile * DisplayListCache::tileSize;
+}
+
+static int ceilToTile(int value)
+{
+    int floor = floorToTile(value);
+    return floor == value ? floor : floor + DisplayListCache::tileSize;
+}
+
+void DisplayListCache::setEnabled(bool enabled)
+{
+    m_enabled = enabled;
+    if (!enabled)
+        m_tiles.clear();
+}
+
+IntRect DisplayListCache::tileAlignedRect(const IntRect& rect)
+{
+    if (rect.isEmpty())
+        return { };
+
+    IntPoint min(ceilToTile(rect.x()), ceilToTile(rect.y()));
+    IntPoint max(floorToTile(rect.maxX()), floorToTile(rect.maxY()));
+    if (max.x() <= min.x() || max.y() <= min.y())
+        return { };
+    return IntRect(min, max - min);
+}
+
+RefPtr<RenderingQueue> DisplayListCache::tile(const IntPoint& origin)
+{
+    auto it = m_tiles.find(origin);
+    if (it == m_tiles.end())
+        return nullptr;
+    it->value.lastUse = ++m_useCounter;
+    return it->value.rq;
+}
+
+void DisplayListCache::setTile(const IntPoint& origin, RefPtr<RenderingQueue>&& rq)
+{
+    if (!m_enabled)
+        return;
+
+    if (!m_tiles.contains(origin) && m_tiles.size() >= maxTileCount)
+        evictLeastRecentlyUsed();
+    m_tiles.set(origin, Tile { WTFMove(rq), ++m_useCounter });
+}
+
+void DisplayListCache::invalidate(const IntRect& rect)
+{
+    if (m_tiles.isEmpty() || rect.isEmpty())
+        return;
+
+    for (int y = floorToTile(rect.y()); y < rect.maxY(); y += tileSize) {
+        for (int x = floorToTile(rect.x()); x < rect.maxX(); x += tileSize)
+            m_tiles.remove(IntPoint(x, y));
+    }
+}
+
+void DisplayListCache::invalidateAll()
+{
+    m_tiles.clear();
+}
+
+void DisplayListCache::evictLeastRecentlyUsed()
+{
+    auto oldest = m_tiles.end();
+    for (auto it = m_tiles.begin(); it != m_tiles.end(); ++it) {
+        if (oldest == m_tiles.end() || it->value.lastUse < oldest->value.lastUse)
+            oldest = it;
+    }
+    if (oldest != m_tiles.end())
+        m_tiles.remove(oldest);
+}
+
+} // namespace WebCore
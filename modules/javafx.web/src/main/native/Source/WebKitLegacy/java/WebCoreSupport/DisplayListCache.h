@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <WebCore/IntPointHash.h>
+#include <WebCore/IntRect.h>
+#include <WebCore/RenderingQueue.h>
+#include <wtf/HashMap.h>
+
+namespace WebCore {
+
+// Keeps the render queues recorded for fixed-size tiles of the page view,
+// so that repainting an area that has not been invalidated since replays
+// the recorded drawing commands instead of walking the render tree again.
+// Tiles are in view coordinates; they are dropped when the view scrolls,
+// which Java handles by copying the back buffer anyway.
+class DisplayListCache {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static constexpr int tileSize = 256;
+
+    bool isEnabled() const { return m_enabled; }
+    void setEnabled(bool);
+
+    // Returns the largest rectangle made of whole tiles within the given one.
+    static IntRect tileAlignedRect(const IntRect&);
+
+    // Returns the recording of the tile at the given origin, if it is still
+    // valid.
+    RefPtr<RenderingQueue> tile(const IntPoint&);
+    void setTile(const IntPoint&, RefPtr<RenderingQueue>&&);
+
+    void invalidate(const IntRect&);
+    void invalidateAll();
+
+private:
+    struct Tile {
+        RefPtr<RenderingQueue> rq;
+        uint64_t lastUse { 0 };
+    };
+
+    void evictLeastRecentlyUsed();
+
+    bool m_enabled { false };
+    HashMap<IntPoint, Tile> m_tiles;
+    uint64_t m_useCounter { 0 };
+};
+
+} // namespace WebCore
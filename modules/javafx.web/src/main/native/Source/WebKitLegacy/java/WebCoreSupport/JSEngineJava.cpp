@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "JSEngineJava.h"
+
+#include <JavaScriptCore/Options.h>
+#include <WebCore/PlatformJavaClasses.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/NumberOfCores.h>
+#include <wtf/RAMSize.h>
+#include <wtf/text/StringConcatenateNumbers.h>
+
+#include "com_sun_webkit_JSEngine.h"
+
+using JSC::Options;
+
+namespace WebKit {
+
+// Keep in sync with JSEngine.Profile.
+enum class JSEngineProfile {
+    Default,
+    LowMemory,
+    Throughput,
+    LowLatency
+};
+
+static JSEngineProfile s_profile { JSEngineProfile::Default };
+static bool s_applied { false };
+
+// The options the profiles tune, reported by JSEngine.getEffectiveOptions().
+#define FOR_EACH_TUNED_JSC_OPTION(v) \
+    v(useJIT) \
+    v(useDFGJIT) \
+    v(useFTLJIT) \
+    v(thresholdForJITAfterWarmUp) \
+    v(thresholdForOptimizeAfterWarmUp) \
+    v(thresholdForFTLOptimizeAfterWarmUp) \
+    v(smallHeapRAMFraction) \
+    v(smallHeapGrowthFactor) \
+    v(mediumHeapRAMFraction) \
+    v(mediumHeapGrowthFactor) \
+    v(largeHeapGrowthFactor) \
+    v(criticalGCMemoryThreshold) \
+    v(useConcurrentGC) \
+    v(concurrentGCMaxHeadroom) \
+    v(collectionTimerMaxPercentCPU) \
+    v(numberOfGCMarkers) \
+    v(useConcurrentJIT) \
+    v(numberOfWorklistThreads) \
+    v(numberOfDFGCompilerThreads) \
+    v(numberOfFTLCompilerThreads) \
+    v(forceRAMSize)
+
+static constexpr unsigned lowMemoryRAMSizeCap = 1024 * 1024 * 1024;
+
+static Vector<String>& warnings()
+{
+    static NeverDestroyed<Vector<String>> warnings;
+    return warnings;
+}
+
+static String profileOptions(JSEngineProfile profile)
+{
+    unsigned cores = std::max(WTF::numberOfProcessorCores(), 1);
+
+    switch (profile) {
+    case JSEngineProfile::Default:
+        break;
+    case JSEngineProfile::LowMemory:
+        // Compile less code, later, on one thread, and keep the heap small.
+        return makeString(
+            "thresholdForJITAfterWarmUp=1000 thresholdForOptimizeAfterWarmUp=5000 thresholdForFTLOptimizeAfterWarmUp=500000",
+            " smallHeapRAMFraction=0.125 smallHeapGrowthFactor=1.5",
+            " mediumHeapRAMFraction=0.25 mediumHeapGrowthFactor=1.25 largeHeapGrowthFactor=1.1",
+            " criticalGCMemoryThreshold=0.7",
+            " numberOfGCMarkers=", std::min(cores, 2u),
+            " numberOfWorklistThreads=1 numberOfDFGCompilerThreads=1 numberOfFTLCompilerThreads=1",
+            " forceRAMSize=", static_cast<unsigned>(std::min<uint64_t>(ramSize(), lowMemoryRAMSizeCap)));
+    case JSEngineProfile::Throughput: {
+        // Tier up early, collect rarely, and compile and mark on more threads.
+        unsigned compilerThreads = std::clamp(cores / 2, 2u, 4u);
+        return makeString(
+            "thresholdForJITAfterWarmUp=250 thresholdForOptimizeAfterWarmUp=500 thresholdForFTLOptimizeAfterWarmUp=50000",
+            " smallHeapGrowthFactor=3 mediumHeapGrowthFactor=2 largeHeapGrowthFactor=1.5",
+            " numberOfGCMarkers=", std::min(cores, 8u),
+            " numberOfWorklistThreads=", compilerThreads,
+            " numberOfDFGCompilerThreads=", compilerThreads - 1,
+            " numberOfFTLCompilerThreads=", compilerThreads - 1);
+    }
+    case JSEngineProfile::LowLatency: {
+        // Leave the interpreter early but defer the long FTL compilations,
+        // and give the concurrent collector room so allocations rarely wait.
+        unsigned compilerThreads = std::clamp(cores / 2, 2u, 3u);
+        return makeString(
+            "thresholdForJITAfterWarmUp=100 thresholdForFTLOptimizeAfterWarmUp=200000",
+            " smallHeapGrowthFactor=2.5 mediumHeapGrowthFactor=1.75 largeHeapGrowthFactor=1.35",
+            " useConcurrentGC=true concurrentGCMaxHeadroom=2 collectionTimerMaxPercentCPU=0.1",
+            " numberOfGCMarkers=", std::min(cores, 8u),
+            " useConcurrentJIT=true numberOfWorklistThreads=", compilerThreads,
+            " numberOfDFGCompilerThreads=", compilerThreads - 1,
+            " numberOfFTLCompilerThreads=1");
+    }
+    }
+    return { };
+}
+
+template<typename T>
+static void correct(T& option, T value, const char* name, const char* reason)
+{
+    warnings().append(makeString("JavaScript engine option ", name, '=', option, ' ', reason, ", using ", value));
+    option = value;
+}
+
+// The profiles are consistent, but the JSC_ environment variables are read
+// before them and can leave the options in a state the engine does not
+// expect, so check the result rather than the profiles.
+static void checkOptions()
+{
+    if (Options::thresholdForOptimizeAfterWarmUp() < Options::thresholdForJITAfterWarmUp())
+        correct(Options::thresholdForOptimizeAfterWarmUp(), Options::thresholdForJITAfterWarmUp(), "thresholdForOptimizeAfterWarmUp", "is below thresholdForJITAfterWarmUp");
+    if (Options::thresholdForFTLOptimizeAfterWarmUp() < Options::thresholdForOptimizeAfterWarmUp())
+        correct(Options::thresholdForFTLOptimizeAfterWarmUp(), Options::thresholdForOptimizeAfterWarmUp(), "thresholdForFTLOptimizeAfterWarmUp", "is below thresholdForOptimizeAfterWarmUp");
+
+    if (Options::smallHeapGrowthFactor() < 1)
+        correct(Options::smallHeapGrowthFactor(), 1.0, "smallHeapGrowthFactor", "would shrink the heap");
+    if (Options::mediumHeapGrowthFactor() < 1)
+        correct(Options::mediumHeapGrowthFactor(), 1.0, "mediumHeapGrowthFactor", "would shrink the heap");
+    if (Options::largeHeapGrowthFactor() < 1)
+        correct(Options::largeHeapGrowthFactor(), 1.0, "largeHeapGrowthFactor", "would shrink the heap");
+    if (Options::mediumHeapRAMFraction() > 1)
+        correct(Options::mediumHeapRAMFraction(), 1.0, "mediumHeapRAMFraction", "is over the memory size");
+    if (Options::smallHeapRAMFraction() > Options::mediumHeapRAMFraction())
+        correct(Options::smallHeapRAMFraction(), Options::mediumHeapRAMFraction(), "smallHeapRAMFraction", "is over mediumHeapRAMFraction");
+
+    // A tier without compiler threads never compiles anything.
+    if (!Options::numberOfGCMarkers())
+        correct(Options::numberOfGCMarkers(), 1u, "numberOfGCMarkers", "leaves no marker");
+    if (!Options::numberOfWorklistThreads())
+        correct(Options::numberOfWorklistThreads(), 1u, "numberOfWorklistThreads", "leaves no compiler thread");
+    if (!Options::numberOfDFGCompilerThreads())
+        correct(Options::numberOfDFGCompilerThreads(), 1u, "numberOfDFGCompilerThreads", "leaves no DFG compiler thread");
+    if (!Options::numberOfFTLCompilerThreads())
+        correct(Options::numberOfFTLCompilerThreads(), 1u, "numberOfFTLCompilerThreads", "leaves no FTL compiler thread");
+
+    if (Options::forceRAMSize() > ramSize())
+        correct(Options::forceRAMSize(), static_cast<unsigned>(std::min<uint64_t>(ramSize(), std::numeric_limits<unsigned>::max())), "forceRAMSize", "is over the physical memory");
+
+    if (s_profile != JSEngineProfile::Default && !Options::useJIT())
+        warnings().append("The JIT is disabled, the tier thresholds of the JavaScript engine profile have no effect"_s);
+}
+
+void applyJSEngineProfile()
+{
+    ASSERT(!s_applied);
+    String options = profileOptions(s_profile);
+    if (!options.isEmpty() && !Options::setOptions(options.utf8().data()))
+        warnings().append("The JavaScript engine profile could not be applied completely"_s);
+    checkOptions();
+    s_applied = true;
+}
+
+static String optionValue(bool value)
+{
+    return value ? "true"_s : "false"_s;
+}
+
+template<typename T>
+static String optionValue(T value)
+{
+    return String::number(value);
+}
+
+static jobjectArray toJavaArray(JNIEnv* env, const Vector<String>& strings)
+{
+    static JGClass clsString(env->FindClass("java/lang/String"));
+    jobjectArray array = env->NewObjectArray(strings.size(), clsString, nullptr);
+    if (WTF::CheckAndClearException(env)) // OOME
+        return nullptr;
+    for (size_t i = 0; i < strings.size(); ++i)
+        env->SetObjectArrayElement(array, i, (jstring)strings[i].toJavaString(env));
+    return array;
+}
+
+} // namespace WebKit
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_JSEngine_twkSetProfile
+  (JNIEnv*, jclass, jint profile)
+{
+    ASSERT(profile >= 0 && profile <= static_cast<jint>(WebKit::JSEngineProfile::LowLatency));
+    ASSERT(!WebKit::s_applied);
+    WebKit::s_profile = static_cast<WebKit::JSEngineProfile>(profile);
+}
+
+JNIEXPORT jobjectArray JNICALL Java_com_sun_webkit_JSEngine_twkGetWarnings
+  (JNIEnv* env, jclass)
+{
+    return WebKit::toJavaArray(env, WebKit::warnings());
+}
+
+JNIEXPORT jobjectArray JNICALL Java_com_sun_webkit_JSEngine_twkGetEffectiveOptions
+  (JNIEnv* env, jclass)
+{
+    if (!WebKit::s_applied)
+        return nullptr;
+
+    Vector<String> options;
+#define APPEND_OPTION(name_) \
+    options.append(makeString(#name_, '=', WebKit::optionValue(Options::name_())));
+    FOR_EACH_TUNED_JSC_OPTION(APPEND_OPTION)
+#undef APPEND_OPTION
+    return WebKit::toJavaArray(env, options);
+}
+
+}
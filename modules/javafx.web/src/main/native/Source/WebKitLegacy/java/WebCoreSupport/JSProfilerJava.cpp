@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <JavaScriptCore/HeapObserver.h>
+#include <JavaScriptCore/JSLock.h>
+#include <JavaScriptCore/SamplingProfiler.h>
+#include <JavaScriptCore/VM.h>
+#include <WebCore/CommonVM.h>
+#include <WebCore/PlatformJavaClasses.h>
+#include <WebCore/Timer.h>
+#include <wtf/HashCountedSet.h>
+#include <wtf/JSONValues.h>
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Stopwatch.h>
+#include <wtf/text/StringBuilder.h>
+
+#include "com_sun_webkit_JSProfiler.h"
+
+using namespace JSC;
+using namespace WebCore;
+
+namespace WebKit {
+
+// Process-wide view of the shared WebCore VM for com.sun.webkit.JSProfiler.
+// Everything here runs on the WebKit main thread.
+class JSProfilerJava final : public HeapObserver {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static JSProfilerJava& singleton();
+
+    void startSampling(Seconds interval);
+    void stopSampling();
+    String takeSamples();
+    String heapStatistics(bool includeObjectTypeCounts);
+
+private:
+    friend class NeverDestroyed<JSProfilerJava>;
+    JSProfilerJava();
+
+    void drainStackTraces();
+    void drainTimerFired() { drainStackTraces(); }
+
+    // HeapObserver
+    void willGarbageCollect() final;
+    void didGarbageCollect(CollectionScope) final;
+
+    struct CollectionStatistics {
+        unsigned count { 0 };
+        Seconds total;
+        Seconds max;
+        Seconds last;
+    };
+
+    // Stack traces are aggregated by their frame labels joined with '\n', outermost frame last.
+    // The map is bounded by the number of distinct stacks, so sampling can be left running.
+    HashCountedSet<String> m_stackCounts;
+    unsigned m_sampleCount { 0 };
+    bool m_isSampling { false };
+    Seconds m_interval;
+    MonotonicTime m_samplingStartTime;
+    Timer m_drainTimer;
+
+    MonotonicTime m_collectionStartTime;
+    CollectionStatistics m_edenCollections;
+    CollectionStatistics m_fullCollections;
+    static constexpr size_t maxRecentCollections = 32;
+    Vector<std::pair<CollectionScope, Seconds>> m_recentCollections;
+};
+
+// The samples are folded into m_stackCounts this often so the profiler's raw
+// stack trace buffer does not grow while nobody is fetching results.
+static constexpr Seconds drainInterval { 5_s };
+
+JSProfilerJava& JSProfilerJava::singleton()
+{
+    ASSERT(isMainThread());
+    static NeverDestroyed<JSProfilerJava> profiler;
+    return profiler;
+}
+
+JSProfilerJava::JSProfilerJava()
+    : m_drainTimer(*this, &JSProfilerJava::drainTimerFired)
+{
+    commonVM().heap.addObserver(this);
+}
+
+void JSProfilerJava::startSampling(Seconds interval)
+{
+#if ENABLE(SAMPLING_PROFILER)
+    VM& vm = commonVM();
+    JSLockHolder lock(vm);
+
+    auto& profiler = vm.ensureSamplingProfiler(Stopwatch::create());
+    Locker locker { profiler.getLock() };
+    profiler.setTimingInterval(interval);
+    if (!m_isSampling) {
+        profiler.noticeCurrentThreadAsJSCExecutionThreadWithLock();
+        profiler.startWithLock();
+        m_isSampling = true;
+        m_samplingStartTime = MonotonicTime::now();
+        m_drainTimer.startRepeating(drainInterval);
+    }
+    m_interval = interval;
+#else
+    UNUSED_PARAM(interval);
+#endif
+}
+
+void JSProfilerJava::stopSampling()
+{
+#if ENABLE(SAMPLING_PROFILER)
+    if (!m_isSampling)
+        return;
+
+    drainStackTraces();
+    m_drainTimer.stop();
+
+    VM& vm = commonVM();
+    JSLockHolder lock(vm);
+    if (auto* profiler = vm.samplingProfiler()) {
+        Locker locker { profiler->getLock() };
+        profiler->pause();
+    }
+    m_isSampling = false;
+#endif
+}
+
+void JSProfilerJava::drainStackTraces()
+{
+#if ENABLE(SAMPLING_PROFILER)
+    VM& vm = commonVM();
+    auto* profiler = vm.samplingProfiler();
+    if (!profiler)
+        return;
+
+    JSLockHolder lock(vm);
+    // The stack frames hold raw pointers into the heap until they are turned into labels.
+    DeferGC deferGC(vm);
+    Vector<SamplingProfiler::StackTrace> stackTraces;
+    {
+        Locker locker { profiler->getLock() };
+        stackTraces = profiler->releaseStackTraces();
+    }
+
+    for (auto& stackTrace : stackTraces) {
+        StringBuilder key;
+        for (auto& frame : stackTrace.frames) {
+            if (!key.isEmpty())
+                key.append('\n');
+            key.append(frame.displayName(vm));
+            String url = frame.url();
+            if (!url.isEmpty()) {
+                key.append(" (", url);
+                if (frame.hasExpressionInfo())
+                    key.append(':', frame.lineNumber(), ':', frame.columnNumber());
+                key.append(')');
+            }
+        }
+        m_stackCounts.add(key.toString());
+        ++m_sampleCount;
+    }
+#endif
+}
+
+String JSProfilerJava::takeSamples()
+{
+    drainStackTraces();
+
+    Vector<std::pair<String, unsigned>> stacks;
+    stacks.reserveInitialCapacity(m_stackCounts.size());
+    for (auto& entry : m_stackCounts)
+        stacks.uncheckedAppend({ entry.key, entry.value });
+    std::sort(stacks.begin(), stacks.end(), [](auto& a, auto& b) {
+        return a.second > b.second;
+    });
+
+    auto stackArray = JSON::Array::create();
+    for (auto& stack : stacks) {
+        auto frames = JSON::Array::create();
+        for (auto& frame : stack.first.split('\n'))
+            frames->pushString(frame);
+        auto object = JSON::Object::create();
+        object->setInteger("count"_s, stack.second);
+        object->setArray("frames"_s, WTFMove(frames));
+        stackArray->pushObject(WTFMove(object));
+    }
+
+    auto now = MonotonicTime::now();
+    auto result = JSON::Object::create();
+    result->setBoolean("sampling"_s, m_isSampling);
+    result->setDouble("intervalMicros"_s, m_interval.microseconds());
+    result->setDouble("durationMillis"_s, m_isSampling ? (now - m_samplingStartTime).milliseconds() : 0);
+    result->setInteger("sampleCount"_s, m_sampleCount);
+    result->setArray("stacks"_s, WTFMove(stackArray));
+
+    m_stackCounts.clear();
+    m_sampleCount = 0;
+    m_samplingStartTime = now;
+    return result->toJSONString();
+}
+
+static Ref<JSON::Object> collectionStatisticsObject(unsigned count, Seconds total, Seconds max, Seconds last)
+{
+    auto object = JSON::Object::create();
+    object->setInteger("count"_s, count);
+    object->setDouble("totalMillis"_s, total.milliseconds());
+    object->setDouble("maxMillis"_s, max.milliseconds());
+    object->setDouble("lastMillis"_s, last.milliseconds());
+    return object;
+}
+
+String JSProfilerJava::heapStatistics(bool includeObjectTypeCounts)
+{
+    VM& vm = commonVM();
+    JSLockHolder lock(vm);
+
+    auto result = JSON::Object::create();
+    result->setDouble("size"_s, vm.heap.size());
+    result->setDouble("capacity"_s, vm.heap.capacity());
+    result->setDouble("extraMemorySize"_s, vm.heap.extraMemorySize());
+    result->setDouble("objectCount"_s, vm.heap.objectCount());
+    result->setDouble("globalObjectCount"_s, vm.heap.globalObjectCount());
+    result->setDouble("protectedObjectCount"_s, vm.heap.protectedObjectCount());
+
+    // Counting objects by type walks the whole heap, so it is only done on request.
+    if (includeObjectTypeCounts) {
+        auto typeCounts = JSON::Object::create();
+        for (auto& entry : *vm.heap.objectTypeCounts())
+            typeCounts->setInteger(String(entry.key), entry.value);
+        result->setObject("objectTypeCounts"_s, WTFMove(typeCounts));
+    }
+
+    auto collections = JSON::Object::create();
+    collections->setDouble("totalMillis"_s, vm.heap.totalGCTime().milliseconds());
+    collections->setObject("eden"_s, collectionStatisticsObject(m_edenCollections.count, m_edenCollections.total, m_edenCollections.max, m_edenCollections.last));
+    collections->setObject("full"_s, collectionStatisticsObject(m_fullCollections.count, m_fullCollections.total, m_fullCollections.max, m_fullCollections.last));
+    auto recent = JSON::Array::create();
+    for (auto& collection : m_recentCollections) {
+        auto object = JSON::Object::create();
+        object->setString("scope"_s, collection.first == CollectionScope::Eden ? "eden"_s : "full"_s);
+        object->setDouble("durationMillis"_s, collection.second.milliseconds());
+        recent->pushObject(WTFMove(object));
+    }
+    collections->setArray("recent"_s, WTFMove(recent));
+    result->setObject("collections"_s, WTFMove(collections));
+
+    return result->toJSONString();
+}
+
+void JSProfilerJava::willGarbageCollect()
+{
+    m_collectionStartTime = MonotonicTime::now();
+}
+
+void JSProfilerJava::didGarbageCollect(CollectionScope scope)
+{
+    Seconds duration = MonotonicTime::now() - m_collectionStartTime;
+    auto& statistics = scope == CollectionScope::Eden ? m_edenCollections : m_fullCollections;
+    ++statistics.count;
+    statistics.total += duration;
+    statistics.max = std::max(statistics.max, duration);
+    statistics.last = duration;
+
+    if (m_recentCollections.size() == maxRecentCollections)
+        m_recentCollections.remove(0);
+    m_recentCollections.append({ scope, duration });
+}
+
+} // namespace WebKit
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_JSProfiler_twkStartSampling
+  (JNIEnv*, jclass, jint intervalMicros)
+{
+    ASSERT(intervalMicros > 0);
+    WebKit::JSProfilerJava::singleton().startSampling(Seconds::fromMicroseconds(intervalMicros));
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_JSProfiler_twkStopSampling
+  (JNIEnv*, jclass)
+{
+    WebKit::JSProfilerJava::singleton().stopSampling();
+}
+
+JNIEXPORT jstring JNICALL Java_com_sun_webkit_JSProfiler_twkTakeSamples
+  (JNIEnv* env, jclass)
+{
+    return WebKit::JSProfilerJava::singleton().takeSamples().toJavaString(env).releaseLocal();
+}
+
+JNIEXPORT jstring JNICALL Java_com_sun_webkit_JSProfiler_twkGetHeapStatistics
+  (JNIEnv* env, jclass, jboolean includeObjectTypeCounts)
+{
+    return WebKit::JSProfilerJava::singleton().heapStatistics(includeObjectTypeCounts).toJavaString(env).releaseLocal();
+}
+
+}
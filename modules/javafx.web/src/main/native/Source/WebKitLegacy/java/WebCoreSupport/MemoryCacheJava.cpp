@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <WebCore/BackForwardCache.h>
+#include <WebCore/MemoryCache.h>
+#include <WebCore/PlatformJavaClasses.h>
+#include <wtf/MainThread.h>
+#include <wtf/RAMSize.h>
+
+#include "com_sun_webkit_MemoryCache.h"
+
+namespace WebKit {
+
+// Keep in sync with MemoryCache.CacheModel.
+enum class CacheModel {
+    DocumentViewer,
+    DocumentBrowser,
+    PrimaryWebBrowser
+};
+
+// The same sizing as the cache models of the other WebKit ports, scaled by
+// the physical memory of the host.
+static void setCacheModel(CacheModel cacheModel)
+{
+    static const unsigned MB = 1024 * 1024;
+    uint64_t memorySize = ramSize() / MB;
+
+    unsigned backForwardCacheSize = 0;
+    unsigned cacheTotalCapacity = 8 * MB;
+    unsigned cacheMinDeadCapacity = 0;
+    unsigned cacheMaxDeadCapacity = 0;
+    Seconds deadDecodedDataDeletionInterval;
+
+    switch (cacheModel) {
+    case CacheModel::DocumentViewer:
+        if (memorySize >= 2048)
+            cacheTotalCapacity = 96 * MB;
+        else if (memorySize >= 1536)
+            cacheTotalCapacity = 64 * MB;
+        else if (memorySize >= 1024)
+            cacheTotalCapacity = 32 * MB;
+        else if (memorySize >= 512)
+            cacheTotalCapacity = 16 * MB;
+        break;
+    case CacheModel::DocumentBrowser:
+        if (memorySize >= 512)
+            backForwardCacheSize = 2;
+        else if (memorySize >= 256)
+            backForwardCacheSize = 1;
+
+        if (memorySize >= 2048)
+            cacheTotalCapacity = 96 * MB;
+        else if (memorySize >= 1536)
+            cacheTotalCapacity = 64 * MB;
+        else if (memorySize >= 1024)
+            cacheTotalCapacity = 32 * MB;
+        else if (memorySize >= 512)
+            cacheTotalCapacity = 16 * MB;
+
+        cacheMinDeadCapacity = cacheTotalCapacity / 8;
+        cacheMaxDeadCapacity = cacheTotalCapacity / 4;
+        break;
+    case CacheModel::PrimaryWebBrowser:
+        if (memorySize >= 1024)
+            backForwardCacheSize = 3;
+        else if (memorySize >= 512)
+            backForwardCacheSize = 2;
+        else if (memorySize >= 256)
+            backForwardCacheSize = 1;
+
+        if (memorySize >= 2048)
+            cacheTotalCapacity = 128 * MB;
+        else if (memorySize >= 1536)
+            cacheTotalCapacity = 96 * MB;
+        else if (memorySize >= 1024)
+            cacheTotalCapacity = 64 * MB;
+        else if (memorySize >= 512)
+            cacheTotalCapacity = 32 * MB;
+
+        cacheMinDeadCapacity = cacheTotalCapacity / 4;
+        cacheMaxDeadCapacity = cacheTotalCapacity / 2;
+        deadDecodedDataDeletionInterval = 60_s;
+        break;
+    }
+
+    auto& memoryCache = WebCore::MemoryCache::singleton();
+    memoryCache.setCapacities(cacheMinDeadCapacity, cacheMaxDeadCapacity, cacheTotalCapacity);
+    memoryCache.setDeadDecodedDataDeletionInterval(deadDecodedDataDeletionInterval);
+    WebCore::BackForwardCache::singleton().setMaxSize(backForwardCacheSize);
+}
+
+}
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_MemoryCache_twkSetCacheModel
+  (JNIEnv*, jclass, jint cacheModel)
+{
+    ASSERT(isMainThread());
+    ASSERT(cacheModel >= 0 && cacheModel <= static_cast<jint>(WebKit::CacheModel::PrimaryWebBrowser));
+    WebKit::setCacheModel(static_cast<WebKit::CacheModel>(cacheModel));
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_MemoryCache_twkSetCapacities
+  (JNIEnv*, jclass, jlong minDeadBytes, jlong maxDeadBytes, jlong totalBytes)
+{
+    ASSERT(isMainThread());
+    ASSERT(minDeadBytes >= 0 && minDeadBytes <= maxDeadBytes && maxDeadBytes <= totalBytes);
+    WebCore::MemoryCache::singleton().setCapacities(minDeadBytes, maxDeadBytes, totalBytes);
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryCache_twkGetCapacity
+  (JNIEnv*, jclass)
+{
+    return WebCore::MemoryCache::singleton().capacity();
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryCache_twkGetMinDeadCapacity
+  (JNIEnv*, jclass)
+{
+    return WebCore::MemoryCache::singleton().minDeadCapacity();
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryCache_twkGetMaxDeadCapacity
+  (JNIEnv*, jclass)
+{
+    return WebCore::MemoryCache::singleton().maxDeadCapacity();
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryCache_twkGetLiveSize
+  (JNIEnv*, jclass)
+{
+    return WebCore::MemoryCache::singleton().liveSize();
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryCache_twkGetDeadSize
+  (JNIEnv*, jclass)
+{
+    return WebCore::MemoryCache::singleton().deadSize();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_MemoryCache_twkPruneDeadResources
+  (JNIEnv*, jclass)
+{
+    ASSERT(isMainThread());
+    WebCore::MemoryCache::singleton().pruneDeadResourcesToSize(0);
+}
+
+}
@@ -0,0 +1,361 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <JavaScriptCore/JSLock.h>
+#include <JavaScriptCore/VM.h>
+#include <WebCore/CommonVM.h>
+#include <WebCore/MemoryRelease.h>
+#include <WebCore/PlatformJavaClasses.h>
+#include <wtf/Condition.h>
+#include <wtf/Lock.h>
+#include <wtf/MainThread.h>
+#include <wtf/MemoryFootprint.h>
+#include <wtf/MemoryPressureHandler.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Threading.h>
+
+#if OS(LINUX)
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <wtf/linux/CurrentProcessMemoryStatus.h>
+#include <wtf/text/StringToIntegerConversion.h>
+#endif
+
+#include "com_sun_webkit_MemoryPressure.h"
+
+namespace WebKit {
+
+static void releaseMemory(Critical critical)
+{
+    auto& handler = MemoryPressureHandler::singleton();
+    handler.setMemoryPressureStatus(critical == Critical::Yes ? MemoryPressureStatus::SystemCritical : MemoryPressureStatus::SystemWarning);
+    handler.releaseMemory(critical, Synchronous::Yes);
+    handler.setMemoryPressureStatus(MemoryPressureStatus::Normal);
+}
+
+static size_t residentMemory()
+{
+#if OS(LINUX)
+    // memoryFootprint() is cached for a second, which hides the effect of a
+    // release that has just happened.
+    ProcessMemoryStatus status;
+    currentProcessMemoryStatus(status);
+    return status.resident;
+#else
+    return memoryFootprint();
+#endif
+}
+
+#if OS(LINUX)
+
+// Polls the memory controller of the cgroup this process lives in and maps
+// its usage onto MemoryPressureHandler levels. Containers are usually killed
+// by the cgroup limit long before the host runs out of memory, so the limit
+// is what we have to stay under.
+class CgroupMemoryWatcher {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static CgroupMemoryWatcher& singleton();
+
+    bool locateController();
+    bool start(Seconds pollInterval, double warningFraction, double criticalFraction);
+    void stop();
+
+    std::optional<size_t> limit() const { return readValue(m_limitFile); }
+
+private:
+    std::optional<size_t> readValue(const CString& path) const;
+    std::optional<size_t> usage() const;
+    void run();
+
+    CString m_limitFile;
+    CString m_usageFile;
+    CString m_statFile;
+    const char* m_inactiveFileKey { nullptr };
+
+    Lock m_lock;
+    Condition m_condition;
+    RefPtr<Thread> m_thread;
+    bool m_running WTF_GUARDED_BY_LOCK(m_lock) { false };
+    Seconds m_pollInterval;
+    double m_warningFraction { 0 };
+    double m_criticalFraction { 0 };
+    std::atomic<bool> m_eventPending { false };
+};
+
+CgroupMemoryWatcher& CgroupMemoryWatcher::singleton()
+{
+    static NeverDestroyed<CgroupMemoryWatcher> watcher;
+    return watcher;
+}
+
+bool CgroupMemoryWatcher::locateController()
+{
+    if (!m_limitFile.isNull())
+        return true;
+
+    FILE* file = fopen("/proc/self/cgroup", "r");
+    if (!file)
+        return false;
+
+    // cgroup v2 has a single "0::<path>" line. With v1 the memory controller
+    // gets a line of its own, "<id>:<controllers>:<path>".
+    String unifiedDirectory;
+    String memoryDirectory;
+    char* buffer = nullptr;
+    size_t size = 0;
+    while (getline(&buffer, &size, file) != -1) {
+        String line = String::fromUTF8(buffer).stripWhiteSpace();
+        auto tokens = line.split(':');
+        if (tokens.size() < 3)
+            continue;
+        String path = line.substring(tokens[0].length() + tokens[1].length() + 2);
+        if (path == "/")
+            path = emptyString();
+        if (tokens[0] == "0" && tokens[1].isEmpty())
+            unifiedDirectory = makeString("/sys/fs/cgroup", path);
+        else if (tokens[1].split(',').contains("memory"))
+            memoryDirectory = makeString("/sys/fs/cgroup/memory", path);
+    }
+    free(buffer);
+    fclose(file);
+
+    // Inside a container the cgroup namespace may leave /proc/self/cgroup
+    // pointing at a path that is not mounted, in which case the root of the
+    // mount is the cgroup we are in.
+    auto exists = [] (const String& path) {
+        return !access(path.utf8().data(), R_OK);
+    };
+
+    if (!unifiedDirectory.isNull()) {
+        if (!exists(makeString(unifiedDirectory, "/memory.max")))
+            unifiedDirectory = "/sys/fs/cgroup";
+        if (exists(makeString(unifiedDirectory, "/memory.max"))) {
+            m_limitFile = makeString(unifiedDirectory, "/memory.max").utf8();
+            m_usageFile = makeString(unifiedDirectory, "/memory.current").utf8();
+            m_statFile = makeString(unifiedDirectory, "/memory.stat").utf8();
+            m_inactiveFileKey = "inactive_file";
+            return true;
+        }
+    }
+
+    if (!memoryDirectory.isNull()) {
+        if (!exists(makeString(memoryDirectory, "/memory.limit_in_bytes")))
+            memoryDirectory = "/sys/fs/cgroup/memory";
+        if (exists(makeString(memoryDirectory, "/memory.limit_in_bytes"))) {
+            m_limitFile = makeString(memoryDirectory, "/memory.limit_in_bytes").utf8();
+            m_usageFile = makeString(memoryDirectory, "/memory.usage_in_bytes").utf8();
+            m_statFile = makeString(memoryDirectory, "/memory.stat").utf8();
+            m_inactiveFileKey = "total_inactive_file";
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::optional<size_t> CgroupMemoryWatcher::readValue(const CString& path) const
+{
+    if (path.isNull())
+        return std::nullopt;
+
+    FILE* file = fopen(path.data(), "r");
+    if (!file)
+        return std::nullopt;
+
+    char buffer[64];
+    bool didRead = fgets(buffer, sizeof(buffer), file);
+    fclose(file);
+    if (!didRead)
+        return std::nullopt;
+
+    // "max" for v2, a page-aligned LONG_MAX for v1: both mean "no limit".
+    auto value = parseInteger<uint64_t>(StringView(buffer, strlen(buffer)));
+    if (!value || *value >= (1ULL << 62))
+        return std::nullopt;
+    return static_cast<size_t>(*value);
+}
+
+std::optional<size_t> CgroupMemoryWatcher::usage() const
+{
+    auto usage = readValue(m_usageFile);
+    if (!usage)
+        return std::nullopt;
+
+    // The usage includes the page cache. Inactive file pages are reclaimed by
+    // the kernel before it resorts to the OOM killer, so don't count them.
+    FILE* file = fopen(m_statFile.data(), "r");
+    if (!file)
+        return usage;
+
+    size_t keyLength = strlen(m_inactiveFileKey);
+    char line[128];
+    while (fgets(line, sizeof(line), file)) {
+        if (strncmp(line, m_inactiveFileKey, keyLength) || line[keyLength] != ' ')
+            continue;
+        auto inactive = parseInteger<uint64_t>(StringView(line + keyLength, strlen(line + keyLength)));
+        if (inactive && *inactive < *usage)
+            *usage -= *inactive;
+        break;
+    }
+    fclose(file);
+    return usage;
+}
+
+bool CgroupMemoryWatcher::start(Seconds pollInterval, double warningFraction, double criticalFraction)
+{
+    ASSERT(isMainThread());
+
+    if (!locateController() || !limit())
+        return false;
+
+    Locker locker { m_lock };
+    m_pollInterval = pollInterval;
+    m_warningFraction = warningFraction;
+    m_criticalFraction = criticalFraction;
+    if (m_running)
+        return true;
+
+    m_running = true;
+    m_thread = Thread::create("CgroupMemoryWatcher", [this] {
+        run();
+    }, ThreadType::Unknown, Thread::QOS::Utility);
+    return true;
+}
+
+void CgroupMemoryWatcher::stop()
+{
+    RefPtr<Thread> thread;
+    {
+        Locker locker { m_lock };
+        if (!m_running)
+            return;
+        m_running = false;
+        thread = WTFMove(m_thread);
+        m_condition.notifyAll();
+    }
+    thread->waitForCompletion();
+}
+
+void CgroupMemoryWatcher::run()
+{
+    Locker locker { m_lock };
+    while (m_running) {
+        // The limit can be changed at runtime, so read it on every poll.
+        auto limit = this->limit();
+        auto usage = this->usage();
+        if (limit && usage) {
+            double fraction = static_cast<double>(*usage) / *limit;
+            if (fraction >= m_warningFraction && !m_eventPending.exchange(true)) {
+                bool isCritical = fraction >= m_criticalFraction;
+                // MemoryPressureHandler uninstalls itself for a while after
+                // every event, which keeps us from releasing on every poll
+                // while the usage stays above the threshold.
+                callOnMainThread([this, isCritical] {
+                    MemoryPressureHandler::singleton().triggerMemoryPressureEvent(isCritical);
+                    m_eventPending = false;
+                });
+            }
+        }
+        m_condition.waitFor(m_lock, m_pollInterval);
+    }
+}
+
+#endif // OS(LINUX)
+
+} // namespace WebKit
+
+using namespace WebKit;
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_MemoryPressure_twkInstall
+  (JNIEnv*, jclass)
+{
+    ASSERT(isMainThread());
+
+    auto& handler = MemoryPressureHandler::singleton();
+    handler.setLowMemoryHandler([] (Critical critical, Synchronous synchronous) {
+        WebCore::releaseMemory(critical, synchronous);
+    });
+    handler.install();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_MemoryPressure_twkReleaseMemory
+  (JNIEnv*, jclass, jboolean critical)
+{
+    ASSERT(isMainThread());
+    WebKit::releaseMemory(critical ? Critical::Yes : Critical::No);
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryPressure_twkGetResidentMemory
+  (JNIEnv*, jclass)
+{
+    return static_cast<jlong>(residentMemory());
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryPressure_twkGetJavaScriptHeapSize
+  (JNIEnv*, jclass)
+{
+    ASSERT(isMainThread());
+    auto& vm = WebCore::commonVM();
+    JSC::JSLockHolder lock(vm);
+    return static_cast<jlong>(vm.heap.size());
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_MemoryPressure_twkStartCgroupWatcher
+  (JNIEnv*, jclass, jlong pollIntervalMillis, jdouble warningFraction, jdouble criticalFraction)
+{
+#if OS(LINUX)
+    return bool_to_jbool(CgroupMemoryWatcher::singleton().start(Seconds::fromMilliseconds(pollIntervalMillis), warningFraction, criticalFraction));
+#else
+    UNUSED_PARAM(pollIntervalMillis);
+    UNUSED_PARAM(warningFraction);
+    UNUSED_PARAM(criticalFraction);
+    return JNI_FALSE;
+#endif
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_MemoryPressure_twkStopCgroupWatcher
+  (JNIEnv*, jclass)
+{
+#if OS(LINUX)
+    CgroupMemoryWatcher::singleton().stop();
+#endif
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryPressure_twkGetCgroupMemoryLimit
+  (JNIEnv*, jclass)
+{
+#if OS(LINUX)
+    auto& watcher = CgroupMemoryWatcher::singleton();
+    if (auto limit = watcher.locateController() ? watcher.limit() : std::nullopt)
+        return static_cast<jlong>(*limit);
+#endif
+    return -1;
+}
+
+}
@@ -38,11 +38,13 @@
 #include "EditorClientJava.h"
 #include "FrameLoaderClientJava.h"
 #include "InspectorClientJava.h"
+#include "JSEngineJava.h"
 #include "PageStorageSessionProvider.h"
 #include "PlatformStrategiesJava.h"
 #include "ProgressTrackerClientJava.h"
 #include "VisitedLinkStoreJava.h"
 #include "WebKitLegacy/Storage/StorageNamespaceImpl.h"
+#include "WebKitLegacy/Storage/StorageTracker.h"
 #include "WebKitLegacy/Storage/WebDatabaseProvider.h"
 #include "WebKitVersion.h" //generated
 #include "WebPageConfig.h"
@@ -58,6 +60,7 @@
 #include <WebCore/CharacterData.h>
 #include <WebCore/Chrome.h>
 #include <WebCore/ColorTypes.h>
+#include <WebCore/CommonVM.h>
 #include <WebCore/CompositionHighlight.h>
 #include <WebCore/ContextMenu.h>
 #include <WebCore/ContextMenuController.h>
@@ -81,6 +84,7 @@
 #include <WebCore/GeolocationClientMock.h>
 #include <WebCore/GraphicsContext.h>
 #include <WebCore/GraphicsLayerTextureMapper.h>
+#include <WebCore/ImageBuffer.h>
 #include <WebCore/InspectorController.h>
 #include <WebCore/KeyboardEvent.h>
 #include <WebCore/LogInitialization.h>
@@ -88,6 +92,7 @@
 #include <WebCore/Page.h>
 #include <WebCore/PageConfiguration.h>
 #include <WebCore/PageSupplementJava.h>
+#include <WebCore/PixelBuffer.h>
 #include <WebCore/PlatformContextJava.h>
 #include <WebCore/PlatformJavaClasses.h>
 #include <WebCore/PlatformKeyboardEvent.h>
@@ -107,6 +112,7 @@
 #include <WebCore/TextureMapperLayer.h>
 #include <WebCore/WorkerThread.h>
 #include <WebCore/platform/graphics/java/GraphicsContextJava.h>
+#include <wtf/JSONValues.h>
 #include <wtf/Ref.h>
 #include <wtf/RunLoop.h>
 #include <wtf/java/JavaRef.h>
@@ -186,6 +192,7 @@ void WebPage::setSize(const IntSize& size)
 
     frameView->resize(size);
     frameView->layoutContext().scheduleLayout();
+    m_displayListCache.invalidateAll();
 
     if (m_rootLayer) {
         m_rootLayer->setSize(size);
@@ -223,6 +230,8 @@ static void drawDebugBorder(GraphicsContext& context,
 }
 
 void WebPage::prePaint() {
+    m_damageTracker.beginFrame();
+
     if (m_rootLayer) {
         if (m_syncLayers) {
             m_syncLayers = false;
@@ -235,8 +244,25 @@ void WebPage::prePaint() {
     FrameView* frameView = mainFrame->view();
     if (frameView) {
         // Updating layout & styles precedes normal painting.
+        auto startTime = MonotonicTime::now();
         frameView->updateLayoutAndStyleIfNeededRecursive();
+        m_damageTracker.didLayout(MonotonicTime::now() - startTime);
+    }
+}
+
+/*
+ * Returns the context page updates paint through, pointed at the given
+ * render queue. Reusing it keeps its buffers from being reallocated on
+ * every update.
+ */
+PlatformContextJava& WebPage::paintContext(jobject rq)
+{
+    if (!m_paintContext) {
+        m_paintContext = makeUnique<PlatformContextJava>(rq, jRenderTheme());
+    } else {
+        m_paintContext->reset(rq);
     }
+    return *m_paintContext;
 }
 
 RefPtr<RQRef> WebPage::jRenderTheme()
@@ -251,6 +277,33 @@ RefPtr<RQRef> WebPage::jRenderTheme()
 void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
 {
     if (m_rootLayer) {
+        // Composited content is painted by postPaint(); just remember the area.
+        m_compositedDamage.unite(IntRect(x, y, w, h));
+        return;
+    }
+
+    paintRects(rq, { IntRect(x, y, w, h) });
+}
+
+Vector<IntRect> WebPage::takeDamage(const IntRect& clip)
+{
+    auto rects = m_damageTracker.take(clip);
+
+    // Java clears the whole render queue clip of a transparent page before
+    // decoding, so the gaps between the rectangles have to be painted too.
+    FrameView* frameView = m_page->mainFrame().view();
+    if (rects.size() > 1 && frameView && frameView->isTransparent()) {
+        IntRect bounds;
+        for (auto& rect : rects)
+            bounds.unite(rect);
+        return { bounds };
+    }
+    return rects;
+}
+
+void WebPage::paintRects(jobject rq, const Vector<IntRect>& rects)
+{
+    if (m_rootLayer || rects.isEmpty()) {
         return;
     }
 
@@ -262,20 +315,123 @@ void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
         return;
     }
 
-    // Will be deleted by GraphicsContext destructor
-    PlatformContextJava* ppgc = new PlatformContextJava(rq, jRenderTheme());
-    GraphicsContextJava gc(ppgc);
+    GraphicsContextJava gc(paintContext(rq));
 
     // TODO: Following JS synchronization is not necessary for single thread model
     JSGlobalContextRef globalContext = toGlobalRef(mainFrame->script().globalObject(mainThreadNormalWorld()));
     JSC::JSLockHolder sw(toJS(globalContext)); // TODO-java: was JSC::APIEntryShim sw( toJS(globalContext) );
 
-    frameView->paint(gc, IntRect(x, y, w, h));
-    if (m_page->settings().showDebugBorders()) {
-        drawDebugLed(gc, IntRect(x, y, w, h), SRGBA<uint8_t> { 0, 0, 255, 128 });
+    // Cached tiles are replayed first, while the Java context is still in
+    // the state a new render queue starts with, which recordings rely on.
+    Vector<IntRect> rectsToPaint;
+    for (auto& rect : rects) {
+        auto startTime = MonotonicTime::now();
+        IntRect replayed = m_displayListCache.isEnabled()
+            ? replayCachedTiles(gc.platformContext()->rq(), *frameView, rect)
+            : IntRect();
+        if (replayed.isEmpty()) {
+            rectsToPaint.append(rect);
+            continue;
+        }
+        m_damageTracker.didPaint(replayed, MonotonicTime::now() - startTime);
+
+        Region remaining(rect);
+        remaining.subtract(Region(replayed));
+        for (auto& remainingRect : remaining.rects())
+            rectsToPaint.append(remainingRect);
+    }
+
+    for (auto& rect : rectsToPaint) {
+        auto startTime = MonotonicTime::now();
+        // The render queue clip covers all of them; keep each one to itself.
+        if (rectsToPaint.size() > 1) {
+            gc.save();
+            gc.clip(rect);
+        }
+        frameView->paint(gc, rect);
+        if (m_page->settings().showDebugBorders()) {
+            drawDebugLed(gc, rect, SRGBA<uint8_t> { 0, 0, 255, 128 });
+        }
+        if (rectsToPaint.size() > 1) {
+            gc.restore();
+        }
+        m_damageTracker.didPaint(rect, MonotonicTime::now() - startTime);
     }
 
     gc.platformContext()->rq().flushBuffer();
+    m_paintContext->releaseRQ();
+}
+
+/*
+ * Replays the recordings of the tiles that fit in the rectangle, recording
+ * the ones that are not cached. Only the document area is tiled; scrollbars
+ * are left to the caller. Returns the area covered by the replayed tiles.
+ */
+IntRect WebPage::replayCachedTiles(RenderingQueue& rq, FrameView& frameView, const IntRect& rect)
+{
+    IntRect documentArea(frameView.locationOfContents(), frameView.visibleContentRect().size());
+    IntRect tiledRect = DisplayListCache::tileAlignedRect(intersection(rect, documentArea));
+    if (tiledRect.isEmpty()) {
+        return { };
+    }
+
+    Vector<RefPtr<RenderingQueue>> tiles;
+    unsigned recorded = 0;
+    const int tileSize = DisplayListCache::tileSize;
+    for (int y = tiledRect.y(); y < tiledRect.maxY(); y += tileSize) {
+        for (int x = tiledRect.x(); x < tiledRect.maxX(); x += tileSize) {
+            auto tile = m_displayListCache.tile(IntPoint(x, y));
+            if (!tile) {
+                tile = recordTile(frameView, IntRect(x, y, tileSize, tileSize));
+                ++recorded;
+            }
+            if (!tile) {
+                return { };
+            }
+            tiles.append(WTFMove(tile));
+        }
+    }
+
+    m_damageTracker.didReplayTiles(recorded, tiles.size() - recorded);
+    for (auto& tile : tiles) {
+        rq.replay(*tile);
+    }
+    return tiledRect;
+}
+
+RefPtr<RenderingQueue> WebPage::recordTile(FrameView& frameView, const IntRect& tileRect)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(
+            PG_GetWebPageClass(env),
+            "fwkCreateDisplayList",
+            "(IIII)Lcom/sun/webkit/graphics/WCRenderQueue;");
+    ASSERT(mid);
+
+    JLObject jRQ(env->CallObjectMethod(
+            jobjectFromPage(m_page.get()),
+            mid,
+            tileRect.x(),
+            tileRect.y(),
+            tileRect.width(),
+            tileRect.height()));
+    if (WTF::CheckAndClearException(env) || !jRQ) {
+        return nullptr;
+    }
+
+    // Will be deleted by GraphicsContext destructor
+    PlatformContextJava* ppgc = new PlatformContextJava(jRQ, jRenderTheme());
+    RefPtr<RenderingQueue> tile = ppgc->rq_ref();
+    {
+        GraphicsContextJava gc(ppgc);
+        gc.clip(tileRect);
+        frameView.paint(gc, tileRect);
+        tile->flushBuffer();
+    }
+
+    m_displayListCache.setTile(tileRect.location(), tile.copyRef());
+    return tile;
 }
 
 void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
@@ -283,12 +439,11 @@ void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
     if (!m_page->inspectorController().highlightedNode()
             && !m_rootLayer
     ) {
+        m_damageTracker.endFrame();
         return;
     }
 
-    // Will be deleted by GraphicsContext destructor
-    PlatformContextJava* ppgc = new PlatformContextJava(rq, jRenderTheme());
-    GraphicsContextJava gc(ppgc);
+    GraphicsContextJava gc(paintContext(rq));
 
     if (m_rootLayer) {
         if (m_syncLayers) {
@@ -300,7 +455,7 @@ void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
             drawDebugLed(gc, IntRect(x, y, w, h), SRGBA<uint8_t> { 0, 192, 0, 128 });
         }
         if (downcast<GraphicsLayerTextureMapper>(m_rootLayer.get())->layer().descendantsOrSelfHaveRunningAnimations()) {
-            requestJavaRepaint(pageRect());
+            requestJavaLayerUpdate();
         }
     }
 
@@ -309,6 +464,8 @@ void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
     }
 
     gc.platformContext()->rq().flushBuffer();
+    m_paintContext->releaseRQ();
+    m_damageTracker.endFrame();
 }
 
 void WebPage::scroll(const IntSize& scrollDelta,
@@ -319,6 +476,9 @@ void WebPage::scroll(const IntSize& scrollDelta,
         m_rootLayer->setNeedsDisplayInRect(rectToScroll);
         return;
     }
+    m_damageTracker.scroll(rectToScroll, scrollDelta);
+    // Java copies the scrolled pixels; the tiles are in view coordinates.
+    m_displayListCache.invalidateAll();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -343,33 +503,49 @@ void WebPage::scroll(const IntSize& scrollDelta,
 void WebPage::repaint(const IntRect& rect)
 {
     if (m_rootLayer) {
+        // Reaches Java as layer damage through notifyFlushRequired().
         m_rootLayer->setNeedsDisplayInRect(rect);
+        return;
+    }
+    // Java only needs to know that there is something to paint; the exact
+    // area is taken with takeDamage() on the next update.
+    m_displayListCache.invalidate(rect);
+    if (m_damageTracker.add(rect)) {
+        requestJavaRepaint();
     }
-    requestJavaRepaint(rect);
 }
 
-void WebPage::requestJavaRepaint(const IntRect& rect)
+void WebPage::requestJavaRepaint()
 {
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(
             PG_GetWebPageClass(env),
             "fwkRepaint",
-            "(IIII)V");
+            "()V");
     ASSERT(mid);
 
-    env->CallVoidMethod(
-            jobjectFromPage(m_page.get()),
-            mid,
-            rect.x(),
-            rect.y(),
-            rect.width(),
-            rect.height());
+    env->CallVoidMethod(jobjectFromPage(m_page.get()), mid);
+    WTF::CheckAndClearException(env);
+}
+
+void WebPage::requestJavaLayerUpdate()
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(
+            PG_GetWebPageClass(env),
+            "fwkRequestLayerUpdate",
+            "()V");
+    ASSERT(mid);
+
+    env->CallVoidMethod(jobjectFromPage(m_page.get()), mid);
     WTF::CheckAndClearException(env);
 }
 
 void WebPage::setRootChildLayer(GraphicsLayer* layer)
 {
+    m_displayListCache.invalidateAll();
     if (layer) {
         m_rootLayer = GraphicsLayer::create(nullptr, *this);
         m_rootLayer->setDrawsContent(true);
@@ -382,6 +558,7 @@ void WebPage::setRootChildLayer(GraphicsLayer* layer)
     } else {
         m_rootLayer = nullptr;
         m_textureMapper.reset();
+        m_compositedDamage = IntRect();
     }
 }
 
@@ -401,7 +578,7 @@ void WebPage::markForSync()
         return;
     }
     m_syncLayers = true;
-    requestJavaRepaint(pageRect());
+    requestJavaLayerUpdate();
 }
 
 void WebPage::syncLayers()
@@ -438,13 +615,29 @@ void WebPage::renderCompositedLayers(GraphicsContext& context, const IntRect& cl
     TextureMapperLayer& rootTextureMapperLayer = downcast<GraphicsLayerTextureMapper>(*m_rootLayer).layer();
 
     static_cast<TextureMapperJava&>(*m_textureMapper).setGraphicsContext(&context);
-    TransformationMatrix matrix;
     m_textureMapper->beginPainting();
-    m_textureMapper->beginClip(matrix, FloatRoundedRect(clip));
     rootTextureMapperLayer.applyAnimationsRecursively(MonotonicTime::now());
     downcast<GraphicsLayerTextureMapper>(*m_rootLayer).updateBackingStoreIncludingSubLayers(*m_textureMapper);
-    rootTextureMapperLayer.paint(*m_textureMapper);
-    m_textureMapper->endClip();
+
+    // The back buffer keeps what was composited before, so only the layers
+    // that changed, and the areas Java asked to repaint, are composited again.
+    FloatRect damage = rootTextureMapperLayer.collectDamage();
+    damage.unite(std::exchange(m_compositedDamage, IntRect()));
+    // Without a back buffer nothing composited before is kept, and Java
+    // clears the whole clip of a transparent page before decoding.
+    FrameView* frameView = m_page->mainFrame().view();
+    if (!m_hasBackBuffer || (frameView && frameView->isTransparent()))
+        damage = clip;
+    else
+        damage.intersect(clip);
+    if (!damage.isEmpty()) {
+        auto startTime = MonotonicTime::now();
+        TransformationMatrix matrix;
+        m_textureMapper->beginClip(matrix, FloatRoundedRect(enclosingIntRect(damage)));
+        rootTextureMapperLayer.paint(*m_textureMapper);
+        m_textureMapper->endClip();
+        m_damageTracker.didPaint(enclosingIntRect(damage), MonotonicTime::now() - startTime);
+    }
     m_textureMapper->endPainting();
 }
 
@@ -743,6 +936,24 @@ void WebPage::endPrinting()
     m_printContext.reset();
 }
 
+RefPtr<ImageBuffer> WebPage::snapshot(const IntRect& rect)
+{
+    Frame& frame = m_page->mainFrame();
+    if (!frame.document() || !frame.view())
+        return nullptr;
+
+    // Paints at scale 1 into an image buffer of its own, leaving the page's
+    // frames and back buffer alone. Composited layers are flattened into
+    // the image.
+    auto buffer = ImageBuffer::create(rect.size(), RenderingMode::Unaccelerated, 1, DestinationColorSpace::SRGB(), PixelFormat::BGRA8);
+    if (!buffer)
+        return nullptr;
+
+    buffer->context().translate(-rect.x(), -rect.y());
+    frame.view()->paintContentsForSnapshot(buffer->context(), rect, FrameView::ExcludeSelection, FrameView::DocumentCoordinates);
+    return buffer;
+}
+
 void WebPage::print(GraphicsContext& gc, int pageIndex, float pageWidth)
 {
     ASSERT(m_printContext);
@@ -825,17 +1036,21 @@ namespace {
 
 bool s_useJIT;
 bool s_useDFGJIT;
+bool s_useFTLJIT;
 bool s_useCSS3D;
+bool s_useIdleTimeGC;
 
 }  // namespace
 
 extern "C" {
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInitWebCore
-    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useCSS3D) {
+    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useFTLJIT, jboolean useCSS3D, jboolean useIdleTimeGC) {
     s_useJIT = useJIT;
     s_useDFGJIT = useDFGJIT;
+    s_useFTLJIT = useFTLJIT;
     s_useCSS3D = useCSS3D;
+    s_useIdleTimeGC = useIdleTimeGC;
 }
 
 JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
@@ -864,6 +1079,17 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
         JSC::Options::useJIT() = s_useJIT;
         // Enable DFG only if JIT is enabled.
         JSC::Options::useDFGJIT() = s_useJIT && s_useDFGJIT;
+        // Enable FTL only if DFG is enabled. Builds without the FTL tier
+        // ignore the option.
+        JSC::Options::useFTLJIT() = s_useJIT && s_useDFGJIT && s_useFTLJIT;
+        // The options are already initialized, so the ones that depend
+        // on the JIT are not recomputed. WebAssembly needs the JIT.
+        if (!s_useJIT) {
+            JSC::Options::useWebAssembly() = false;
+            JSC::Options::useConcurrentJIT() = false;
+        }
+        JSC::Options::useIdleTimeCollection() = s_useIdleTimeGC;
+        WebKit::applyJSEngineProfile();
     });
 
     JLObject jlself(self, true);
@@ -927,6 +1153,8 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInit
     page->setDeviceScaleFactor(devicePixelScale);
 
     settings.setLinkPrefetchEnabled(true);
+    // Resolved ahead of the loader by DNSResolveQueueJava.
+    settings.setDNSPrefetchingEnabled(true);
 
     FrameLoaderClientJava& client =
         static_cast<FrameLoaderClientJava&>(page->mainFrame().loader().client());
@@ -1538,6 +1766,32 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkPrint
     webPage->print(gc, pageIndex, width);
 }
 
+JNIEXPORT jintArray JNICALL Java_com_sun_webkit_WebPage_twkSnapshot
+    (JNIEnv* env, jobject self, jlong pPage, jint x, jint y, jint width, jint height)
+{
+    auto buffer = WebPage::webPageFromJLong(pPage)->snapshot(IntRect(x, y, width, height));
+    if (!buffer)
+        return nullptr;
+
+    auto pixels = buffer->getPixelBuffer({ AlphaPremultiplication::Unpremultiplied, PixelFormat::BGRA8, DestinationColorSpace::SRGB() }, IntRect(0, 0, width, height));
+    if (!pixels || pixels->size() != IntSize(width, height))
+        return nullptr;
+
+    jsize length = width * height;
+    jintArray result = env->NewIntArray(length);
+    if (!result)
+        return nullptr;
+
+    const uint8_t* source = pixels->data().data();
+    jint* destination = static_cast<jint*>(env->GetPrimitiveArrayCritical(result, nullptr));
+    if (!destination)
+        return nullptr;
+    for (jsize i = 0; i < length; ++i, source += 4)
+        destination[i] = static_cast<jint>(static_cast<uint32_t>(source[3]) << 24 | source[2] << 16 | source[1] << 8 | source[0]);
+    env->ReleasePrimitiveArrayCritical(result, destination, 0);
+    return result;
+}
+
 JNIEXPORT jint JNICALL Java_com_sun_webkit_WebPage_twkGetFrameHeight
     (JNIEnv* env, jobject self, jlong pFrame)
 {
@@ -1662,10 +1916,83 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkUpdateContent
     WebPage::webPageFromJLong(pPage)->paint(rq, x, y, w, h);
 }
 
+JNIEXPORT jintArray JNICALL Java_com_sun_webkit_WebPage_twkTakeDamage
+    (JNIEnv* env, jobject self, jlong pPage, jint x, jint y, jint w, jint h)
+{
+    auto rects = WebPage::webPageFromJLong(pPage)->takeDamage(IntRect(x, y, w, h));
+    if (rects.isEmpty()) {
+        return nullptr;
+    }
+
+    jintArray result = env->NewIntArray(rects.size() * 4);
+    if (WTF::CheckAndClearException(env) || !result) {
+        return nullptr;
+    }
+
+    jint* arr = (jint*)env->GetPrimitiveArrayCritical(result, nullptr);
+    if (!arr) {
+        return nullptr;
+    }
+    for (size_t i = 0; i < rects.size(); ++i) {
+        arr[i * 4] = rects[i].x();
+        arr[i * 4 + 1] = rects[i].y();
+        arr[i * 4 + 2] = rects[i].width();
+        arr[i * 4 + 3] = rects[i].height();
+    }
+    env->ReleasePrimitiveArrayCritical(result, arr, 0);
+
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkPaintRects
+    (JNIEnv* env, jobject self, jlong pPage, jobject rq, jintArray rects)
+{
+    jsize length = env->GetArrayLength(rects);
+    Vector<IntRect> rectsToPaint;
+    rectsToPaint.reserveInitialCapacity(length / 4);
+
+    jint* arr = (jint*)env->GetPrimitiveArrayCritical(rects, nullptr);
+    if (!arr) {
+        return;
+    }
+    for (jsize i = 0; i + 3 < length; i += 4)
+        rectsToPaint.uncheckedAppend(IntRect(arr[i], arr[i + 1], arr[i + 2], arr[i + 3]));
+    env->ReleasePrimitiveArrayCritical(rects, arr, JNI_ABORT);
+
+    WebPage::webPageFromJLong(pPage)->paintRects(rq, rectsToPaint);
+}
+
+JNIEXPORT jstring JNICALL Java_com_sun_webkit_WebPage_twkGetPaintStatistics
+    (JNIEnv* env, jobject self, jlong pPage)
+{
+    return WebPage::webPageFromJLong(pPage)->damageTracker().statistics().toJavaString(env).releaseLocal();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkResetPaintStatistics
+    (JNIEnv* env, jobject self, jlong pPage)
+{
+    WebPage::webPageFromJLong(pPage)->damageTracker().resetStatistics();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetDisplayListCacheEnabled
+    (JNIEnv* env, jobject self, jlong pPage, jboolean enabled)
+{
+    WebPage::webPageFromJLong(pPage)->displayListCache().setEnabled(jbool_to_bool(enabled));
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetHasBackBuffer
+    (JNIEnv*, jobject, jlong pPage, jboolean hasBackBuffer)
+{
+    WebPage::webPageFromJLong(pPage)->setHasBackBuffer(jbool_to_bool(hasBackBuffer));
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkUpdateRendering
     (JNIEnv*, jobject, jlong pPage)
 {
-    WebPage::pageFromJLong(pPage)->isolatedUpdateRendering();
+    WebPage* webPage = WebPage::webPageFromJLong(pPage);
+    auto startTime = MonotonicTime::now();
+    webPage->page()->isolatedUpdateRendering();
+    webPage->damageTracker().didLayout(MonotonicTime::now() - startTime);
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkPostPaint
@@ -2488,10 +2815,48 @@ JNIEXPORT jint JNICALL Java_com_sun_webkit_WebPage_twkWorkerThreadCount
     return WorkerThread::workerThreadCount();
 }
 
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkIsHarfBuzzShapingEnabled
+  (JNIEnv*, jclass)
+{
+#if USE(HARFBUZZ_SHAPING)
+    return JNI_TRUE;
+#else
+    return JNI_FALSE;
+#endif
+}
+
+JNIEXPORT jstring JNICALL Java_com_sun_webkit_WebPage_twkGetLocalStorageStatistics
+  (JNIEnv* env, jclass, jstring url)
+{
+    auto origin = SecurityOriginData::fromURL(URL(URL(), String(env, url)));
+    auto metrics = WebKit::StorageTracker::tracker().metricsForOrigin(origin.databaseIdentifier());
+    if (!metrics)
+        return nullptr;
+
+    auto result = JSON::Object::create();
+    result->setDouble("importMillis"_s, metrics->importDuration.milliseconds());
+    result->setInteger("importedItemCount"_s, metrics->importedItemCount);
+    result->setDouble("syncCount"_s, metrics->syncCount);
+    result->setDouble("syncedItemCount"_s, metrics->syncedItemCount);
+    result->setDouble("lastSyncMillis"_s, metrics->lastSyncDuration.milliseconds());
+    result->setDouble("maxSyncMillis"_s, metrics->maxSyncDuration.milliseconds());
+    result->setDouble("totalSyncMillis"_s, metrics->totalSyncDuration.milliseconds());
+    result->setDouble("syncIntervalMillis"_s, metrics->syncInterval.milliseconds());
+    return result->toJSONString().toJavaString(env).releaseLocal();
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkDoJSCGarbageCollection
   (JNIEnv*, jclass)
 {
     GCController::singleton().garbageCollectNow();
 }
 
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkCollectDuringIdleTime
+  (JNIEnv*, jclass, jlong budgetNanos)
+{
+    JSC::VM& vm = commonVM();
+    JSC::JSLockHolder lock(vm);
+    return bool_to_jbool(vm.heap.collectDuringIdleTime(Seconds::fromNanoseconds(budgetNanos)));
+}
+
 }
@@ -25,6 +25,8 @@
 
 #pragma once
 
+#include "DamageTracker.h"
+#include "DisplayListCache.h"
 #include <wtf/OptionSet.h>
 #include <wtf/java/JavaRef.h>
 #include <WebCore/GraphicsLayerClient.h>
@@ -38,12 +40,15 @@
 namespace WebCore {
 
 class Frame;
+class FrameView;
 class GraphicsContext;
 class GraphicsLayer;
+class ImageBuffer;
 class IntRect;
 class IntSize;
 class Node;
 class Page;
+class PlatformContextJava;
 class PlatformKeyboardEvent;
 class TextureMapper;
 
@@ -83,6 +88,8 @@ public:
     void setSize(const IntSize&);
     void prePaint();
     void paint(jobject, jint, jint, jint, jint);
+    Vector<IntRect> takeDamage(const IntRect& clip);
+    void paintRects(jobject, const Vector<IntRect>&);
     void postPaint(jobject, jint, jint, jint, jint);
     bool processKeyEvent(const PlatformKeyboardEvent& event);
 
@@ -92,6 +99,7 @@ public:
     int beginPrinting(float width, float height);
     void print(GraphicsContext& gc, int pageIndex, float pageWidth);
     void endPrinting();
+    RefPtr<ImageBuffer> snapshot(const IntRect&);
     void setRootChildLayer(GraphicsLayer*);
     void setNeedsOneShotDrawingSynchronization();
     void scheduleRenderingUpdate();
@@ -101,13 +109,20 @@ public:
     void disableWatchdog();
 
     RefPtr<RQRef> jRenderTheme();
+    DamageTracker& damageTracker() { return m_damageTracker; }
+    DisplayListCache& displayListCache() { return m_displayListCache; }
+    void setHasBackBuffer(bool hasBackBuffer) { m_hasBackBuffer = hasBackBuffer; }
 
 private:
-    void requestJavaRepaint(const IntRect&);
+    void requestJavaRepaint();
+    void requestJavaLayerUpdate();
     void markForSync();
     void syncLayers();
     IntRect pageRect();
     void renderCompositedLayers(GraphicsContext&, const IntRect&);
+    PlatformContextJava& paintContext(jobject);
+    IntRect replayCachedTiles(RenderingQueue&, FrameView&, const IntRect&);
+    RefPtr<RenderingQueue> recordTile(FrameView&, const IntRect&);
 
     // GraphicsLayerClient
     void notifyAnimationStarted(const GraphicsLayer*, const String& /*animationKey*/, MonotonicTime /*time*/) override;
@@ -129,10 +144,17 @@ private:
     std::unique_ptr<Page> m_page;
     std::unique_ptr<PrintContext> m_printContext;
     RefPtr<RQRef> m_jRenderTheme;
+    std::unique_ptr<PlatformContextJava> m_paintContext;
 
     RefPtr<GraphicsLayer> m_rootLayer;
     std::unique_ptr<TextureMapper> m_textureMapper;
     bool m_syncLayers { false };
+    DamageTracker m_damageTracker;
+    DisplayListCache m_displayListCache;
+    // Areas Java asked to repaint while in compositing mode.
+    IntRect m_compositedDamage;
+    // Whether Java keeps the painted page in a back buffer between frames.
+    bool m_hasBackBuffer { false };
 
     // Webkit expects keyPress events to be suppressed if the associated keyDown
     // event was handled. Safari implements this behavior by peeking out the
@@ -107,8 +107,26 @@ WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEB_AUDIO PRIVATE OFF)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEB_CRYPTO PRIVATE OFF)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_PUBLIC_SUFFIX_LIST PRIVATE OFF)
 
-WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_FTL_JIT PUBLIC OFF)
-WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEBASSEMBLY PRIVATE OFF)
+WEBKIT_OPTION_DEFINE(USE_HARFBUZZ_SHAPING "Whether to shape complex text natively with HarfBuzz instead of the Java text layout." PRIVATE OFF)
+
+# HarfBuzz is not bundled, but it is part of every Linux desktop that runs
+# the GTK glass port, so shape natively there whenever it can be found.
+if (WTF_OS_LINUX)
+    find_package(HarfBuzz 2.0.0 QUIET)
+    if (HarfBuzz_FOUND)
+        WEBKIT_OPTION_DEFAULT_PORT_VALUE(USE_HARFBUZZ_SHAPING PRIVATE ON)
+    endif ()
+endif ()
+
+# The FTL tier, and the B3 backend WebAssembly's BBQ and OMG tiers share
+# with it, are only brought up on Linux x86_64 so far.
+if (WTF_OS_LINUX AND WTF_CPU_X86_64)
+    WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_FTL_JIT PUBLIC ON)
+    WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEBASSEMBLY PRIVATE ON)
+else ()
+    WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_FTL_JIT PUBLIC OFF)
+    WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEBASSEMBLY PRIVATE OFF)
+endif ()
 
 if (WIN32)
     # FIXME: Port bmalloc to Windows. https://bugs.webkit.org/show_bug.cgi?id=143310
@@ -124,6 +142,9 @@ endif ()
 # this point, and do not attempt to change any option after this point.
 WEBKIT_OPTION_END()
 
+if (USE_HARFBUZZ_SHAPING)
+    find_package(HarfBuzz 2.0.0 REQUIRED)
+endif ()
 
 set(ENABLE_WEBKIT_LEGACY ON)
 set(ENABLE_WEBKIT OFF)
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.webkit.network;
+
+import com.sun.webkit.network.DNSResolverShim;
+import java.net.InetAddress;
+import java.net.UnknownHostException;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+
+public class DNSResolverTest {
+
+    private static final long LOOKUP_DELAY_MILLIS = 50;
+    private static final int ORIGIN_COUNT = 16;
+
+    private final AtomicInteger lookupCount = new AtomicInteger();
+
+    /**
+     * A resolver that answers every "*.test" name with a loopback
+     * address after a fixed delay, and fails everything else.
+     */
+    private InetAddress[] stubLookup(String host) {
+        lookupCount.incrementAndGet();
+        try {
+            Thread.sleep(LOOKUP_DELAY_MILLIS);
+            if (!host.endsWith(".test")) {
+                throw new UnknownHostException(host);
+            }
+            return new InetAddress[] {
+                InetAddress.getByAddress(host, new byte[] {127, 0, 0, 1})
+            };
+        } catch (InterruptedException | UnknownHostException ex) {
+            throw new RuntimeException(ex);
+        }
+    }
+
+    private static InetAddress[] get(CompletableFuture<InetAddress[]> f)
+            throws Exception
+    {
+        return f.get(10, TimeUnit.SECONDS);
+    }
+
+    private static String origin(String prefix, int i) {
+        return prefix + i + ".test";
+    }
+
+    @Before
+    public void before() {
+        DNSResolverShim.setLookup(this::stubLookup);
+    }
+
+    @After
+    public void after() {
+        DNSResolverShim.setLookup(null);
+    }
+
+    @Test
+    public void testPrefetchedNamesAreReused() throws Exception {
+        // Prefetch the names in parallel, as DNSResolveQueueJava does
+        // while the page is parsed
+        CompletableFuture<?>[] prefetches = new CompletableFuture<?>[ORIGIN_COUNT];
+        for (int i = 0; i < ORIGIN_COUNT; i++) {
+            prefetches[i] = DNSResolverShim.resolve(origin("warm", i));
+        }
+        CompletableFuture.allOf(prefetches).get(10, TimeUnit.SECONDS);
+        assertEquals(ORIGIN_COUNT, lookupCount.get());
+
+        // Resolving them again is answered from the cache
+        for (int i = 0; i < ORIGIN_COUNT; i++) {
+            CompletableFuture<InetAddress[]> f = DNSResolverShim.resolve(origin("warm", i));
+            assertTrue(f.isDone());
+            assertEquals("127.0.0.1", get(f)[0].getHostAddress());
+        }
+        assertEquals(ORIGIN_COUNT, lookupCount.get());
+    }
+
+    @Test
+    public void testConcurrentRequestsShareLookup() throws Exception {
+        CompletableFuture<InetAddress[]> first = DNSResolverShim.resolve("shared.test");
+        CompletableFuture<InetAddress[]> second = DNSResolverShim.resolve("shared.test");
+        InetAddress[] addresses = get(first);
+        assertEquals(1, addresses.length);
+        assertEquals("127.0.0.1", addresses[0].getHostAddress());
+        assertTrue(addresses == get(second));
+        assertEquals(1, lookupCount.get());
+    }
+
+    @Test
+    public void testFailuresAreNotCached() throws Exception {
+        for (int i = 0; i < 2; i++) {
+            try {
+                get(DNSResolverShim.resolve("missing.invalid"));
+                fail("ExecutionException expected but not thrown");
+            } catch (ExecutionException expected) {}
+        }
+        assertEquals(2, lookupCount.get());
+    }
+}
@@ -125,6 +125,98 @@ public class CanvasTest extends TestBase {
         });
     }
 
+    @Test public void testCanvasIsPointInPath() {
+        loadContent("<canvas id='canvas' width='200' height='200'></canvas> <script>"
+                + "var ctx = document.getElementById('canvas').getContext('2d');"
+                + "</script>");
+        submit(() -> {
+            // Two nested squares wound the same way: the inner one is inside
+            // for nonzero and outside for evenodd.
+            getEngine().executeScript("ctx.beginPath();"
+                    + "ctx.rect(10, 10, 100, 100);"
+                    + "ctx.rect(40, 40, 40, 40);");
+            assertEquals(true, getEngine().executeScript("ctx.isPointInPath(20, 20)"));
+            assertEquals(true, getEngine().executeScript("ctx.isPointInPath(60, 60, 'nonzero')"));
+            assertEquals(false, getEngine().executeScript("ctx.isPointInPath(60, 60, 'evenodd')"));
+            assertEquals(false, getEngine().executeScript("ctx.isPointInPath(150, 150)"));
+
+            // Curves are hit-tested against the curve, not its control points.
+            getEngine().executeScript("ctx.beginPath();"
+                    + "ctx.arc(100, 100, 50, 0, 2 * Math.PI);");
+            assertEquals(true, getEngine().executeScript("ctx.isPointInPath(100, 100)"));
+            assertEquals(true, getEngine().executeScript("ctx.isPointInPath(145, 100)"));
+            assertEquals(false, getEngine().executeScript("ctx.isPointInPath(140, 140)"));
+
+            getEngine().executeScript("ctx.beginPath();"
+                    + "ctx.ellipse(100, 100, 80, 20, 0, 0, 2 * Math.PI);");
+            assertEquals(true, getEngine().executeScript("ctx.isPointInPath(170, 100)"));
+            assertEquals(false, getEngine().executeScript("ctx.isPointInPath(100, 130)"));
+        });
+    }
+
+    // Pixels written with putImageData are uploaded to the texture by dirty
+    // rectangle before the next draw. Interleave sub-rectangle writes, some
+    // overlapping and some repeated, with draws and compare the result (and a
+    // copy drawn into a second canvas) against a plain pixel model.
+    @Test public void testPutImageDataRoundTrip() {
+        loadContent("<canvas id='canvas' width='64' height='64'></canvas>"
+                + "<canvas id='copy' width='64' height='64'></canvas>");
+        submit(() -> {
+            final Object result = getEngine().executeScript(""
+                + "var ctx = document.getElementById('canvas').getContext('2d');\n"
+                + "var model = [];\n"
+                + "function fill(x, y, w, h, c) {\n"
+                + "    for (var j = y; j < y + h; j++)\n"
+                + "        for (var i = x; i < x + w; i++)\n"
+                + "            model[j * 64 + i] = c;\n"
+                + "}\n"
+                + "function put(x, y, w, h, c) {\n"
+                + "    var img = ctx.createImageData(w, h);\n"
+                + "    for (var k = 0; k < w * h; k++)\n"
+                + "        img.data.set(c, k * 4);\n"
+                + "    ctx.putImageData(img, x, y);\n"
+                + "    fill(x, y, w, h, c);\n"
+                + "}\n"
+                + "function rect(x, y, w, h, c) {\n"
+                + "    ctx.fillStyle = 'rgb(' + c[0] + ',' + c[1] + ',' + c[2] + ')';\n"
+                + "    ctx.fillRect(x, y, w, h);\n"
+                + "    fill(x, y, w, h, c);\n"
+                + "}\n"
+                + "var red = [255, 0, 0, 255], green = [0, 255, 0, 255],\n"
+                + "    blue = [0, 0, 255, 255], white = [255, 255, 255, 255];\n"
+                + "rect(0, 0, 64, 64, blue);\n"
+                + "put(8, 8, 16, 16, red);\n"
+                + "rect(40, 40, 8, 8, green);\n"
+                // Overlaps the red square and the green draw.
+                + "put(16, 16, 32, 8, white);\n"
+                + "put(36, 20, 16, 24, red);\n"
+                + "rect(0, 56, 64, 8, green);\n"
+                // The same rectangle, uploaded repeatedly.
+                + "for (var n = 0; n < 4; n++) {\n"
+                + "    put(2, 40, 10, 10, n % 2 ? green : white);\n"
+                + "    rect(60, 0, 4, 4, n % 2 ? white : red);\n"
+                + "}\n"
+                // Only part of the image data is written.
+                + "var part = ctx.createImageData(20, 20);\n"
+                + "for (var k = 0; k < 400; k++) part.data.set(green, k * 4);\n"
+                + "ctx.putImageData(part, 50, 2, 5, 5, 10, 10);\n"
+                + "fill(55, 7, 9, 10, green);\n"
+                + "var copy = document.getElementById('copy').getContext('2d');\n"
+                + "copy.drawImage(ctx.canvas, 0, 0);\n"
+                + "function check(context, name) {\n"
+                + "    var d = context.getImageData(0, 0, 64, 64).data;\n"
+                + "    for (var p = 0; p < 64 * 64; p++)\n"
+                + "        for (var b = 0; b < 4; b++)\n"
+                + "            if (d[p * 4 + b] !== model[p][b])\n"
+                + "                return name + ' (' + p % 64 + ',' + Math.floor(p / 64) + '): '\n"
+                + "                    + Array.prototype.slice.call(d, p * 4, p * 4 + 4) + ' != ' + model[p];\n"
+                + "    return null;\n"
+                + "}\n"
+                + "check(ctx, 'canvas') || check(copy, 'copy') || 'ok';");
+            assertEquals("ok", result);
+        });
+    }
+
     // JDK-8234471
     @Test public void testCanvasPattern() throws Exception {
         final String htmlCanvasContent = "\n"
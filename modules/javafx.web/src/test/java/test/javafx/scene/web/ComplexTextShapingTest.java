@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.WebPage;
+import java.awt.GraphicsEnvironment;
+import java.util.Locale;
+import javafx.scene.text.Font;
+import javafx.scene.text.Text;
+import org.junit.Before;
+import org.junit.Test;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assume.assumeTrue;
+
+/**
+ * Checks the advances and cluster mapping of text shaped natively with
+ * HarfBuzz against the Java text layout. Runs only in builds with the
+ * {@code USE_HARFBUZZ_SHAPING} option, which Linux builds turn on when
+ * HarfBuzz is installed.
+ */
+public class ComplexTextShapingTest extends TestBase {
+
+    private static final double SIZE = 32;
+    // Joined beh forms, and the lam-alef ligature
+    private static final String ARABIC = "ببب لا";
+    // A reordered vowel sign, and the ksha conjunct
+    private static final String DEVANAGARI = "किताब क्ष";
+
+    @Before public void requireNativeShaping() {
+        assumeTrue("Built without USE_HARFBUZZ_SHAPING", WebPage.isHarfBuzzShapingEnabled());
+    }
+
+    /**
+     * Returns a family whose regular font covers the whole text by itself.
+     * HarfBuzz only sees the primary font, so text that needs a fallback
+     * font would be left to the Java text layout.
+     */
+    private static String familyFor(String text) {
+        String[] families = GraphicsEnvironment.getLocalGraphicsEnvironment()
+                .getAvailableFontFamilyNames(Locale.ROOT);
+        for (String family : families) {
+            if (new java.awt.Font(family, java.awt.Font.PLAIN, 16).canDisplayUpTo(text) == -1
+                    && Font.getFamilies().contains(family)) {
+                return family;
+            }
+        }
+        assumeTrue("No font covers " + text, false);
+        return null;
+    }
+
+    private void loadText(String family, String text) {
+        loadContent("<body style='margin:0'><span id='s' style=\"white-space:pre;font:"
+                + SIZE + "px '" + family + "'\">" + text + "</span></body>");
+    }
+
+    /**
+     * Returns the width of the characters from start to end of the loaded
+     * text, as WebCore measures them.
+     */
+    private double rangeWidth(int start, int end) {
+        return ((Number) executeScript("var r = document.createRange();"
+                + " var t = document.getElementById('s').firstChild;"
+                + " r.setStart(t, " + start + "); r.setEnd(t, " + end + ");"
+                + " r.getBoundingClientRect().width")).doubleValue();
+    }
+
+    private void checkAdvances(String text) {
+        String family = familyFor(text);
+        loadText(family, text);
+        double shaped = rangeWidth(0, text.length());
+        double expected = submit(() -> {
+            Text node = new Text(text);
+            node.setFont(Font.font(family, SIZE));
+            return node.getLayoutBounds().getWidth();
+        });
+        assertEquals(family + ": " + text, expected, shaped, Math.max(1, expected * 0.01));
+    }
+
+    @Test public void testArabicAdvancesMatchJavaLayout() {
+        checkAdvances(ARABIC);
+    }
+
+    @Test public void testDevanagariAdvancesMatchJavaLayout() {
+        checkAdvances(DEVANAGARI);
+    }
+
+    @Test public void testJoinedFormsDifferFromIsolatedForms() {
+        String family = familyFor(ARABIC);
+        loadText(family, "ببب ب");
+        double joined = rangeWidth(0, 3);
+        double isolated = rangeWidth(4, 5);
+        assertTrue(family + ": joined " + joined + ", isolated " + isolated,
+                Math.abs(joined - 3 * isolated) > 0.5);
+    }
+
+    @Test public void testLigatureClusterCoversBothCharacters() {
+        String family = familyFor(ARABIC);
+        loadText(family, "لا");
+        double whole = rangeWidth(0, 2);
+        double lam = rangeWidth(0, 1);
+        double alef = rangeWidth(1, 2);
+        // Both characters map to the one ligature glyph, which is split
+        // between them; neither may come out empty or take it all.
+        assertTrue(family + ": " + lam + " + " + alef + " of " + whole,
+                lam > whole / 4 && alef > whole / 4 && Math.abs(lam + alef - whole) < 1);
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngineShim;
+import javafx.stage.Stage;
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+
+/**
+ * Checks the pixels of a composited layer as it moves, so that damage
+ * tracking neither leaves the layer behind nor misses its new position.
+ * Run with {@code -Dcom.sun.webkit.pagebackbuffer=false} as well to cover
+ * full composition without a back buffer.
+ */
+public class CompositedLayerTest extends TestBase {
+
+    private static final int BACKGROUND = 0xFF0A141E;
+    private static final int LAYER = 0xFFC80000;
+
+    private Stage stage;
+
+    @Before public void setUp() {
+        submit(() -> {
+            WebEngineShim.getPage(getEngine()).overridePreference(
+                    "WebKitAcceleratedCompositingEnabled", "1");
+            stage = new Stage();
+            stage.setScene(new Scene(getView(), 200, 100));
+            stage.show();
+        });
+        loadContent("<body style='margin:0;background:rgb(10,20,30)'>"
+                + "<div id='layer' style='position:absolute;left:0;top:0;width:50px;height:50px;"
+                + "background:rgb(200,0,0);will-change:transform'></div></body>");
+    }
+
+    @After public void tearDown() {
+        submit(() -> stage.close());
+    }
+
+    private void moveLayer(int x) {
+        executeScript("document.getElementById('layer').style.transform = 'translateX(" + x + "px)'");
+    }
+
+    @Test public void testMovedLayerIsRecomposited() {
+        waitForPixel(25, 25, LAYER);
+        waitForPixel(125, 25, BACKGROUND);
+
+        moveLayer(50);
+        waitForPixel(75, 25, LAYER);
+        waitForPixel(25, 25, BACKGROUND);
+
+        moveLayer(100);
+        waitForPixel(125, 25, LAYER);
+        waitForPixel(25, 25, BACKGROUND);
+        waitForPixel(75, 25, BACKGROUND);
+    }
+
+    @Test public void testRepaintBehindLayer() {
+        waitForPixel(25, 25, LAYER);
+        executeScript("document.body.style.background = 'rgb(0,200,0)'");
+        waitForPixel(125, 25, 0xFF00C800);
+        waitForPixel(25, 25, LAYER);
+    }
+}
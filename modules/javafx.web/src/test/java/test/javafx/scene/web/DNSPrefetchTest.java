@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.network.DNSResolverShim;
+import java.net.InetAddress;
+import java.net.UnknownHostException;
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+
+import static org.junit.Assert.assertTrue;
+
+/**
+ * Checks that the host names a page asks to prefetch reach the
+ * resolver through DNSResolveQueueJava while the page loads.
+ */
+public class DNSPrefetchTest extends TestBase {
+
+    private final Set<String> lookedUp = ConcurrentHashMap.newKeySet();
+
+    @Before public void setUp() {
+        DNSResolverShim.setLookup(host -> {
+            lookedUp.add(host);
+            try {
+                return new InetAddress[] {
+                    InetAddress.getByAddress(host, new byte[] {127, 0, 0, 1})
+                };
+            } catch (UnknownHostException ex) {
+                throw new RuntimeException(ex);
+            }
+        });
+    }
+
+    @After public void tearDown() {
+        DNSResolverShim.setLookup(null);
+    }
+
+    private void waitForLookup(String host) throws InterruptedException {
+        // DNSResolveQueue coalesces the names for about a second
+        long deadline = System.currentTimeMillis() + 10000;
+        while (!lookedUp.contains(host)) {
+            assertTrue("Not prefetched: " + host + ", looked up: " + lookedUp,
+                    System.currentTimeMillis() < deadline);
+            Thread.sleep(50);
+        }
+    }
+
+    @Test public void testLinkDNSPrefetch() throws InterruptedException {
+        loadContent("<head>"
+                + "<link rel='dns-prefetch' href='http://prefetch-one.test/'>"
+                + "<link rel='dns-prefetch' href='https://prefetch-two.test:8443/'>"
+                + "</head><body>No request is made to either host</body>");
+        waitForLookup("prefetch-one.test");
+        waitForLookup("prefetch-two.test");
+    }
+}
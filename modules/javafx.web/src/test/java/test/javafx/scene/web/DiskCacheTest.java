@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.DiskCache;
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+import java.util.concurrent.atomic.AtomicInteger;
+import javafx.scene.web.WebEngine;
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+import test.javafx.scene.web.TestHttpServer.Response;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+
+public class DiskCacheTest extends TestBase {
+
+    private static final long CAPACITY = 10 * 1024 * 1024;
+    private static final String BODY = "<html><body><p id='p'>cached</p></body></html>";
+
+    private File directory;
+    private TestHttpServer server;
+    private final AtomicInteger versions = new AtomicInteger();
+    private final List<String> requests = Collections.synchronizedList(new ArrayList<>());
+
+    @Before public void setUp() throws IOException {
+        directory = Files.createTempDirectory("diskcache").toFile();
+        submit(() -> DiskCache.setDirectory(directory, CAPACITY));
+
+        server = new TestHttpServer(this::handle);
+    }
+
+    @After public void tearDown() throws IOException {
+        submit(() -> DiskCache.setDirectory(null, 0));
+        server.close();
+        File[] files = directory.listFiles();
+        if (files != null) {
+            for (File file : files) {
+                file.delete();
+            }
+        }
+        directory.delete();
+    }
+
+    /**
+     * Records each request as "path" or "path If-None-Match: value".
+     */
+    private Response handle(TestHttpServer.Request request) {
+        String path = request.getPath();
+        String ifNoneMatch = request.getHeader("If-None-Match");
+        requests.add(ifNoneMatch == null ? path : path + " If-None-Match: " + ifNoneMatch);
+        switch (path) {
+            case "/fresh.html":
+                return Response.ok("text/html", BODY).header("Cache-Control", "max-age=3600");
+            case "/etag.html":
+                if ("\"v1\"".equals(ifNoneMatch)) {
+                    return Response.status(304, "Not Modified").header("ETag", "\"v1\"");
+                }
+                return Response.ok("text/html", BODY)
+                        .header("Cache-Control", "no-cache").header("ETag", "\"v1\"");
+            case "/versions.html":
+                // Every response is longer than the one before
+                int version = versions.incrementAndGet();
+                return Response.ok("text/html", "<html><body><p id='p'>" + version + "</p>"
+                        + "x".repeat(version * 1000) + "</body></html>")
+                        .header("Cache-Control", "max-age=3600");
+            default:
+                return Response.ok("text/html", BODY).header("Cache-Control", "no-store");
+        }
+    }
+
+    private String url(String path) {
+        return server.url(path);
+    }
+
+    /**
+     * Loads a URL twice, with another page in between, and waits for the
+     * first response to be written to the cache.
+     */
+    private void loadTwice(String path, boolean storable) {
+        long stores = submit(() -> DiskCache.getStoreCount());
+        load(url(path));
+        assertEquals("cached", executeScript("document.getElementById('p').textContent"));
+        if (storable) {
+            waitForStore(stores);
+        }
+        loadContent("<p>other</p>");
+        load(url(path));
+        assertEquals("cached", executeScript("document.getElementById('p').textContent"));
+    }
+
+    private void waitForStore(long stores) {
+        long deadline = System.currentTimeMillis() + 5000;
+        while (submit(() -> DiskCache.getStoreCount()) == stores) {
+            if (System.currentTimeMillis() > deadline) {
+                fail("Response not stored");
+            }
+            try {
+                Thread.sleep(10);
+            } catch (InterruptedException ex) {
+                throw new AssertionError(ex);
+            }
+        }
+    }
+
+    @Test public void testFreshResponseIsServedFromCache() {
+        long hits = submit(() -> DiskCache.getHitCount());
+        loadTwice("/fresh.html", true);
+        assertEquals(List.of("/fresh.html"), requests);
+        assertTrue(submit(() -> DiskCache.getHitCount()) > hits);
+    }
+
+    @Test public void testStaleResponseIsRevalidated() {
+        long validations = submit(() -> DiskCache.getValidationCount());
+        loadTwice("/etag.html", true);
+        assertEquals(List.of("/etag.html", "/etag.html If-None-Match: \"v1\""), requests);
+        assertEquals(validations + 1, (long) submit(() -> DiskCache.getValidationCount()));
+    }
+
+    @Test public void testNoStoreResponseIsNotCached() {
+        loadTwice("/nostore.html", false);
+        assertEquals(List.of("/nostore.html", "/nostore.html"), requests);
+        assertEquals(0, (long) submit(() -> DiskCache.getSize()));
+    }
+
+    @Test public void testEntriesSurviveReopening() {
+        long stores = submit(() -> DiskCache.getStoreCount());
+        load(url("/fresh.html"));
+        waitForStore(stores);
+        long size = submit(() -> DiskCache.getSize());
+        assertTrue(size > 0);
+
+        submit(() -> {
+            DiskCache.setDirectory(null, 0);
+            assertEquals(0, DiskCache.getSize());
+            DiskCache.setDirectory(directory, CAPACITY);
+            assertEquals(size, DiskCache.getSize());
+        });
+        loadContent("<p>other</p>");
+        load(url("/fresh.html"));
+        assertEquals(List.of("/fresh.html"), requests);
+    }
+
+    private File[] bodyFiles() {
+        File[] files = directory.listFiles((dir, name) -> name.endsWith(".body"));
+        return files != null ? files : new File[0];
+    }
+
+    @Test public void testBodiesAreWrittenAndCleared() throws IOException, InterruptedException {
+        long stores = submit(() -> DiskCache.getStoreCount());
+        load(url("/fresh.html"));
+        waitForStore(stores);
+
+        File[] bodies = bodyFiles();
+        assertEquals(1, bodies.length);
+        assertEquals(BODY, new String(Files.readAllBytes(bodies[0].toPath()), "UTF-8"));
+        assertEquals(0, directory.listFiles((dir, name) -> name.endsWith(".tmp")).length);
+
+        // The files are deleted on the cache's I/O thread
+        submit(() -> DiskCache.clear());
+        long deadline = System.currentTimeMillis() + 5000;
+        while (bodyFiles().length > 0) {
+            assertTrue("Bodies not deleted", System.currentTimeMillis() < deadline);
+            Thread.sleep(10);
+        }
+        assertEquals(0, (long) submit(() -> DiskCache.getSize()));
+    }
+
+    /**
+     * Two engines load the same URL at once, so that two stores of one key
+     * are in flight together. The entry left must describe the body that
+     * was written last.
+     */
+    @Test public void testConcurrentStoresOfOneURL() {
+        WebEngine other = submit(() -> {
+            WebEngine engine = new WebEngine();
+            engine.load(url("/versions.html"));
+            getEngine().load(url("/versions.html"));
+            return engine;
+        });
+        waitLoadFinished();
+        // Both responses are stored once both loads are done, and the
+        // entry appears when the last write completes.
+        long deadline = System.currentTimeMillis() + 5000;
+        while (submit(() -> other.getLoadWorker().isRunning() || DiskCache.getSize() == 0)) {
+            assertTrue("Response not stored", System.currentTimeMillis() < deadline);
+            try {
+                Thread.sleep(10);
+            } catch (InterruptedException ex) {
+                throw new AssertionError(ex);
+            }
+        }
+        assertEquals(2, requests.size());
+
+        long hits = submit(() -> DiskCache.getHitCount());
+        loadContent("<p>other</p>");
+        load(url("/versions.html"));
+        assertEquals(2, requests.size());
+        assertEquals(hits + 1, (long) submit(() -> DiskCache.getHitCount()));
+        int version = Integer.parseInt((String) executeScript(
+                "document.getElementById('p').textContent"));
+        assertEquals(version * 1000, ((Number) executeScript(
+                "document.body.textContent.length - 1")).intValue());
+    }
+
+    @Test(expected = IllegalStateException.class)
+    public void testSetDirectoryOffEventThread() {
+        DiskCache.setDirectory(directory, CAPACITY);
+    }
+}
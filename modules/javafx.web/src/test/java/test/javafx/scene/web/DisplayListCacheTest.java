@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.WebPage;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+import javafx.scene.Scene;
+import javafx.scene.image.PixelReader;
+import javafx.scene.image.WritableImage;
+import javafx.scene.web.WebEngineShim;
+import javafx.stage.Stage;
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+
+/**
+ * Checks that replaying recorded tiles paints the same pixels as walking
+ * the render tree, and that invalidated tiles are recorded again.
+ */
+public class DisplayListCacheTest extends TestBase {
+
+    private static final int SIZE = 600;
+    private static final int RED = 0xFFC80000;
+    private static final int BLUE = 0xFF0000C8;
+    // The marker lies within the tile at 256,256.
+    private static final int MARKER = 320;
+
+    private WebPage page;
+    private Stage stage;
+
+    @Before public void setUp() {
+        submit(() -> {
+            page = WebEngineShim.getPage(getEngine());
+            page.setDisplayListCacheEnabled(true);
+            stage = new Stage();
+            stage.setScene(new Scene(getView(), SIZE, SIZE));
+            stage.show();
+        });
+        loadContent("<body style='margin:0;overflow:hidden;"
+                + "background:linear-gradient(45deg,rgb(10,20,30),rgb(220,230,240))'>"
+                + "<p style='font:24px serif;margin:100px'>The quick brown fox jumps over the lazy dog</p>"
+                + "<div style='position:absolute;left:200px;top:20px;width:300px;height:150px;"
+                + "border-radius:30px;background:rgba(0,160,0,0.5)'></div>"
+                + "<div id='marker' style='position:absolute;left:" + (MARKER - 20) + "px;top:"
+                + (MARKER - 20) + "px;width:40px;height:40px;background:rgb(200,0,0)'></div>"
+                + "</body>");
+        waitForPixel(MARKER, MARKER, RED);
+    }
+
+    @After public void tearDown() {
+        submit(() -> stage.close());
+    }
+
+    /**
+     * Repaints the whole page and returns a snapshot of the result together
+     * with the paint statistics of that repaint.
+     */
+    private WritableImage repaint(String[] statistics) {
+        return submit(() -> {
+            page.resetPaintStatistics();
+            page.forceRepaint();
+            statistics[0] = page.getPaintStatistics();
+            return getView().snapshot(null, null);
+        });
+    }
+
+    private static long count(String statistics, String key) {
+        Matcher matcher = Pattern.compile("\"" + key + "\":(\\d+)").matcher(statistics);
+        assertTrue(statistics, matcher.find());
+        return Long.parseLong(matcher.group(1));
+    }
+
+    @Test public void testReplayedTilesMatchDirectPaint() {
+        String[] statistics = new String[1];
+        repaint(statistics);
+        WritableImage cached = repaint(statistics);
+        assertEquals(statistics[0], 0, count(statistics[0], "tilesRecorded"));
+        assertEquals(statistics[0], 4, count(statistics[0], "tilesReused"));
+
+        submit(() -> page.setDisplayListCacheEnabled(false));
+        WritableImage direct = repaint(statistics);
+        assertEquals(statistics[0], 0, count(statistics[0], "tilesReused"));
+
+        PixelReader cachedPixels = cached.getPixelReader();
+        PixelReader directPixels = direct.getPixelReader();
+        for (int y = 0; y < SIZE; y++) {
+            for (int x = 0; x < SIZE; x++) {
+                int expected = directPixels.getArgb(x, y);
+                int actual = cachedPixels.getArgb(x, y);
+                if (expected != actual) {
+                    fail(String.format("Expected %08X at %d,%d but was %08X", expected, x, y, actual));
+                }
+            }
+        }
+    }
+
+    @Test public void testInvalidatedTileIsRecordedAgain() {
+        String[] statistics = new String[1];
+        repaint(statistics);
+
+        // Too small to be tiled, so it is painted directly and only drops
+        // the recording of the tile it lies in.
+        executeScript("document.getElementById('marker').style.background = 'rgb(0,0,200)'");
+        waitForPixel(MARKER, MARKER, BLUE);
+
+        WritableImage image = repaint(statistics);
+        assertEquals(statistics[0], 1, count(statistics[0], "tilesRecorded"));
+        assertEquals(statistics[0], 3, count(statistics[0], "tilesReused"));
+        assertEquals(BLUE, image.getPixelReader().getArgb(MARKER, MARKER));
+    }
+}
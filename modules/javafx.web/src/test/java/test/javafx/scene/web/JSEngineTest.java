@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.JSEngine;
+import java.util.List;
+import java.util.Map;
+import org.junit.Test;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertNotNull;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assume.assumeTrue;
+
+public class JSEngineTest extends TestBase {
+
+    private static int intOption(Map<String, String> options, String name) {
+        String value = options.get(name);
+        assertNotNull("Expected " + name + " in " + options, value);
+        return Integer.parseInt(value);
+    }
+
+    @Test public void testProfile() {
+        assumeTrue(System.getProperty("com.sun.webkit.jscProfile") == null);
+        assertEquals(JSEngine.Profile.DEFAULT, JSEngine.getProfile());
+    }
+
+    @Test public void testEffectiveOptions() {
+        Map<String, String> options = submit(() -> JSEngine.getEffectiveOptions());
+
+        assertEquals(System.getProperty("com.sun.webkit.useJIT", "true"), options.get("useJIT"));
+        assertTrue(options.toString(), intOption(options, "thresholdForJITAfterWarmUp")
+                <= intOption(options, "thresholdForOptimizeAfterWarmUp"));
+        assertTrue(options.toString(), intOption(options, "thresholdForOptimizeAfterWarmUp")
+                <= intOption(options, "thresholdForFTLOptimizeAfterWarmUp"));
+        assertTrue(options.toString(), intOption(options, "numberOfGCMarkers") >= 1);
+        assertTrue(options.toString(), intOption(options, "numberOfWorklistThreads") >= 1);
+        assertTrue(options.toString(), Double.parseDouble(options.get("largeHeapGrowthFactor")) >= 1);
+    }
+
+    /**
+     * The profile is applied once per process, so it is checked in a new
+     * JVM.
+     */
+    @Test public void testLowMemoryProfile() throws Exception {
+        Map<String, String> options = WebEngineProcess.run(Map.of(),
+                List.of("-Dcom.sun.webkit.jscProfile=lowMemory")).getOptions();
+
+        assertEquals(options.toString(), 1000, intOption(options, "thresholdForJITAfterWarmUp"));
+        assertEquals(options.toString(), 5000, intOption(options, "thresholdForOptimizeAfterWarmUp"));
+        assertEquals(options.toString(), 1, intOption(options, "numberOfWorklistThreads"));
+        assertEquals(options.toString(), 1, intOption(options, "numberOfDFGCompilerThreads"));
+        assertEquals(options.toString(), 1, intOption(options, "numberOfFTLCompilerThreads"));
+        assertTrue(options.toString(), intOption(options, "numberOfGCMarkers") <= 2);
+        assertEquals(options.toString(), 0.125, Double.parseDouble(options.get("smallHeapRAMFraction")), 0);
+        long forceRAMSize = Long.parseLong(options.get("forceRAMSize"));
+        assertTrue(options.toString(), forceRAMSize > 0 && forceRAMSize <= 1024L * 1024 * 1024);
+    }
+
+    /**
+     * The JSC_ environment variables are read before the profile, and an
+     * inverted pair of tier thresholds is corrected.
+     */
+    @Test public void testInvertedThresholdsAreCorrected() throws Exception {
+        Map<String, String> options = WebEngineProcess.run(Map.of(
+                "JSC_thresholdForJITAfterWarmUp", "2000",
+                "JSC_thresholdForOptimizeAfterWarmUp", "100"),
+                List.of("-Dcom.sun.webkit.jscProfile=default")).getOptions();
+
+        assertEquals(options.toString(), 2000, intOption(options, "thresholdForJITAfterWarmUp"));
+        assertEquals(options.toString(), 2000, intOption(options, "thresholdForOptimizeAfterWarmUp"));
+        assertTrue(options.toString(), intOption(options, "thresholdForFTLOptimizeAfterWarmUp") >= 2000);
+    }
+}
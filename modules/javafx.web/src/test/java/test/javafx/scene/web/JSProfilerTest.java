@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.JSProfiler;
+import org.junit.After;
+import org.junit.Test;
+
+import static org.junit.Assert.assertTrue;
+
+public class JSProfilerTest extends TestBase {
+
+    @After public void stopSampling() {
+        submit(() -> JSProfiler.stopSampling());
+    }
+
+    @Test public void testSamplesContainBusyFunction() {
+        loadContent("<script>function spin() {"
+                + " var end = Date.now() + 500, x = 0;"
+                + " while (Date.now() < end) { x += Math.sqrt(x + 1); }"
+                + " return x; }</script>");
+        submit(() -> JSProfiler.startSampling(1000));
+        executeScript("spin()");
+        String samples = submit(() -> JSProfiler.takeSamples());
+
+        assertTrue("Expected samples: " + samples, samples.contains("\"sampleCount\":"));
+        assertTrue("Expected spin() in stacks: " + samples, samples.contains("spin"));
+
+        String drained = submit(() -> JSProfiler.takeSamples());
+        assertTrue("Expected samples to be reset: " + drained, drained.contains("\"sampleCount\":0"));
+    }
+
+    @Test public void testHeapStatistics() {
+        loadContent("<script>var objects = []; for (var i = 0; i < 10000; i++) objects.push({ i: i });</script>");
+        String statistics = submit(() -> JSProfiler.getHeapStatistics(false));
+        assertTrue(statistics, statistics.contains("\"size\":"));
+        assertTrue(statistics, statistics.contains("\"collections\":"));
+        assertTrue(statistics, !statistics.contains("\"objectTypeCounts\":"));
+
+        statistics = submit(() -> JSProfiler.getHeapStatistics(true));
+        assertTrue(statistics, statistics.contains("\"objectTypeCounts\":"));
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testInvalidInterval() {
+        submit(() -> JSProfiler.startSampling(0));
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.JavaCallProfiler;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+import org.junit.After;
+import org.junit.Test;
+
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+
+public class JavaCallProfilerTest extends TestBase {
+
+    @After public void disable() {
+        submit(() -> {
+            JavaCallProfiler.setEnabled(false);
+            JavaCallProfiler.reset();
+        });
+    }
+
+    @Test public void testCallSitesAreCounted() {
+        loadContent("<p>warm up</p>");
+        submit(() -> {
+            JavaCallProfiler.reset();
+            JavaCallProfiler.setEnabled(true);
+        });
+        loadContent("<p style='font: 20px serif'>Hello <b>world</b></p>");
+        String statistics = submit(() -> JavaCallProfiler.getStatistics());
+
+        assertTrue(statistics, statistics.contains("\"enabled\":true"));
+        assertTrue(statistics, statistics.contains(".cpp:"));
+        assertFalse(statistics, statistics.contains("\"callCount\":0,"));
+
+        submit(() -> {
+            JavaCallProfiler.setEnabled(false);
+            JavaCallProfiler.reset();
+        });
+        statistics = submit(() -> JavaCallProfiler.getStatistics());
+        assertTrue(statistics, statistics.contains("\"sites\":[]"));
+    }
+
+    // The time a thread spent while profiling was off must not be charged
+    // to its first call site once profiling is enabled again.
+    @Test public void testReenableDropsStaleMarks() throws InterruptedException {
+        submit(() -> JavaCallProfiler.setEnabled(true));
+        loadContent("<p style='font: 20px serif'>Hello</p>");
+        submit(() -> JavaCallProfiler.setEnabled(false));
+        Thread.sleep(2000);
+        submit(() -> JavaCallProfiler.setEnabled(true));
+        loadContent("<p style='font: 20px serif'>Hello <b>again</b></p>");
+        String statistics = submit(() -> JavaCallProfiler.getStatistics());
+
+        Matcher matcher = Pattern.compile("\"maxMillis\":([0-9.eE+-]+)").matcher(statistics);
+        while (matcher.find()) {
+            if (Double.parseDouble(matcher.group(1)) >= 2000) {
+                fail("Stale mark charged to a call site: " + statistics);
+            }
+        }
+    }
+}
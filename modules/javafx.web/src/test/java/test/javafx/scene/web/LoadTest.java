@@ -35,6 +35,9 @@ import static org.junit.Assert.assertNull;
 import static org.junit.Assert.assertTrue;
 import static org.junit.Assume.assumeTrue;
 import java.io.File;
+import java.net.FileNameMap;
+import java.net.URLConnection;
+import java.nio.file.Files;
 import java.util.concurrent.Callable;
 import java.util.concurrent.CountDownLatch;
 import javafx.concurrent.Worker.State;
@@ -424,6 +427,27 @@ public class LoadTest extends TestBase {
         }
     }
 
+    @Test public void testLocalFileTypeFromFileNameMap() throws Exception {
+        File file = File.createTempFile("type", ".html");
+        file.deleteOnExit();
+        Files.writeString(file.toPath(), "<p>text</p>");
+
+        // The type the application maps the extension to takes precedence
+        // over the native extension table.
+        FileNameMap defaultMap = URLConnection.getFileNameMap();
+        URLConnection.setFileNameMap(name -> name.endsWith(".html")
+                ? "text/plain" : defaultMap.getContentTypeFor(name));
+        try {
+            load(file);
+        } finally {
+            URLConnection.setFileNameMap(defaultMap);
+        }
+        assertEquals("text/plain", executeScript("document.contentType"));
+
+        load(file);
+        assertEquals("text/html", executeScript("document.contentType"));
+    }
+
     // JDK-8282134 Certain regex can cause a JS trap in WebView
     @Test public void jsRegexpTrapTest() {
         final String FILE = "src/test/resources/test/html/unicode.html";
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.WebPage;
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Comparator;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import java.util.function.Predicate;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+import java.util.stream.Stream;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+import test.javafx.scene.web.TestHttpServer.Response;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+
+/**
+ * Checks the LocalStorage statistics, the adaptive sync interval and the
+ * import of a database that is read in several batches. Every test uses a
+ * server of its own, so that its origin has statistics of its own.
+ */
+public class LocalStorageStatisticsTest extends TestBase {
+
+    // More than the 100 changes per interval that make syncs back off
+    private static final int MANY_ITEMS = 150;
+    // More than two import batches of 256 rows
+    private static final int IMPORTED_ITEMS = 600;
+    private static final int LOAD_SECONDS = 30;
+
+    private Path directory;
+    private TestHttpServer server;
+    private String url;
+
+    @Before public void setUp() throws IOException {
+        directory = Files.createTempDirectory("localstorage");
+        server = new TestHttpServer(request -> Response.ok("text/html", "<html><body></body></html>"));
+        url = server.url("/");
+    }
+
+    @After public void tearDown() throws IOException {
+        server.close();
+        try (Stream<Path> paths = Files.walk(directory)) {
+            paths.sorted(Comparator.reverseOrder()).forEach(path -> path.toFile().delete());
+        }
+    }
+
+    private void load(WebEngine engine, File userDataDirectory) {
+        CountDownLatch loaded = new CountDownLatch(1);
+        submit(() -> {
+            engine.setUserDataDirectory(userDataDirectory);
+            engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+                if (n == Worker.State.SUCCEEDED) {
+                    loaded.countDown();
+                }
+            });
+            engine.load(url);
+        });
+        try {
+            assertTrue("Page not loaded", loaded.await(LOAD_SECONDS, TimeUnit.SECONDS));
+        } catch (InterruptedException ex) {
+            throw new AssertionError(ex);
+        }
+    }
+
+    private static long value(String statistics, String key) {
+        Matcher matcher = Pattern.compile("\"" + key + "\":([0-9.]+)").matcher(statistics);
+        assertTrue(statistics, matcher.find());
+        return (long) Double.parseDouble(matcher.group(1));
+    }
+
+    /**
+     * Waits for the statistics of the origin to satisfy the condition, and
+     * returns them.
+     */
+    private String waitForStatistics(Predicate<String> condition) {
+        long deadline = System.currentTimeMillis() + 30000;
+        String statistics;
+        while ((statistics = submit(() -> WebPage.getLocalStorageStatistics(url))) == null
+                || !condition.test(statistics)) {
+            if (System.currentTimeMillis() > deadline) {
+                fail("Timed out, statistics: " + statistics);
+            }
+            try {
+                Thread.sleep(20);
+            } catch (InterruptedException ex) {
+                throw new AssertionError(ex);
+            }
+        }
+        return statistics;
+    }
+
+    private void setItems(WebEngine engine, int from, int to) {
+        submit(() -> engine.executeScript(
+                "for (var i = " + from + "; i < " + to + "; i++) localStorage.setItem('k' + i, 'v' + i);"));
+    }
+
+    @Test public void testSyncIntervalBacksOffAndRelaxes() {
+        load(getEngine(), directory.resolve("data").toFile());
+
+        // The first sync sees all changes at once and doubles the interval.
+        setItems(getEngine(), 0, MANY_ITEMS);
+        String statistics = waitForStatistics(s -> value(s, "syncCount") >= 1);
+        assertEquals(statistics, 2000, value(statistics, "syncIntervalMillis"));
+
+        // The following syncs see no new changes, so the interval relaxes.
+        statistics = waitForStatistics(s -> value(s, "syncedItemCount") >= MANY_ITEMS
+                && value(s, "syncIntervalMillis") == 1000);
+        assertTrue(statistics, value(statistics, "syncCount") >= 2);
+        assertTrue(statistics, value(statistics, "maxSyncMillis") >= value(statistics, "lastSyncMillis"));
+    }
+
+    @Test public void testDatabaseIsImportedInBatches() throws IOException {
+        File first = directory.resolve("first").toFile();
+        load(getEngine(), first);
+        setItems(getEngine(), 0, IMPORTED_ITEMS);
+        waitForStatistics(s -> value(s, "syncedItemCount") >= IMPORTED_ITEMS);
+
+        // A copy of the database is a namespace of its own, which imports it.
+        Path source = first.toPath().resolve("localstorage");
+        Path target = directory.resolve("second").resolve("localstorage");
+        Files.createDirectories(target);
+        try (Stream<Path> files = Files.list(source)) {
+            for (Path file : (Iterable<Path>) files::iterator) {
+                Files.copy(file, target.resolve(file.getFileName()));
+            }
+        }
+
+        WebEngine second = submit(() -> new WebEngine());
+        load(second, target.getParent().toFile());
+        // Single items are answered while the import may still be running.
+        assertEquals("v" + (IMPORTED_ITEMS - 1) + ",null", submit(() -> second.executeScript(
+                "localStorage.getItem('k" + (IMPORTED_ITEMS - 1) + "') + ',' + localStorage.getItem('missing')")));
+        assertEquals(IMPORTED_ITEMS, ((Number) submit(() -> second.executeScript("localStorage.length"))).intValue());
+
+        waitForStatistics(s -> value(s, "importedItemCount") == IMPORTED_ITEMS);
+    }
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.MemoryCache;
+import com.sun.webkit.MemoryCache.CacheModel;
+import com.sun.webkit.PageCache;
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertNull;
+import static org.junit.Assert.assertTrue;
+
+public class MemoryCacheTest extends TestBase {
+
+    private static final long MB = 1024 * 1024;
+
+    private long[] capacities;
+    private int pageCacheCapacity;
+
+    @Before public void saveCapacities() {
+        capacities = submit(() -> new long[] {
+            MemoryCache.getMinDeadCapacity(),
+            MemoryCache.getMaxDeadCapacity(),
+            MemoryCache.getCapacity()
+        });
+        pageCacheCapacity = submit(() -> PageCache.getCapacity());
+    }
+
+    @After public void restoreCapacities() {
+        submit(() -> {
+            MemoryCache.setCapacities(capacities[0], capacities[1], capacities[2]);
+            PageCache.setCapacity(pageCacheCapacity);
+        });
+    }
+
+    @Test public void testSetCapacities() {
+        submit(() -> {
+            MemoryCache.setCapacities(1 * MB, 2 * MB, 4 * MB);
+            assertEquals(1 * MB, MemoryCache.getMinDeadCapacity());
+            assertEquals(2 * MB, MemoryCache.getMaxDeadCapacity());
+            assertEquals(4 * MB, MemoryCache.getCapacity());
+            assertNull(MemoryCache.getCacheModel());
+        });
+    }
+
+    @Test public void testCacheModels() {
+        submit(() -> {
+            MemoryCache.setCacheModel(CacheModel.DOCUMENT_VIEWER);
+            assertEquals(CacheModel.DOCUMENT_VIEWER, MemoryCache.getCacheModel());
+            assertEquals(0, MemoryCache.getMaxDeadCapacity());
+            assertEquals(0, PageCache.getCapacity());
+            long viewerCapacity = MemoryCache.getCapacity();
+
+            MemoryCache.setCacheModel(CacheModel.PRIMARY_WEB_BROWSER);
+            assertTrue(MemoryCache.getCapacity() >= viewerCapacity);
+            assertTrue(MemoryCache.getMaxDeadCapacity() > 0);
+            assertTrue(MemoryCache.getMinDeadCapacity() <= MemoryCache.getMaxDeadCapacity());
+            assertTrue(PageCache.getCapacity() > 0);
+        });
+    }
+
+    @Test public void testPruneDeadResources() {
+        loadContent("<img src='data:image/svg+xml,%3Csvg xmlns=\"http://www.w3.org/2000/svg\""
+                + " width=\"10\" height=\"10\"/%3E'>");
+        loadContent("<p>empty</p>");
+        submit(() -> {
+            MemoryCache.pruneDeadResources();
+            assertEquals(0, MemoryCache.getDeadSize());
+            assertTrue(MemoryCache.getLiveSize() >= 0);
+        });
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testDeadCapacityAboveTotal() {
+        submit(() -> MemoryCache.setCapacities(0, 8 * MB, 4 * MB));
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testCapacityTooLarge() {
+        submit(() -> MemoryCache.setCapacities(0, 0, 1L << 32));
+    }
+
+    @Test(expected = IllegalStateException.class)
+    public void testSetCapacitiesOffEventThread() {
+        MemoryCache.setCapacities(0, 0, 4 * MB);
+    }
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.MemoryCache;
+import com.sun.webkit.MemoryPressure;
+import com.sun.webkit.PageCache;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assume.assumeTrue;
+
+public class MemoryPressureTest extends TestBase {
+
+    private static final long MB = 1024 * 1024;
+
+    private int pageCacheCapacity;
+
+    @Before public void disablePageCache() {
+        // Pages kept for going back would keep their resources alive.
+        pageCacheCapacity = submit(() -> PageCache.getCapacity());
+        submit(() -> PageCache.setCapacity(0));
+    }
+
+    @After public void restorePageCache() {
+        submit(() -> PageCache.setCapacity(pageCacheCapacity));
+    }
+
+    /**
+     * Leaves the image of the previous page in the memory cache, where no
+     * page refers to it any more.
+     */
+    private void leaveDeadResource() {
+        loadContent("<img src='data:image/svg+xml,%3Csvg xmlns=\"http://www.w3.org/2000/svg\""
+                + " width=\"10\" height=\"10\"/%3E'>");
+        loadContent("<p>other</p>");
+        assertTrue("No dead resources", submit(() -> MemoryCache.getDeadSize()) > 0);
+    }
+
+    @Test public void testCriticalReleaseCollectsJavaScriptHeap() {
+        leaveDeadResource();
+        loadContent("<script>var buffers = [];"
+                + " for (var i = 0; i < 8; i++) buffers.push(new Uint8Array(16 * 1024 * 1024).fill(1));"
+                + "</script>");
+        long before = submit(() -> MemoryPressure.getJavaScriptHeapSize());
+        assertTrue("Expected the buffers in the heap: " + before / MB + "MB",
+                before >= 128 * MB);
+        executeScript("buffers = null");
+        submit(() -> MemoryPressure.releaseMemory(true));
+        long after = submit(() -> MemoryPressure.getJavaScriptHeapSize());
+
+        // The buffers are gone after the synchronous full collection.
+        assertTrue("Expected the JavaScript heap to shrink by the buffers: "
+                + before / MB + "MB -> " + after / MB + "MB",
+                before - after >= 128 * MB);
+        assertEquals(0, (long) submit(() -> MemoryCache.getDeadSize()));
+    }
+
+    /**
+     * Returns the resident set size of this process as the kernel reports
+     * it, independently of {@link MemoryPressure#getResidentMemory}.
+     */
+    private static long vmRSS() throws IOException {
+        for (String line : Files.readAllLines(Path.of("/proc/self/status"))) {
+            if (line.startsWith("VmRSS:")) {
+                // "VmRSS:    123456 kB"
+                return Long.parseLong(line.replaceAll("[^0-9]", "")) * 1024;
+            }
+        }
+        throw new AssertionError("No VmRSS in /proc/self/status");
+    }
+
+    @Test public void testCriticalReleaseReturnsMemoryToSystem() throws IOException {
+        assumeTrue(Files.isReadable(Path.of("/proc/self/status")));
+        // Filling the buffers makes their pages resident.
+        loadContent("<script>var buffers = [];"
+                + " for (var i = 0; i < 8; i++) buffers.push(new Uint8Array(16 * 1024 * 1024).fill(1));"
+                + "</script>");
+        long before = vmRSS();
+        executeScript("buffers = null");
+        submit(() -> MemoryPressure.releaseMemory(true));
+        long after = vmRSS();
+
+        // The allocator may keep some of the 128MB for reuse, and the Java
+        // heap may grow meanwhile, so only half of it has to be returned.
+        assertTrue("Expected the resident set to shrink: "
+                + before / MB + "MB -> " + after / MB + "MB",
+                before - after >= 64 * MB);
+    }
+
+    @Test public void testNonCriticalReleaseDropsDeadResources() {
+        leaveDeadResource();
+        submit(() -> MemoryPressure.releaseMemory(false));
+        assertEquals(0, (long) submit(() -> MemoryCache.getDeadSize()));
+    }
+
+    @Test public void testResidentMemory() {
+        assertTrue(submit(() -> MemoryPressure.getResidentMemory()) > 0);
+    }
+
+    @Test(expected = IllegalStateException.class)
+    public void testReleaseOffEventThread() {
+        MemoryPressure.releaseMemory(true);
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import javafx.scene.Scene;
+import javafx.scene.image.PixelReader;
+import javafx.stage.Stage;
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+
+import static org.junit.Assert.fail;
+
+/**
+ * Checks that the paint context a page reuses for its updates starts every
+ * paint from the initial state, so that one update cannot leak its stroke
+ * style into the next.
+ */
+public class PaintContextTest extends TestBase {
+
+    private static final int WHITE = 0xFFFFFFFF;
+    private static final int BLACK = 0xFF000000;
+
+    private Stage stage;
+
+    @Before public void setUp() {
+        submit(() -> {
+            stage = new Stage();
+            stage.setScene(new Scene(getView(), 200, 100));
+            stage.show();
+        });
+        loadContent("<body style='margin:0;background:white'>"
+                + "<svg width='200' height='100' style='display:block'>"
+                + "<line x1='0' y1='20' x2='200' y2='20' stroke='black' stroke-width='4'"
+                + " stroke-dasharray='10,10' stroke-linecap='round' stroke-linejoin='round'/>"
+                + "<line id='solid' x1='0' y1='60' x2='200' y2='60' stroke='black' stroke-width='4'"
+                + " visibility='hidden'/>"
+                + "</svg></body>");
+    }
+
+    @After public void tearDown() {
+        submit(() -> stage.close());
+    }
+
+    @Test public void testStrokeStyleDoesNotLeakIntoNextPaint() {
+        // A dash and the gap after it
+        waitForPixel(5, 20, BLACK);
+        waitForPixel(15, 20, WHITE);
+
+        // Painted by a later update through the same context
+        executeScript("document.getElementById('solid').setAttribute('visibility', 'visible')");
+        waitForPixel(5, 60, BLACK);
+
+        PixelReader pixels = submit(() -> getView().snapshot(null, null).getPixelReader());
+        for (int x = 2; x < 198; x++) {
+            int actual = pixels.getArgb(x, 60);
+            if (actual != BLACK) {
+                fail(String.format("Expected a solid line but was %08X at %d,60", actual, x));
+            }
+        }
+    }
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import org.junit.Before;
+import org.junit.Test;
+
+import static org.junit.Assert.assertEquals;
+
+/**
+ * Checks selector matching, which is compiled to machine code where the
+ * selector JIT is available and interpreted elsewhere, against the
+ * expected matches in a fixed document.
+ */
+public class SelectorTest extends TestBase {
+
+    private static final String DOCUMENT = """
+        <!DOCTYPE html><html><head><style id="s"></style></head><body>
+        <div id="main" class="grid dense" lang="en-US">
+          <table>
+            <thead><tr><th data-col="id">Id</th><th data-col="name sortable">Name</th><th data-col="price-eur">Price</th></tr></thead>
+            <tbody>
+              <tr class="row odd" data-id="1"><td>1</td><td class="name">Alpha</td><td class="price">10</td></tr>
+              <tr class="row even" data-id="2"><td>2</td><td class="name">Beta</td><td class="price">20</td></tr>
+              <tr class="row odd selected" data-id="3"><td>3</td><td class="name">Gamma</td><td class="price">30</td></tr>
+              <tr class="row even" data-id="4"><td>4</td><td class="name">Delta</td><td class="price">40</td></tr>
+              <tr class="row odd" data-id="5"><td>5</td><td class="name">Epsilon</td><td class="price negative">-50</td></tr>
+              <tr class="row even" data-id="6" data-state="Open"><td>6</td><td class="name">Zeta</td><td class="price">60</td></tr>
+            </tbody>
+          </table>
+          <ul>
+            <li class="a">one</li>
+            <li></li>
+            <li class="a b"><span>three</span></li>
+            <li lang="fr">quatre</li>
+          </ul>
+          <form>
+            <input type="text" name="q" value="query">
+            <input type="checkbox" checked>
+            <input type="checkbox" disabled>
+            <select><option selected>1</option><option>2</option></select>
+            <a href="#top">link</a>
+            <a>anchor</a>
+          </form>
+          <p></p>
+          <p>text</p>
+          <p><!-- comment --></p>
+          <section><div><p class="deep">deep</p></div></section>
+        </div>
+        </body></html>
+        """;
+
+    private static final Object[][] SELECTORS = {
+        { "*", 57 },
+        { "div", 2 },
+        { "#main", 1 },
+        { ".row", 6 },
+        { ".row.odd", 3 },
+        { "tr.row.even", 3 },
+        { "tbody > tr", 6 },
+        { "#main td", 18 },
+        { "table tr > td.name", 6 },
+        { "thead th + th", 2 },
+        { "thead th ~ th", 2 },
+        { "li + li", 3 },
+        { "li ~ li", 3 },
+        { "[data-id]", 6 },
+        { "[data-id=\"3\"]", 1 },
+        { "[data-col~=\"sortable\"]", 1 },
+        { "[data-col|=\"price\"]", 1 },
+        { "[data-col^=\"na\"]", 1 },
+        { "[data-col$=\"eur\"]", 1 },
+        { "[data-col*=\"ice\"]", 1 },
+        { "[data-state=\"open\" i]", 1 },
+        { "[data-state=\"open\"]", 0 },
+        { "td:first-child", 6 },
+        { "td:last-child", 6 },
+        { "li:only-child", 0 },
+        { "span:only-child", 1 },
+        { "tr:nth-child(2n+1)", 4 },
+        { "tr:nth-child(odd)", 4 },
+        { "tr:nth-child(even)", 3 },
+        { "tr:nth-child(-n+3)", 4 },
+        { "tr:nth-last-child(2)", 1 },
+        { "td:nth-of-type(2)", 6 },
+        { "p:first-of-type", 2 },
+        { "p:last-of-type", 2 },
+        { "p:empty", 2 },
+        { "li:empty", 1 },
+        { ":root", 1 },
+        { "input:checked", 1 },
+        { "option:checked", 1 },
+        { "input:disabled", 1 },
+        { "input:enabled", 2 },
+        { "a:link", 1 },
+        { "a:any-link", 1 },
+        { "li:lang(fr)", 1 },
+        { "td:lang(en)", 18 },
+        { "tr:not(.odd)", 4 },
+        { "td:not(:first-child):not(:last-child)", 6 },
+        { ":is(li, td).a", 2 },
+        { ":is(.name, .price)", 12 },
+        { ":where(ul, form) > *", 10 },
+        { "tr:not(.selected) .price", 5 },
+        { "section p", 1 },
+        { "section > p", 0 },
+        { "#main > *", 7 },
+        { "ul > li:nth-child(3) > span", 1 },
+        { ".grid.dense tbody tr:nth-child(2n) td:nth-child(3)", 3 },
+        { "div div p", 1 },
+        { "[class]", 22 },
+        { "[class~=\"b\"]", 1 },
+        { "form :is(input, select)[disabled]", 1 },
+        { "tr:has(.negative)", 1 }
+    };
+
+    @Before public void setUp() {
+        loadContent(DOCUMENT);
+    }
+
+    private int querySelectorCount(String selector) {
+        return ((Number) executeScript(
+                "document.querySelectorAll('" + selector + "').length")).intValue();
+    }
+
+    private int styleMatchCount(String selector) {
+        return ((Number) executeScript(
+                "document.getElementById('s').textContent = '" + selector + " { order: 7 }';"
+                + "Array.prototype.filter.call(document.querySelectorAll('*'), function(e) {"
+                + "    return getComputedStyle(e).order == '7';"
+                + "}).length")).intValue();
+    }
+
+    @Test public void testQuerySelector() {
+        for (Object[] entry : SELECTORS) {
+            assertEquals((String) entry[0], entry[1], querySelectorCount((String) entry[0]));
+        }
+    }
+
+    @Test public void testStyleMatching() {
+        for (Object[] entry : SELECTORS) {
+            assertEquals((String) entry[0], entry[1], styleMatchCount((String) entry[0]));
+        }
+    }
+
+    /**
+     * Compiled selectors are kept with the rule or the query, make sure
+     * they still match once the document changes.
+     */
+    @Test public void testMatchingAfterMutation() {
+        assertEquals(1, querySelectorCount("tr.row.odd:first-child"));
+        assertEquals(1, styleMatchCount("tr.row.odd:first-child"));
+        assertEquals(3, querySelectorCount("tr:nth-child(even)"));
+        assertEquals(3, styleMatchCount("tr:nth-child(even)"));
+
+        executeScript("document.querySelector('tbody > tr').remove()");
+        assertEquals(0, querySelectorCount("tr.row.odd:first-child"));
+        assertEquals(0, styleMatchCount("tr.row.odd:first-child"));
+        assertEquals(2, querySelectorCount("tr:nth-child(even)"));
+        assertEquals(2, styleMatchCount("tr:nth-child(even)"));
+
+        executeScript("document.querySelector('.selected').classList.remove('selected')");
+        assertEquals(0, querySelectorCount(".selected"));
+        assertEquals(5, querySelectorCount("tr:not(.selected) .price"));
+        assertEquals(5, styleMatchCount("tr:not(.selected) .price"));
+    }
+}
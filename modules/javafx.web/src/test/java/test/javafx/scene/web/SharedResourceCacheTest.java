@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.SharedResourceCache;
+import java.io.IOException;
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+import test.javafx.scene.web.TestHttpServer.Response;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+
+public class SharedResourceCacheTest extends TestBase {
+
+    private static final String PAGE = "<html><head>"
+            + "<link rel='stylesheet' href='style.css'>"
+            + "<script src='app.js'></script>"
+            + "</head><body><p id='p'>shared</p></body></html>";
+    private static final String STYLE = "#p { color: rgb(1, 2, 3); }";
+    private static final String SCRIPT = "var loaded = (window.loaded || 0) + 1;";
+
+    private TestHttpServer server;
+
+    @Before public void setUp() throws IOException {
+        submit(() -> {
+            SharedResourceCache.setCapacity(SharedResourceCache.DEFAULT_CAPACITY);
+            SharedResourceCache.clear();
+        });
+
+        // Every response is one the memory cache may not reuse, so that
+        // every load parses again
+        server = new TestHttpServer(request -> {
+            String path = request.getPath();
+            Response response = path.endsWith(".css") ? Response.ok("text/css", STYLE)
+                    : path.endsWith(".js") ? Response.ok("text/javascript", SCRIPT)
+                    : Response.ok("text/html", PAGE);
+            return response.header("Cache-Control", "no-store");
+        });
+    }
+
+    @After public void tearDown() throws IOException {
+        submit(() -> SharedResourceCache.setCapacity(SharedResourceCache.DEFAULT_CAPACITY));
+        server.close();
+    }
+
+    private void loadPage() {
+        loadContent("<p>other</p>");
+        load(server.url("/index.html"));
+        assertEquals("rgb(1, 2, 3)", executeScript(
+                "getComputedStyle(document.getElementById('p')).color"));
+        assertEquals(1, ((Number) executeScript("loaded")).intValue());
+    }
+
+    @Test public void testReloadedResourcesAreShared() {
+        loadPage();
+        assertTrue(submit(() -> SharedResourceCache.getStyleSheetSize()) > 0);
+        assertEquals(SCRIPT.length(), (long) submit(() -> SharedResourceCache.getScriptSize()));
+
+        long hits = submit(() -> SharedResourceCache.getHitCount());
+        loadPage();
+        assertEquals(hits + 2, (long) submit(() -> SharedResourceCache.getHitCount()));
+    }
+
+    @Test public void testChangesAreNotShared() {
+        loadPage();
+        executeScript("document.styleSheets[0].insertRule('#p { color: rgb(4, 5, 6); }', 1)");
+        assertEquals("rgb(4, 5, 6)", executeScript(
+                "getComputedStyle(document.getElementById('p')).color"));
+        loadPage();
+    }
+
+    @Test public void testDisabledCacheKeepsNothing() {
+        submit(() -> SharedResourceCache.setCapacity(0));
+        loadPage();
+        long hits = submit(() -> SharedResourceCache.getHitCount());
+        loadPage();
+        assertEquals(hits, (long) submit(() -> SharedResourceCache.getHitCount()));
+        assertEquals(0, (long) submit(() -> SharedResourceCache.getStyleSheetSize()));
+        assertEquals(0, (long) submit(() -> SharedResourceCache.getScriptSize()));
+    }
+
+    @Test(expected = IllegalStateException.class)
+    public void testSetCapacityOffEventThread() {
+        SharedResourceCache.setCapacity(0);
+    }
+}
@@ -217,6 +217,28 @@ public class TestBase implements ChangeListener, InvalidationListener {
         return submit(() -> getEngine().executeScript(script));
     }
 
+    /**
+     * Waits for the pixel of the WebView to have the given color. The view
+     * is updated on pulses, so the first snapshots may show older frames.
+     * The view must be shown in a scene.
+     */
+    protected void waitForPixel(int x, int y, int expected) {
+        long deadline = System.currentTimeMillis() + 5000;
+        int actual;
+        while ((actual = submit(() -> getView().snapshot(null, null)
+                .getPixelReader().getArgb(x, y))) != expected) {
+            if (System.currentTimeMillis() > deadline) {
+                throw new AssertionError(String.format(
+                        "Expected %08X at %d,%d but was %08X", expected, x, y, actual));
+            }
+            try {
+                Thread.sleep(20);
+            } catch (InterruptedException ex) {
+                throw new AssertionError(ex);
+            }
+        }
+    }
+
     private class LoadFinishedListener implements ChangeListener<Boolean> {
         @Override
         public void changed(ObservableValue<? extends Boolean> observable,
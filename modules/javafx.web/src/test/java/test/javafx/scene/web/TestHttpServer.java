@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import java.io.BufferedInputStream;
+import java.io.BufferedOutputStream;
+import java.io.DataInputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.net.InetAddress;
+import java.net.ServerSocket;
+import java.net.Socket;
+import java.nio.charset.StandardCharsets;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
+import java.util.Base64;
+import java.util.LinkedHashMap;
+import java.util.Map;
+import java.util.TreeMap;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+
+/**
+ * A minimal HTTP/1.1 server on the loopback interface for tests and
+ * benchmarks that load pages over the network.
+ * <p>
+ * Every connection is served on a thread of its own and answers a single
+ * request, which the handler maps to a response. A response can also
+ * switch the connection to the WebSocket protocol, after which the
+ * connection's frames are passed to a {@link WebSocketHandler}. Malformed
+ * or empty requests, failing handlers and clients that go away only end
+ * their own connection, never the server.
+ */
+public final class TestHttpServer implements AutoCloseable {
+
+    /**
+     * Maps a request to a response.
+     */
+    @FunctionalInterface
+    public interface Handler {
+        Response handle(Request request) throws Exception;
+    }
+
+    /**
+     * Receives the data frames of a WebSocket connection.
+     */
+    @FunctionalInterface
+    public interface WebSocketHandler {
+        /**
+         * Called for every text, binary or continuation frame from the
+         * client, with the payload unmasked.
+         */
+        void frame(WebSocket socket, boolean fin, int opcode, byte[] payload) throws IOException;
+    }
+
+    /**
+     * Echoes every data frame back as it came, so that fragmented
+     * messages come back fragmented in the same way.
+     */
+    public static final WebSocketHandler ECHO = (socket, fin, opcode, payload) ->
+            socket.send(fin, opcode, payload);
+
+    public static final int CONTINUATION = 0x0;
+    public static final int TEXT = 0x1;
+    public static final int BINARY = 0x2;
+    public static final int CLOSE = 0x8;
+    public static final int PING = 0x9;
+    public static final int PONG = 0xA;
+
+    private static final String ACCEPT_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+    /**
+     * A request line and its headers.
+     */
+    public static final class Request {
+        private final String method;
+        private final String path;
+        private final Map<String, String> headers;
+
+        private Request(String method, String path, Map<String, String> headers) {
+            this.method = method;
+            this.path = path;
+            this.headers = headers;
+        }
+
+        public String getMethod() {
+            return method;
+        }
+
+        /**
+         * Returns the request target, including the query.
+         */
+        public String getPath() {
+            return path;
+        }
+
+        /**
+         * Returns the value of a header, ignoring the case of its name, or
+         * {@code null} if the request has none.
+         */
+        public String getHeader(String name) {
+            return headers.get(name);
+        }
+    }
+
+    /**
+     * A response, sent with {@code Connection: close}.
+     */
+    public static final class Response {
+        private final int status;
+        private final String reason;
+        private final Map<String, String> headers = new LinkedHashMap<>();
+        private final byte[] body;
+        private final WebSocketHandler webSocketHandler;
+
+        private Response(int status, String reason, byte[] body, WebSocketHandler webSocketHandler) {
+            this.status = status;
+            this.reason = reason;
+            this.body = body;
+            this.webSocketHandler = webSocketHandler;
+        }
+
+        public static Response ok(String contentType, byte[] body) {
+            return new Response(200, "OK", body, null).header("Content-Type", contentType);
+        }
+
+        public static Response ok(String contentType, String body) {
+            return ok(contentType, body.getBytes(StandardCharsets.UTF_8));
+        }
+
+        public static Response status(int status, String reason) {
+            return new Response(status, reason, new byte[0], null);
+        }
+
+        /**
+         * Completes the WebSocket opening handshake and hands the
+         * connection to the given handler.
+         */
+        public static Response webSocket(WebSocketHandler handler) {
+            return new Response(101, "Switching Protocols", new byte[0], handler);
+        }
+
+        public Response header(String name, String value) {
+            headers.put(name, value);
+            return this;
+        }
+    }
+
+    /**
+     * The server side of a WebSocket connection.
+     */
+    public static final class WebSocket {
+        private final OutputStream out;
+
+        private WebSocket(OutputStream out) {
+            this.out = out;
+        }
+
+        /**
+         * Sends an unmasked frame. Frames are flushed once the client has
+         * nothing more to read, or when the connection closes.
+         */
+        public void send(boolean fin, int opcode, byte[] payload) throws IOException {
+            int b0 = (fin ? 0x80 : 0) | opcode;
+            byte[] header;
+            if (payload.length < 126) {
+                header = new byte[] { (byte) b0, (byte) payload.length };
+            } else if (payload.length < 65536) {
+                header = new byte[] { (byte) b0, 126, (byte) (payload.length >> 8), (byte) payload.length };
+            } else {
+                header = new byte[10];
+                header[0] = (byte) b0;
+                header[1] = 127;
+                for (int i = 0; i < 8; i++) {
+                    header[9 - i] = (byte) ((long) payload.length >> (8 * i));
+                }
+            }
+            out.write(header);
+            out.write(payload);
+        }
+    }
+
+    private final Handler handler;
+    private final ServerSocket serverSocket;
+    private final ExecutorService executor;
+
+    /**
+     * Starts a server on an ephemeral port of the loopback interface.
+     */
+    public TestHttpServer(Handler handler) throws IOException {
+        this.handler = handler;
+        serverSocket = new ServerSocket(0, 200, InetAddress.getLoopbackAddress());
+        executor = Executors.newCachedThreadPool(r -> {
+            Thread thread = new Thread(r, "TestHttpServer-connection");
+            thread.setDaemon(true);
+            return thread;
+        });
+        Thread acceptor = new Thread(this::accept, "TestHttpServer");
+        acceptor.setDaemon(true);
+        acceptor.start();
+    }
+
+    public int getPort() {
+        return serverSocket.getLocalPort();
+    }
+
+    /**
+     * Returns the http URL of the given absolute path on this server.
+     */
+    public String url(String path) {
+        return "http://localhost:" + getPort() + path;
+    }
+
+    /**
+     * Returns the ws URL of the given absolute path on this server.
+     */
+    public String webSocketURL(String path) {
+        return "ws://localhost:" + getPort() + path;
+    }
+
+    @Override
+    public void close() throws IOException {
+        serverSocket.close();
+        executor.shutdownNow();
+    }
+
+    private void accept() {
+        while (!serverSocket.isClosed()) {
+            try {
+                Socket socket = serverSocket.accept();
+                socket.setTcpNoDelay(true);
+                executor.execute(() -> serve(socket));
+            } catch (IOException ex) {
+                // The server has been closed
+            }
+        }
+    }
+
+    private void serve(Socket socket) {
+        try (socket) {
+            DataInputStream in = new DataInputStream(
+                    new BufferedInputStream(socket.getInputStream()));
+            OutputStream out = new BufferedOutputStream(socket.getOutputStream());
+
+            String[] requestLine = readLine(in).split(" ");
+            if (requestLine.length < 2) {
+                return;
+            }
+            Map<String, String> headers = new TreeMap<>(String.CASE_INSENSITIVE_ORDER);
+            for (String line = readLine(in); !line.isEmpty(); line = readLine(in)) {
+                int colon = line.indexOf(':');
+                if (colon > 0) {
+                    headers.put(line.substring(0, colon).trim(), line.substring(colon + 1).trim());
+                }
+            }
+            Request request = new Request(requestLine[0], requestLine[1], headers);
+            Response response = handler.handle(request);
+
+            if (response.webSocketHandler != null) {
+                String key = request.getHeader("Sec-WebSocket-Key");
+                if (key == null) {
+                    write(out, Response.status(400, "Bad Request"));
+                    return;
+                }
+                response.header("Upgrade", "websocket")
+                        .header("Connection", "Upgrade")
+                        .header("Sec-WebSocket-Accept", accept(key));
+                writeHead(out, response);
+                out.flush();
+                webSocket(in, out, response.webSocketHandler);
+                return;
+            }
+            write(out, response);
+        } catch (Exception ex) {
+            // The client went away, sent a malformed request, or the
+            // handler failed; only this connection is affected
+        }
+    }
+
+    private static void write(OutputStream out, Response response) throws IOException {
+        response.header("Content-Length", String.valueOf(response.body.length))
+                .header("Connection", "close");
+        writeHead(out, response);
+        out.write(response.body);
+        out.flush();
+    }
+
+    private static void writeHead(OutputStream out, Response response) throws IOException {
+        StringBuilder head = new StringBuilder("HTTP/1.1 ")
+                .append(response.status).append(' ').append(response.reason).append("\r\n");
+        for (Map.Entry<String, String> header : response.headers.entrySet()) {
+            head.append(header.getKey()).append(": ").append(header.getValue()).append("\r\n");
+        }
+        out.write(head.append("\r\n").toString().getBytes(StandardCharsets.ISO_8859_1));
+    }
+
+    private static String accept(String key) throws NoSuchAlgorithmException {
+        byte[] digest = MessageDigest.getInstance("SHA-1")
+                .digest((key + ACCEPT_GUID).getBytes(StandardCharsets.ISO_8859_1));
+        return Base64.getEncoder().encodeToString(digest);
+    }
+
+    /*
+     * Reads RFC 6455 frames until the client closes. Pings are answered
+     * and a close frame is echoed; data frames go to the handler.
+     */
+    private static void webSocket(DataInputStream in, OutputStream out,
+                                  WebSocketHandler handler) throws IOException {
+        WebSocket socket = new WebSocket(out);
+        byte[] mask = new byte[4];
+        while (true) {
+            int b0 = in.readUnsignedByte();
+            int b1 = in.readUnsignedByte();
+            boolean fin = (b0 & 0x80) != 0;
+            int opcode = b0 & 0x0F;
+            long length = b1 & 0x7F;
+            if (length == 126) {
+                length = in.readUnsignedShort();
+            } else if (length == 127) {
+                length = in.readLong();
+            }
+            if ((b1 & 0x80) != 0) {
+                in.readFully(mask);
+            }
+            byte[] payload = new byte[(int) length];
+            in.readFully(payload);
+            if ((b1 & 0x80) != 0) {
+                for (int i = 0; i < payload.length; i++) {
+                    payload[i] ^= mask[i & 3];
+                }
+            }
+            switch (opcode) {
+                case CLOSE -> {
+                    socket.send(true, CLOSE, payload);
+                    out.flush();
+                    return;
+                }
+                case PING -> socket.send(true, PONG, payload);
+                case PONG -> { }
+                default -> handler.frame(socket, fin, opcode, payload);
+            }
+            if (in.available() == 0) {
+                out.flush();
+            }
+        }
+    }
+
+    private static String readLine(InputStream in) throws IOException {
+        StringBuilder line = new StringBuilder();
+        for (int c = in.read(); c != '\n'; c = in.read()) {
+            if (c < 0) {
+                throw new IOException("Connection closed in the request head");
+            }
+            if (c != '\r') {
+                line.append((char) c);
+            }
+        }
+        return line.toString();
+    }
+}
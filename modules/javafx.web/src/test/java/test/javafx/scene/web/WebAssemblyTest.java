@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.javafx.PlatformUtil;
+import java.util.List;
+import java.util.Map;
+import org.junit.Test;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assume.assumeTrue;
+
+public class WebAssemblyTest extends TestBase {
+
+    /*
+     * (module
+     *   (memory 1)
+     *   (func (export "add") (param i32 i32) (result i32)
+     *     local.get 0 local.get 1 i32.add)
+     *   (func (export "load") (param i32) (result i32)
+     *     local.get 0 i32.load))
+     */
+    private static final String MODULE = "new Uint8Array(["
+            + "0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,"
+            + "0x01, 0x0c, 0x02, 0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f, 0x60, 0x01, 0x7f, 0x01, 0x7f,"
+            + "0x03, 0x03, 0x02, 0x00, 0x01,"
+            + "0x05, 0x03, 0x01, 0x00, 0x01,"
+            + "0x07, 0x0e, 0x02, 0x03, 0x61, 0x64, 0x64, 0x00, 0x00, 0x04, 0x6c, 0x6f, 0x61, 0x64, 0x00, 0x01,"
+            + "0x0a, 0x11, 0x02, 0x07, 0x00, 0x20, 0x00, 0x20, 0x01, 0x6a, 0x0b,"
+            + "0x07, 0x00, 0x20, 0x00, 0x28, 0x02, 0x00, 0x0b])";
+
+    private void loadModule() {
+        // WebAssembly is only built where the optimizing JIT backend is
+        assumeTrue(PlatformUtil.isLinux() && "amd64".equals(System.getProperty("os.arch")));
+        assumeTrue(Boolean.parseBoolean(System.getProperty("com.sun.webkit.useJIT", "true")));
+        loadContent("<script>var wasm = new WebAssembly.Instance("
+                + "new WebAssembly.Module(" + MODULE + ")).exports;</script>");
+    }
+
+    @Test public void testCall() {
+        loadModule();
+        assertEquals(5, executeScript("wasm.add(2, 3)"));
+        assertEquals(-1, executeScript("wasm.add(0x7fffffff, 0x80000000)"));
+    }
+
+    /**
+     * Memories are bounds checked explicitly in the Java port, an access
+     * past the end must trap rather than fault.
+     */
+    @Test public void testOutOfBoundsAccessTraps() {
+        loadModule();
+        assertEquals(0, executeScript("wasm.load(65532)"));
+        assertEquals(true, executeScript(
+                "try { wasm.load(65533); false; } catch (e) { e instanceof WebAssembly.RuntimeError; }"));
+    }
+
+    /**
+     * The JSC options are set once per process, so the interpreter-only
+     * configuration is checked in a new JVM.
+     */
+    @Test public void testUnavailableWithoutJIT() throws Exception {
+        WebEngineProcess process = WebEngineProcess.run(Map.of(),
+                List.of("-Dcom.sun.webkit.useJIT=false"), "typeof WebAssembly");
+        assertEquals("false", process.getOptions().get("useJIT"));
+        assertEquals(List.of("undefined"), process.getResults());
+    }
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.javafx.application.PlatformImpl;
+import com.sun.webkit.JSEngine;
+import java.io.BufferedReader;
+import java.io.IOException;
+import java.io.InputStreamReader;
+import java.lang.management.ManagementFactory;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Paths;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+
+/**
+ * Runs scripts in a WebEngine in a new JVM, for the settings that are
+ * applied once per process, such as the JavaScriptCore options. The JVM
+ * is started with the arguments of this one, so that it sees the same
+ * modules and system properties, and the given ones.
+ */
+public final class WebEngineProcess {
+
+    private static final long TIMEOUT_SECONDS = 60;
+
+    private final Map<String, String> options = new LinkedHashMap<>();
+    private final List<String> results = new ArrayList<>();
+
+    private WebEngineProcess() {
+    }
+
+    /**
+     * Returns the effective JavaScriptCore options of the new JVM.
+     */
+    public Map<String, String> getOptions() {
+        return Collections.unmodifiableMap(options);
+    }
+
+    /**
+     * Returns the value of each script, converted to a string.
+     */
+    public List<String> getResults() {
+        return Collections.unmodifiableList(results);
+    }
+
+    private static String propertyName(String arg) {
+        int separator = arg.indexOf('=');
+        return separator < 0 ? arg : arg.substring(0, separator);
+    }
+
+    /**
+     * Starts a JVM with the given environment variables and JVM arguments,
+     * loads a page in a WebEngine and runs the scripts in it.
+     */
+    public static WebEngineProcess run(Map<String, String> environment,
+            List<String> jvmArgs, String... scripts)
+            throws IOException, InterruptedException
+    {
+        List<String> overridden = new ArrayList<>();
+        overridden.add("-Djava.class.path");
+        for (String arg : jvmArgs) {
+            if (arg.startsWith("-D")) {
+                overridden.add(propertyName(arg));
+            }
+        }
+
+        List<String> cmd = new ArrayList<>();
+        cmd.add(Paths.get(System.getProperty("java.home"), "bin", "java").toString());
+        for (String arg : ManagementFactory.getRuntimeMXBean().getInputArguments()) {
+            // A debugger or coverage agent cannot be shared with this JVM
+            if (arg.startsWith("-agentlib:") || arg.startsWith("-javaagent:")
+                    || overridden.contains(propertyName(arg))) {
+                continue;
+            }
+            cmd.add(arg);
+        }
+        cmd.addAll(jvmArgs);
+        cmd.add("-cp");
+        cmd.add(System.getProperty("java.class.path"));
+        cmd.add(WebEngineProcess.class.getName());
+        Collections.addAll(cmd, scripts);
+
+        ProcessBuilder builder = new ProcessBuilder(cmd);
+        builder.environment().putAll(environment);
+        builder.redirectError(ProcessBuilder.Redirect.INHERIT);
+        Process process = builder.start();
+
+        WebEngineProcess result = new WebEngineProcess();
+        try (BufferedReader reader = new BufferedReader(new InputStreamReader(
+                process.getInputStream(), StandardCharsets.UTF_8))) {
+            String line;
+            while ((line = reader.readLine()) != null) {
+                if (line.startsWith("option ")) {
+                    int separator = line.indexOf('=');
+                    result.options.put(line.substring(7, separator), line.substring(separator + 1));
+                } else if (line.startsWith("result ")) {
+                    result.results.add(line.substring(7));
+                }
+            }
+        }
+        if (!process.waitFor(TIMEOUT_SECONDS, TimeUnit.SECONDS)) {
+            process.destroyForcibly();
+            fail("The WebEngine process did not exit");
+        }
+        assertEquals("Exit code of the WebEngine process", 0, process.exitValue());
+        assertTrue("No options reported", !result.options.isEmpty());
+        assertEquals(scripts.length, result.results.size());
+        return result;
+    }
+
+    /**
+     * Entry point of the new JVM. Prints the effective options as
+     * "option name=value" lines and the value of each script as a
+     * "result value" line.
+     */
+    public static void main(String[] scripts) throws InterruptedException {
+        CountDownLatch done = new CountDownLatch(1);
+        PlatformImpl.startup(() -> {
+            WebEngine engine = new WebEngine();
+            engine.getLoadWorker().stateProperty().addListener((observable, oldValue, state) -> {
+                if (state != Worker.State.SUCCEEDED) {
+                    return;
+                }
+                JSEngine.getEffectiveOptions().forEach((name, value) ->
+                        System.out.println("option " + name + "=" + value));
+                for (String script : scripts) {
+                    System.out.println("result " + engine.executeScript(script));
+                }
+                done.countDown();
+            });
+            engine.loadContent("<p>child</p>");
+        });
+        boolean loaded = done.await(TIMEOUT_SECONDS, TimeUnit.SECONDS);
+        System.out.flush();
+        Platform.exit();
+        System.exit(loaded ? 0 : 1);
+    }
+}
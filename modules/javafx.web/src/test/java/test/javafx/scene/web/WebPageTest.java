@@ -27,11 +27,16 @@ package test.javafx.scene.web;
 
 import com.sun.webkit.WebPage;
 import com.sun.webkit.WebPageShim;
+import com.sun.webkit.graphics.WCRectangle;
 import java.util.concurrent.Callable;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
 import javafx.scene.web.WebEngineShim;
 
 import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
 import static org.junit.Assert.assertNull;
+import static org.junit.Assert.assertTrue;
 import org.junit.Test;
 
 public class WebPageTest extends TestBase {
@@ -90,6 +95,82 @@ public class WebPageTest extends TestBase {
                 "test/html/icutagparse.html").toExternalForm());
     }
 
+    @Test public void testPaintStatisticsReportDamagedArea() {
+        final WebPage page = WebEngineShim.getPage(getEngine());
+        loadContent("<div id='d' style='width:20px;height:20px;background:red'></div>");
+        submit(() -> {
+            page.setBounds(0, 0, 400, 400);
+            page.updateContent(new WCRectangle(0, 0, 400, 400));
+            page.resetPaintStatistics();
+
+            getEngine().executeScript(
+                    "document.getElementById('d').style.background = 'blue'");
+            page.updateContent(new WCRectangle(0, 0, 400, 400));
+
+            String statistics = page.getPaintStatistics();
+            assertTrue(statistics, statistics.contains("\"frameCount\":1"));
+            Matcher area = Pattern.compile("\"area\":(\\d+)").matcher(statistics);
+            assertTrue(statistics, area.find());
+            // Only the changed element is repainted, not the whole page.
+            assertTrue(statistics, Long.parseLong(area.group(1)) < 400 * 400);
+        });
+    }
+
+    @Test public void testInvalidationAfterUpdateAtZeroSize() {
+        final WebPage page = WebEngineShim.getPage(getEngine());
+        loadContent("<div id='d' style='width:20px;height:20px;background:red'></div>");
+        submit(() -> {
+            page.setBounds(0, 0, 100, 100);
+            page.updateContent(new WCRectangle(0, 0, 100, 100));
+
+            // Damage that is still pending when the page shrinks to 0x0
+            getEngine().executeScript(
+                    "document.getElementById('d').style.background = 'blue'");
+            page.updateRendering();
+            page.setBounds(0, 0, 0, 0);
+            page.updateContent(new WCRectangle(0, 0, 0, 0));
+            assertFalse(page.isDirty());
+
+            page.setBounds(0, 0, 100, 100);
+            page.updateContent(new WCRectangle(0, 0, 100, 100));
+            page.resetPaintStatistics();
+
+            getEngine().executeScript(
+                    "document.getElementById('d').style.background = 'green'");
+            page.updateRendering();
+            assertTrue("Invalidation after an update at 0x0 was dropped", page.isDirty());
+            page.updateContent(new WCRectangle(0, 0, 100, 100));
+            String statistics = page.getPaintStatistics();
+            assertTrue(statistics, statistics.contains("\"frameCount\":1"));
+        });
+    }
+
+    @Test public void testSnapshot() {
+        final WebPage page = WebEngineShim.getPage(getEngine());
+        submit(() -> page.setBounds(0, 0, 100, 100));
+        loadContent("<body style='margin:0;background:rgb(10,20,30)'>"
+                + "<div style='width:50px;height:50px;background:rgb(200,0,0)'></div>"
+                + "<div style='height:1000px'></div>"
+                + "<div style='width:50px;height:50px;background:rgb(0,200,0)'></div>"
+                + "</body>");
+
+        int[] pixels = page.snapshot(0, 0, 100, 100);
+        assertEquals(100 * 100, pixels.length);
+        assertEquals(0xFFC80000, pixels[10 * 100 + 10]);
+        assertEquals(0xFF0A141E, pixels[80 * 100 + 80]);
+
+        // Content outside the view is painted as well.
+        pixels = page.snapshot(0, 1050, 100, 50);
+        assertEquals(0xFF00C800, pixels[10 * 100 + 10]);
+        assertEquals(0xFF0A141E, pixels[10 * 100 + 80]);
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testSnapshotInvalidSize() {
+        WebPage page = WebEngineShim.getPage(getEngine());
+        page.snapshot(0, 0, 0, 100);
+    }
+
     @Test(expected = IllegalStateException.class)
     public void testGetClientTextLocationFromNonEventThread() {
         WebPage page = WebEngineShim.getPage(getEngine());
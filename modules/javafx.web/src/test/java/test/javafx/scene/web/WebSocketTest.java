@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.util.concurrent.atomic.AtomicLong;
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+import test.javafx.scene.web.TestHttpServer.Response;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+
+public class WebSocketTest extends TestBase {
+
+    private static final int LARGE = 4 * 1024 * 1024;
+
+    private TestHttpServer server;
+    private final AtomicLong received = new AtomicLong();
+
+    @Before public void setUp() throws IOException {
+        server = new TestHttpServer(request -> switch (request.getPath()) {
+            case "/fragments" -> Response.webSocket(WebSocketTest::sendFragments);
+            case "/count" -> Response.webSocket((socket, fin, opcode, payload) ->
+                    received.addAndGet(payload.length));
+            default -> Response.webSocket(TestHttpServer.ECHO);
+        });
+    }
+
+    @After public void tearDown() throws IOException {
+        server.close();
+    }
+
+    /**
+     * Answers every message with "Hello, world" split across three
+     * frames, followed by an unfragmented "done".
+     */
+    private static void sendFragments(TestHttpServer.WebSocket socket, boolean fin,
+                                      int opcode, byte[] payload) throws IOException {
+        socket.send(false, TestHttpServer.TEXT, "Hel".getBytes(StandardCharsets.UTF_8));
+        socket.send(false, TestHttpServer.CONTINUATION, "lo, ".getBytes(StandardCharsets.UTF_8));
+        socket.send(true, TestHttpServer.CONTINUATION, "world".getBytes(StandardCharsets.UTF_8));
+        socket.send(true, TestHttpServer.TEXT, "done".getBytes(StandardCharsets.UTF_8));
+    }
+
+    /**
+     * Loads a page that opens a WebSocket to the given path, records its
+     * events in {@code window.log} and the received messages in
+     * {@code window.messages}, and runs the script once it is open.
+     */
+    private void open(String path, String onopen) {
+        loadContent("<html><body><script>\n"
+                + "var log = [], messages = [];\n"
+                + "var ws = new WebSocket('" + server.webSocketURL(path) + "');\n"
+                + "ws.onopen = function() { log.push('open'); " + onopen + " };\n"
+                + "ws.onmessage = function(e) { messages.push(e.data); };\n"
+                + "ws.onerror = function() { log.push('error'); };\n"
+                + "ws.onclose = function(e) { log.push('close ' + e.code + ' ' + e.wasClean); };\n"
+                + "</script></body></html>");
+    }
+
+    private void waitFor(String condition) {
+        long deadline = System.currentTimeMillis() + 10000;
+        while (!Boolean.TRUE.equals(executeScript(condition))) {
+            if (System.currentTimeMillis() > deadline) {
+                fail("Timed out waiting for " + condition + ", log: " + executeScript("log.join()"));
+            }
+            try {
+                Thread.sleep(10);
+            } catch (InterruptedException ex) {
+                throw new AssertionError(ex);
+            }
+        }
+    }
+
+    @Test public void testLargeMessageIsEchoed() {
+        open("/echo", "ws.send(new Array(" + LARGE + " + 1).join('x') + 'end');");
+        waitFor("messages.length == 1");
+        assertEquals(LARGE + 3, executeScript("messages[0].length"));
+        assertEquals(Boolean.TRUE, executeScript("/^x*end$/.test(messages[0])"));
+    }
+
+    @Test public void testBufferedAmountDrains() {
+        open("/count", "ws.send(new Array(" + LARGE + " + 1).join('x')); "
+                + "window.initialBufferedAmount = ws.bufferedAmount;");
+        waitFor("window.initialBufferedAmount !== undefined");
+        assertTrue("Nothing was buffered",
+                ((Number) executeScript("initialBufferedAmount")).longValue() > 0);
+        waitFor("ws.bufferedAmount == 0");
+        // The last bytes can still be on their way to the server
+        long deadline = System.currentTimeMillis() + 10000;
+        while (received.get() < LARGE && System.currentTimeMillis() < deadline) {
+            try {
+                Thread.sleep(10);
+            } catch (InterruptedException ex) {
+                throw new AssertionError(ex);
+            }
+        }
+        assertEquals(LARGE, received.get());
+    }
+
+    @Test public void testCloseAfterPendingSendIsClean() {
+        open("/count", "ws.send(new Array(" + LARGE + " + 1).join('x')); ws.close(1000);");
+        waitFor("log.length == 2");
+        assertEquals("open,close 1000 true", executeScript("log.join()"));
+        assertEquals(LARGE, received.get());
+    }
+
+    @Test public void testFragmentedMessagesAreReassembled() {
+        open("/fragments", "ws.send('go'); ws.send('go');");
+        waitFor("messages.length == 4");
+        assertEquals("Hello, world,done,Hello, world,done", executeScript("messages.join()"));
+        assertEquals("open", executeScript("log.join()"));
+    }
+}
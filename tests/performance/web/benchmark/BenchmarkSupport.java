@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package benchmark;
+
+import java.io.BufferedReader;
+import java.io.IOException;
+import java.io.InputStreamReader;
+import java.lang.management.ManagementFactory;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.Callable;
+import java.util.concurrent.FutureTask;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+import javafx.application.Platform;
+
+/**
+ * Helpers shared by the benchmarks.
+ */
+final class BenchmarkSupport {
+
+    private BenchmarkSupport() {
+    }
+
+    /**
+     * Runs the benchmark class again in a new JVM with the same options,
+     * plus {@code -Dbenchmark.child=true} and the given system properties,
+     * and returns the last line of its output that is a JSON object.
+     * Configurations that can only be chosen at startup, or that must not
+     * share a heap, run this way.
+     *
+     * @param main the benchmark class
+     * @param properties the system properties, as {@code name=value}
+     * @return the result line of the child
+     * @throws AssertionError if the child fails or prints no result
+     */
+    static String runChild(Class<?> main, String... properties)
+            throws IOException, InterruptedException {
+        List<String> command = new ArrayList<>();
+        command.add(ProcessHandle.current().info().command().orElse("java"));
+        command.addAll(ManagementFactory.getRuntimeMXBean().getInputArguments());
+        command.add("-cp");
+        command.add(System.getProperty("java.class.path"));
+        for (String property : properties) {
+            command.add("-D" + property);
+        }
+        command.add("-Dbenchmark.child=true");
+        command.add(main.getName());
+
+        Process process = new ProcessBuilder(command)
+                .redirectError(ProcessBuilder.Redirect.INHERIT)
+                .start();
+        String result = null;
+        try (BufferedReader in = new BufferedReader(new InputStreamReader(
+                process.getInputStream(), StandardCharsets.UTF_8))) {
+            for (String line = in.readLine(); line != null; line = in.readLine()) {
+                if (line.startsWith("{")) {
+                    result = line;
+                }
+            }
+        }
+        if (process.waitFor() != 0 || result == null) {
+            throw new AssertionError("Run with " + String.join(" ", properties) + " failed");
+        }
+        return result;
+    }
+
+    /**
+     * Returns a field of {@code /proc/self/status}, such as
+     * {@code "VmRSS:"}, in kilobytes, or -1 where there is no such file.
+     */
+    static long status(String field) {
+        try {
+            for (String line : Files.readAllLines(Path.of("/proc/self/status"))) {
+                if (line.startsWith(field)) {
+                    return Long.parseLong(line.replaceAll("[^0-9]", ""));
+                }
+            }
+        } catch (IOException ex) {
+            // Not Linux
+        }
+        return -1;
+    }
+
+    /**
+     * Runs the job on the FX application thread and waits for its result.
+     */
+    static <T> T submit(Callable<T> job) throws Exception {
+        FutureTask<T> task = new FutureTask<>(job);
+        Platform.runLater(task);
+        return task.get();
+    }
+
+    /**
+     * Returns the first number with the given key in a JSON string. The key
+     * is a regular expression, so that a nested value can be reached with
+     * {@code "outer\".*?\"inner"}.
+     *
+     * @throws AssertionError if there is no such number
+     */
+    static double number(String json, String key) {
+        Matcher m = Pattern.compile("\"" + key + "\":([-0-9.eE+]+)").matcher(json);
+        if (!m.find()) {
+            throw new AssertionError("No " + key + " in " + json);
+        }
+        return Double.parseDouble(m.group(1));
+    }
+}
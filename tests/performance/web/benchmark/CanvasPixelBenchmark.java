@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package benchmark;
+
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import javafx.application.Platform;
+import javafx.scene.Scene;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * Measures 2D canvas pixel manipulation through {@code getImageData} and
+ * {@code putImageData} in a visible WebView, so that every frame is painted.
+ * <p>
+ * Each scenario runs for {@code -Dbenchmark.frames} (default 300) animation
+ * frames on a {@code -Dbenchmark.width} x {@code -Dbenchmark.height}
+ * (default 1024 x 768) canvas and reports the average time per frame:
+ * <ul>
+ * <li>filter: read the whole canvas, invert it and write it back;</li>
+ * <li>sprites: write 64 small 16 x 16 blocks at random positions;</li>
+ * <li>readback: read one pixel after every fillRect, as hit testing does.</li>
+ * </ul>
+ */
+public class CanvasPixelBenchmark {
+
+    private static final String[] SCENARIOS = { "filter", "sprites", "readback" };
+
+    public static void main(String[] args) throws Exception {
+        int frames = Integer.getInteger("benchmark.frames", 300);
+        int width = Integer.getInteger("benchmark.width", 1024);
+        int height = Integer.getInteger("benchmark.height", 768);
+
+        CountDownLatch startup = new CountDownLatch(1);
+        Platform.startup(startup::countDown);
+        startup.await();
+
+        System.out.printf("canvas: %dx%d, frames: %d%n", width, height, frames);
+        for (String scenario : SCENARIOS) {
+            double millisPerFrame = run(scenario, frames, width, height);
+            System.out.printf("%s: %.3f ms/frame%n", scenario, millisPerFrame);
+        }
+        Platform.exit();
+    }
+
+    private static double run(String scenario, int frames, int width, int height)
+            throws InterruptedException {
+        CountDownLatch done = new CountDownLatch(1);
+        double[] result = new double[1];
+        Stage[] stage = new Stage[1];
+        Platform.runLater(() -> {
+            WebView view = new WebView();
+            view.getEngine().setOnAlert(event -> {
+                result[0] = Double.parseDouble(event.getData());
+                done.countDown();
+            });
+            stage[0] = new Stage();
+            stage[0].setScene(new Scene(view, width + 20, height + 20));
+            stage[0].show();
+            view.getEngine().loadContent(page(scenario, frames, width, height));
+        });
+        if (!done.await(5, TimeUnit.MINUTES)) {
+            throw new AssertionError("Timed out running " + scenario);
+        }
+        Platform.runLater(() -> stage[0].close());
+        return result[0];
+    }
+
+    private static String page(String scenario, int frames, int width, int height) {
+        return "<!DOCTYPE html><html><body style='margin:0'>"
+            + "<canvas id=c width=" + width + " height=" + height + "></canvas>"
+            + "<script>\n"
+            + "var c = document.getElementById('c'), g = c.getContext('2d');\n"
+            + "var w = c.width, h = c.height, frame = 0, start = 0;\n"
+            + "g.fillStyle = 'rgb(40, 120, 200)'; g.fillRect(0, 0, w, h);\n"
+            + "var sprite = g.createImageData(16, 16);\n"
+            + "for (var i = 0; i < sprite.data.length; i++) sprite.data[i] = (i * 7) & 255;\n"
+            + "var scenarios = {\n"
+            + "  filter: function() {\n"
+            + "    var img = g.getImageData(0, 0, w, h), d = img.data;\n"
+            + "    for (var i = 0; i < d.length; i += 4) {\n"
+            + "      d[i] = 255 - d[i]; d[i + 1] = 255 - d[i + 1]; d[i + 2] = 255 - d[i + 2];\n"
+            + "    }\n"
+            + "    g.putImageData(img, 0, 0);\n"
+            + "  },\n"
+            + "  sprites: function() {\n"
+            + "    for (var i = 0; i < 64; i++)\n"
+            + "      g.putImageData(sprite, Math.random() * (w - 16) | 0, Math.random() * (h - 16) | 0);\n"
+            + "  },\n"
+            + "  readback: function() {\n"
+            + "    for (var i = 0; i < 64; i++) {\n"
+            + "      var x = Math.random() * (w - 8) | 0, y = Math.random() * (h - 8) | 0;\n"
+            + "      g.fillStyle = 'rgb(' + (i * 4) + ', 0, 0)'; g.fillRect(x, y, 8, 8);\n"
+            + "      g.getImageData(x + 4, y + 4, 1, 1);\n"
+            + "    }\n"
+            + "  }\n"
+            + "};\n"
+            + "function step(now) {\n"
+            + "  if (frame == 10) start = now;\n"
+            + "  if (frame == " + frames + " + 10) { alert((now - start) / " + frames + "); return; }\n"
+            + "  scenarios['" + scenario + "']();\n"
+            + "  frame++;\n"
+            + "  requestAnimationFrame(step);\n"
+            + "}\n"
+            + "requestAnimationFrame(step);\n"
+            + "</script></body></html>";
+    }
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package benchmark;
+
+import static benchmark.BenchmarkSupport.submit;
+
+import com.sun.webkit.DiskCache;
+import com.sun.webkit.MemoryCache;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Locale;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+import test.javafx.scene.web.TestHttpServer;
+import test.javafx.scene.web.TestHttpServer.Response;
+
+/**
+ * Measures page load time from a local HTTP server with and without the
+ * disk cache.
+ * <p>
+ * The server answers every request after {@code -Dbenchmark.latency}
+ * (default 20) milliseconds, serving one page that references
+ * {@code -Dbenchmark.resources} (default 200) stylesheets, scripts and
+ * images. The memory cache is disabled so that every load starts like the
+ * first load of a new process. The page is loaded
+ * {@code -Dbenchmark.iterations} (default 5) times in each mode:
+ * "nocache" without the disk cache, "cold" with an empty disk cache,
+ * "warm" from a disk cache reopened before every load, as at application
+ * start, and "revalidate" likewise but with responses that must be
+ * revalidated ({@code no-cache} with an {@code ETag}). For each mode the
+ * average and best load time and the requests per load that reached the
+ * server are printed as JSON and, if {@code -Dbenchmark.output} is set,
+ * also written to that file for trend tracking.
+ * <p>
+ * The caches are controlled through internal API, so the benchmark needs
+ * {@code --add-exports javafx.web/com.sun.webkit=ALL-UNNAMED}. The server
+ * is {@code test.javafx.scene.web.TestHttpServer}, so the javafx.web test
+ * classes must be on the class path. It runs headless with {@code -Dglass.platform=Monocle
+ * -Dmonocle.platform=Headless -Dprism.order=sw}.
+ */
+public class DiskCacheBenchmark {
+
+    private static final String[] MODES = { "nocache", "cold", "warm", "revalidate" };
+    private static final long CAPACITY = 256L * 1024 * 1024;
+
+    private static int resources;
+    private static int latency;
+    private static final AtomicInteger requests = new AtomicInteger();
+
+    public static void main(String[] args) throws Exception {
+        resources = Integer.getInteger("benchmark.resources", 200);
+        latency = Integer.getInteger("benchmark.latency", 20);
+        int iterations = Integer.getInteger("benchmark.iterations", 5);
+        String output = System.getProperty("benchmark.output");
+
+        TestHttpServer server = new TestHttpServer(DiskCacheBenchmark::handle);
+        Path directory = Files.createTempDirectory("disk-cache-benchmark");
+
+        CountDownLatch startup = new CountDownLatch(1);
+        Platform.startup(startup::countDown);
+        startup.await();
+        submit(() -> {
+            MemoryCache.setCapacities(0, 0, 0);
+            return null;
+        });
+
+        StringBuilder json = new StringBuilder();
+        json.append(String.format(Locale.ROOT,
+                "{\"benchmark\":\"DiskCacheBenchmark\",\"resources\":%d,\"latencyMillis\":%d,"
+                + "\"iterations\":%d,\"modes\":[", resources, latency, iterations));
+        for (int m = 0; m < MODES.length; m++) {
+            String mode = MODES[m];
+            String url = server.url(("revalidate".equals(mode) ? "/etag/" : "/fresh/") + "index.html");
+            submit(() -> {
+                DiskCache.setDirectory("nocache".equals(mode) ? null : directory.toFile(), CAPACITY);
+                DiskCache.clear();
+                return null;
+            });
+            if ("warm".equals(mode) || "revalidate".equals(mode)) {
+                // Populate the cache, and give it time to write the bodies.
+                load(url);
+                Thread.sleep(2000);
+            }
+
+            long total = 0;
+            long best = Long.MAX_VALUE;
+            int requestCount = 0;
+            for (int i = 0; i < iterations; i++) {
+                submit(() -> {
+                    if ("cold".equals(mode)) {
+                        DiskCache.clear();
+                    } else if (!"nocache".equals(mode)) {
+                        DiskCache.setDirectory(null, 0);
+                        DiskCache.setDirectory(directory.toFile(), CAPACITY);
+                    }
+                    return null;
+                });
+                requests.set(0);
+                long elapsed = load(url);
+                requestCount += requests.get();
+                total += elapsed;
+                best = Math.min(best, elapsed);
+            }
+            if (m > 0) {
+                json.append(',');
+            }
+            json.append(String.format(Locale.ROOT,
+                    "{\"name\":\"%s\",\"averageMillis\":%.2f,\"bestMillis\":%.2f,\"requestsPerLoad\":%.1f}",
+                    mode, total / (iterations * 1e6), best / 1e6,
+                    requestCount / (double) iterations));
+        }
+        json.append("]}");
+
+        submit(() -> {
+            DiskCache.setDirectory(null, 0);
+            return null;
+        });
+        System.out.println(json);
+        if (output != null) {
+            Files.writeString(Path.of(output), json + "\n");
+        }
+        server.close();
+        Platform.exit();
+    }
+
+    private static long load(String url) throws InterruptedException {
+        CountDownLatch done = new CountDownLatch(1);
+        long[] elapsed = new long[1];
+        Platform.runLater(() -> {
+            WebEngine engine = new WebEngine();
+            long start = System.nanoTime();
+            engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+                if (n == Worker.State.SUCCEEDED || n == Worker.State.FAILED) {
+                    elapsed[0] = System.nanoTime() - start;
+                    done.countDown();
+                }
+            });
+            engine.load(url);
+        });
+        if (!done.await(5, TimeUnit.MINUTES)) {
+            throw new AssertionError("Timed out loading " + url);
+        }
+        return elapsed[0];
+    }
+
+    /**
+     * Answers a request after the latency. Paths under /fresh/ are
+     * cacheable for an hour; paths under /etag/ must be revalidated and are
+     * answered with 304 when the client has them.
+     */
+    private static Response handle(TestHttpServer.Request request) throws InterruptedException {
+        requests.incrementAndGet();
+        Thread.sleep(latency);
+
+        String path = request.getPath();
+        boolean fresh = path.startsWith("/fresh/");
+        String name = path.substring(path.lastIndexOf('/') + 1);
+        Response response;
+        if (!fresh && request.getHeader("If-None-Match") != null) {
+            response = Response.status(304, "Not Modified");
+        } else if (name.endsWith(".css")) {
+            response = Response.ok("text/css", ".c" + name.hashCode() + " { color: red; }");
+        } else if (name.endsWith(".js")) {
+            response = Response.ok("text/javascript", "var v" + Math.abs(name.hashCode()) + " = 1;");
+        } else if (name.endsWith(".svg")) {
+            response = Response.ok("image/svg+xml",
+                    "<svg xmlns='http://www.w3.org/2000/svg' width='1' height='1'/>");
+        } else {
+            response = Response.ok("text/html", page());
+        }
+        return response.header("Cache-Control", fresh ? "max-age=3600" : "no-cache")
+                .header("ETag", "\"" + name + "\"");
+    }
+
+    private static String page() {
+        StringBuilder html = new StringBuilder("<!DOCTYPE html><html><head>\n");
+        StringBuilder body = new StringBuilder("<body>\n");
+        for (int i = 0; i < resources; i++) {
+            switch (i % 3) {
+                case 0 -> html.append("<link rel=stylesheet href='r").append(i).append(".css'>\n");
+                case 1 -> html.append("<script src='r").append(i).append(".js'></script>\n");
+                default -> body.append("<img src='r").append(i).append(".svg'>\n");
+            }
+        }
+        return html.append("</head>\n").append(body).append("</body></html>\n").toString();
+    }
+}
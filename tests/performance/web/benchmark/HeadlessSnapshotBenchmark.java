@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package benchmark;
+
+import static benchmark.BenchmarkSupport.submit;
+
+import com.sun.javafx.webkit.Accessor;
+import com.sun.webkit.WebPage;
+import java.awt.image.BufferedImage;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Locale;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicLong;
+import javafx.application.Platform;
+import javafx.beans.value.ChangeListener;
+import javafx.beans.value.ObservableValue;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.image.PixelFormat;
+import javafx.scene.image.WritableImage;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+import javax.imageio.ImageIO;
+
+/**
+ * Measures batch HTML to PNG conversion, as done by report and thumbnail
+ * generators, on {@code -Dbenchmark.pages} (default 50) generated pages of
+ * text, tables and boxes, each {@code -Dbenchmark.width} x
+ * {@code -Dbenchmark.height} (default 1024 x 768).
+ * <p>
+ * The modes are "view", which shows every page in a WebView and takes a
+ * snapshot of the scene once the page has been painted, "headless", which
+ * renders every page with {@code WebPage.snapshot} on one worker thread,
+ * and "parallelEncoding", which does the same on
+ * {@code -Dbenchmark.threads} (default: the number of processors) worker
+ * threads, each with an engine of its own. In every mode the image is
+ * encoded as PNG on the thread that took it.
+ * <p>
+ * Only the encoding runs in parallel. Loading and painting stay serialized
+ * on the event thread, and every snapshot also waits for the render thread
+ * to read the pixels back. The "parallelEncoding" mode therefore measures
+ * how much PNG encoding on several threads gains, not parallel rendering.
+ * <p>
+ * The time per page and the pages per second are printed as JSON
+ * and, if {@code -Dbenchmark.output} is set, also written to that file for
+ * trend tracking.
+ * <p>
+ * The page is reached through internal API, so the benchmark needs
+ * {@code --add-exports javafx.web/com.sun.javafx.webkit=ALL-UNNAMED} and
+ * {@code --add-exports javafx.web/com.sun.webkit=ALL-UNNAMED}. It runs
+ * headless with {@code -Dglass.platform=Monocle -Dmonocle.platform=Headless
+ * -Dprism.order=sw}.
+ */
+public class HeadlessSnapshotBenchmark {
+
+    private static int width;
+    private static int height;
+
+    public static void main(String[] args) throws Exception {
+        int pages = Integer.getInteger("benchmark.pages", 50);
+        int threads = Integer.getInteger("benchmark.threads",
+                Runtime.getRuntime().availableProcessors());
+        width = Integer.getInteger("benchmark.width", 1024);
+        height = Integer.getInteger("benchmark.height", 768);
+        String output = System.getProperty("benchmark.output");
+
+        CountDownLatch startup = new CountDownLatch(1);
+        Platform.startup(startup::countDown);
+        startup.await();
+
+        // Warm up each path, so that the first measured page is not charged
+        // with class loading and compilation.
+        view(Math.min(pages, 5));
+        headless(Math.min(pages, 5), 1);
+
+        StringBuilder json = new StringBuilder();
+        json.append(String.format(Locale.ROOT,
+                "{\"benchmark\":\"HeadlessSnapshotBenchmark\",\"pages\":%d,\"width\":%d,\"height\":%d,"
+                + "\"threads\":%d,\"modes\":[", pages, width, height, threads));
+        long[] elapsed = { view(pages), headless(pages, 1), headless(pages, threads) };
+        String[] modes = { "view", "headless", "parallelEncoding" };
+        for (int m = 0; m < modes.length; m++) {
+            if (m > 0) {
+                json.append(',');
+            }
+            json.append(String.format(Locale.ROOT,
+                    "{\"name\":\"%s\",\"millisPerPage\":%.2f,\"pagesPerSecond\":%.2f}",
+                    modes[m], elapsed[m] / (pages * 1e6), pages * 1e9 / elapsed[m]));
+        }
+        json.append("]}");
+
+        System.out.println(json);
+        if (output != null) {
+            Files.writeString(Path.of(output), json + "\n");
+        }
+        Platform.exit();
+    }
+
+    /**
+     * Shows the pages one after another in a WebView and encodes a snapshot
+     * of the scene. The page tells when it has been painted, which is the
+     * case when the second animation frame after the load runs.
+     */
+    private static long view(int pages) throws InterruptedException {
+        CountDownLatch done = new CountDownLatch(1);
+        AtomicInteger next = new AtomicInteger();
+        long start = System.nanoTime();
+        Platform.runLater(() -> {
+            WebView view = new WebView();
+            WebEngine engine = view.getEngine();
+            Stage stage = new Stage();
+            stage.setScene(new Scene(view, width, height));
+            stage.show();
+            engine.setOnAlert(event -> Platform.runLater(() -> {
+                WritableImage image = stage.getScene().snapshot(null);
+                int[] pixels = new int[width * height];
+                image.getPixelReader().getPixels(0, 0, width, height,
+                        PixelFormat.getIntArgbInstance(), pixels, 0, width);
+                encode(pixels);
+                int i = next.incrementAndGet();
+                if (i < pages) {
+                    engine.loadContent(page(i, true));
+                } else {
+                    stage.close();
+                    done.countDown();
+                }
+            }));
+            engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+                if (n == Worker.State.FAILED) {
+                    throw new AssertionError("Failed to load page " + next.get());
+                }
+            });
+            engine.loadContent(page(0, true));
+        });
+        if (!done.await(10, TimeUnit.MINUTES)) {
+            throw new AssertionError("Timed out in view mode");
+        }
+        return System.nanoTime() - start;
+    }
+
+    /**
+     * Renders the pages on the given number of worker threads. Each worker
+     * has an engine of its own, which is never shown; it loads a page, takes
+     * its snapshot and encodes it while the other workers' pages load and
+     * paint on the event thread.
+     */
+    private static long headless(int pages, int threads) throws InterruptedException {
+        AtomicInteger next = new AtomicInteger();
+        AtomicLong failures = new AtomicLong();
+        List<Thread> workers = new ArrayList<>();
+        long start = System.nanoTime();
+        for (int t = 0; t < threads; t++) {
+            Thread worker = new Thread(() -> {
+                try {
+                    WebEngine engine = submit(WebEngine::new);
+                    WebPage page = submit(() -> {
+                        WebPage p = Accessor.getPageFor(engine);
+                        p.setBounds(0, 0, width, height);
+                        return p;
+                    });
+                    for (int i = next.getAndIncrement(); i < pages; i = next.getAndIncrement()) {
+                        if (!load(engine, page(i, false))) {
+                            failures.incrementAndGet();
+                            continue;
+                        }
+                        encode(page.snapshot(0, 0, width, height));
+                    }
+                } catch (Exception | AssertionError ex) {
+                    failures.incrementAndGet();
+                }
+            }, "SnapshotWorker-" + t);
+            worker.start();
+            workers.add(worker);
+        }
+        for (Thread worker : workers) {
+            worker.join();
+        }
+        if (failures.get() > 0) {
+            throw new AssertionError(failures.get() + " pages failed in headless mode");
+        }
+        return System.nanoTime() - start;
+    }
+
+    private static boolean load(WebEngine engine, String html) throws InterruptedException {
+        CountDownLatch done = new CountDownLatch(1);
+        boolean[] succeeded = new boolean[1];
+        Platform.runLater(() -> {
+            engine.getLoadWorker().stateProperty().addListener(new ChangeListener<>() {
+                @Override public void changed(ObservableValue<? extends Worker.State> ov,
+                                              Worker.State o, Worker.State n) {
+                    if (n == Worker.State.SUCCEEDED || n == Worker.State.FAILED) {
+                        ov.removeListener(this);
+                        succeeded[0] = n == Worker.State.SUCCEEDED;
+                        done.countDown();
+                    }
+                }
+            });
+            engine.loadContent(html);
+        });
+        if (!done.await(5, TimeUnit.MINUTES)) {
+            throw new AssertionError("Timed out loading a page");
+        }
+        return succeeded[0];
+    }
+
+    private static void encode(int[] pixels) {
+        BufferedImage image = new BufferedImage(width, height, BufferedImage.TYPE_INT_ARGB);
+        image.setRGB(0, 0, width, height, pixels, 0, width);
+        try {
+            ImageIO.write(image, "png", new ByteArrayOutputStream());
+        } catch (IOException ex) {
+            throw new AssertionError(ex);
+        }
+    }
+
+    private static String page(int index, boolean reportPainted) {
+        StringBuilder html = new StringBuilder("<!DOCTYPE html><html><head><style>\n"
+                + "body { margin: 0; font: 14px sans-serif; }\n"
+                + "td { border: 1px solid #888; padding: 2px 6px; }\n"
+                + ".box { display: inline-block; width: 40px; height: 40px; margin: 8px;"
+                + " border-radius: 6px; }\n"
+                + "</style></head><body>\n");
+        html.append("<h1>Report ").append(index).append("</h1>\n<p>");
+        for (int j = 0; j < 300; j++) {
+            html.append("item").append((index * 31 + j * 17) % 997).append(' ');
+        }
+        html.append("</p>\n<table>\n");
+        for (int r = 0; r < 20; r++) {
+            html.append("<tr>");
+            for (int c = 0; c < 8; c++) {
+                html.append("<td>").append((index + r * 8 + c) * 7919 % 10007).append("</td>");
+            }
+            html.append("</tr>\n");
+        }
+        html.append("</table>\n");
+        for (int b = 0; b < 40; b++) {
+            html.append("<div class=box style='background:hsl(")
+                .append((index * 37 + b * 9) % 360).append(",60%,50%)'></div>");
+        }
+        if (reportPainted) {
+            html.append("\n<script>window.onload = function() {\n"
+                + "  requestAnimationFrame(function() { requestAnimationFrame(function() { alert('painted'); }); });\n"
+                + "};</script>");
+        }
+        return html.append("\n</body></html>").toString();
+    }
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package benchmark;
+
+import static benchmark.BenchmarkSupport.number;
+import static benchmark.BenchmarkSupport.runChild;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Locale;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * Measures whether running JavaScript collections in the idle time after a
+ * pulse ({@code -Dcom.sun.webkit.useIdleTimeGC=true}) makes the frames of
+ * an animation that allocates more regular.
+ * <p>
+ * A page in a WebView animates a set of boxes from
+ * {@code requestAnimationFrame} and, on every frame, allocates
+ * {@code -Dbenchmark.allocations} (default 20000) short-lived objects, so
+ * that eden collections are frequent. After a warm-up it records the
+ * interval between {@code -Dbenchmark.frames} (default 1200) frames. The
+ * benchmark starts itself once with idle-time collection and once
+ * without, in separate processes, and reports for each the mean, 99th
+ * percentile and maximum frame interval and the frames that took longer
+ * than one and a half pulses. It also reports the ratios of the idle to
+ * the default run. The results are printed as JSON and, if
+ * {@code -Dbenchmark.output} is set, also written to that file for trend
+ * tracking.
+ * <p>
+ * It runs headless with {@code -Dglass.platform=Monocle
+ * -Dmonocle.platform=Headless -Dprism.order=sw}.
+ */
+public class IdleGCBenchmark {
+
+    public static void main(String[] args) throws Exception {
+        if (Boolean.getBoolean("benchmark.child")) {
+            System.out.println(runFrames());
+            Platform.exit();
+            return;
+        }
+
+        String output = System.getProperty("benchmark.output");
+        String idle = runChild(IdleGCBenchmark.class,
+                "benchmark.mode=idle", "com.sun.webkit.useIdleTimeGC=true");
+        String timers = runChild(IdleGCBenchmark.class,
+                "benchmark.mode=default", "com.sun.webkit.useIdleTimeGC=false");
+
+        String json = String.format(Locale.ROOT,
+                "{\"benchmark\":\"IdleGCBenchmark\",\"configurations\":[%s,%s],"
+                + "\"idleRelativeToDefault\":{\"p99Interval\":%.2f,\"maxInterval\":%.2f,\"longFrames\":%.2f}}",
+                idle, timers,
+                number(idle, "p99Millis") / number(timers, "p99Millis"),
+                number(idle, "maxMillis") / number(timers, "maxMillis"),
+                (number(idle, "longFrames") + 1) / (number(timers, "longFrames") + 1));
+        System.out.println(json);
+        if (output != null) {
+            Files.writeString(Path.of(output), json + "\n");
+        }
+    }
+
+    private static String runFrames() throws InterruptedException {
+        int frames = Integer.getInteger("benchmark.frames", 1200);
+        int allocations = Integer.getInteger("benchmark.allocations", 20000);
+        int pulse = Integer.getInteger("javafx.animation.pulse", 60);
+
+        CountDownLatch startup = new CountDownLatch(1);
+        Platform.startup(startup::countDown);
+        startup.await();
+
+        CountDownLatch done = new CountDownLatch(1);
+        String[] result = new String[1];
+        Stage[] stage = new Stage[1];
+        Platform.runLater(() -> {
+            WebView view = new WebView();
+            WebEngine engine = view.getEngine();
+            engine.setOnAlert(event -> {
+                result[0] = event.getData();
+                done.countDown();
+            });
+            engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+                if (n == Worker.State.FAILED) {
+                    done.countDown();
+                }
+            });
+            stage[0] = new Stage();
+            stage[0].setScene(new Scene(view, 800, 600));
+            stage[0].show();
+            engine.loadContent(page(frames, allocations, 1000.0 / pulse));
+        });
+        if (!done.await(10, TimeUnit.MINUTES)) {
+            throw new AssertionError("Timed out");
+        }
+        Platform.runLater(() -> stage[0].close());
+        if (result[0] == null) {
+            throw new AssertionError("Failed to load the page");
+        }
+        return "{\"name\":\"" + System.getProperty("benchmark.mode") + "\"," + result[0].substring(1);
+    }
+
+    /*
+     * Every frame moves the boxes and replaces most of a retained array of
+     * small objects, like an application that rebuilds its view model on
+     * every frame.
+     */
+    private static String page(int frames, int allocations, double pulseMillis) {
+        return "<!DOCTYPE html><html><body style='margin:0'>\n"
+            + "<div id='boxes'></div><script>\n"
+            + "var frames = " + frames + ", allocations = " + allocations + ";\n"
+            + "var pulseMillis = " + pulseMillis + ", warmup = 120;\n"
+            + "var boxes = document.getElementById('boxes');\n"
+            + "for (var i = 0; i < 50; i++) {\n"
+            + "  var box = document.createElement('div');\n"
+            + "  box.style.cssText = 'position:absolute;width:20px;height:20px;background:#36c';\n"
+            + "  boxes.appendChild(box);\n"
+            + "}\n"
+            + "var model = [], intervals = [], last = 0, count = 0;\n"
+            + "function frame(now) {\n"
+            + "  for (var i = 0; i < allocations; i++) {\n"
+            + "    model[i % 1000] = { id: i, label: 'item' + i, values: [i, i * 2, i * 3] };\n"
+            + "  }\n"
+            + "  for (var i = 0; i < boxes.children.length; i++) {\n"
+            + "    var style = boxes.children[i].style;\n"
+            + "    style.left = ((count * 3 + i * 15) % 780) + 'px';\n"
+            + "    style.top = ((count * 2 + i * 11) % 580) + 'px';\n"
+            + "  }\n"
+            + "  if (count > warmup) intervals.push(now - last);\n"
+            + "  last = now;\n"
+            + "  if (++count <= warmup + frames) { requestAnimationFrame(frame); return; }\n"
+            + "  var sorted = intervals.slice().sort(function(a, b) { return a - b; });\n"
+            + "  var sum = 0, slow = 0;\n"
+            + "  for (var i = 0; i < sorted.length; i++) {\n"
+            + "    sum += sorted[i];\n"
+            + "    if (sorted[i] > pulseMillis * 1.5) slow++;\n"
+            + "  }\n"
+            + "  alert(JSON.stringify({ frames: sorted.length, meanMillis: sum / sorted.length,\n"
+            + "      p99Millis: sorted[Math.floor(sorted.length * 0.99)],\n"
+            + "      maxMillis: sorted[sorted.length - 1], longFrames: slow }));\n"
+            + "}\n"
+            + "requestAnimationFrame(frame);\n"
+            + "</script></body></html>";
+    }
+}
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package benchmark;
+
+import static benchmark.BenchmarkSupport.number;
+import static benchmark.BenchmarkSupport.runChild;
+import static benchmark.BenchmarkSupport.status;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Locale;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+
+/**
+ * Measures how much the optimizing JavaScript tiers gain on long-running
+ * page scripts, and what they cost in memory.
+ * <p>
+ * Four Octane-style kernels run in a page: "numeric" (n-body integration
+ * on typed arrays), "objects" (a constraint solver over small objects with
+ * polymorphic calls), "grid" (sorting, filtering and aggregating rows, as
+ * a data grid does) and "strings" (formatting and parsing chart labels).
+ * Each kernel runs {@code -Dbenchmark.iterations} (default 60) timed
+ * iterations, so that the time of the first iteration shows the cost
+ * before tier-up and the median of the last third the steady state.
+ * <p>
+ * The benchmark starts itself once with the FTL tier and once with only
+ * the baseline and DFG tiers ({@code -Dcom.sun.webkit.useFTLJIT=false}),
+ * in separate processes, and reports for each the first, worst and
+ * steady-state iteration times per kernel and the resident memory growth,
+ * plus the steady-state speedup of the FTL tier. The results are printed
+ * as JSON and, if {@code -Dbenchmark.output} is set, also written to that
+ * file for trend tracking. The resident memory is read from
+ * {@code /proc/self/status}, so it is only reported on Linux, the platform
+ * the FTL tier is built for.
+ * <p>
+ * It runs headless with {@code -Dglass.platform=Monocle
+ * -Dmonocle.platform=Headless -Dprism.order=sw}.
+ */
+public class JITTierBenchmark {
+
+    private static final String[] KERNELS = { "numeric", "objects", "grid", "strings" };
+
+    public static void main(String[] args) throws Exception {
+        if (Boolean.getBoolean("benchmark.child")) {
+            runKernels();
+            return;
+        }
+
+        int iterations = Integer.getInteger("benchmark.iterations", 60);
+        String output = System.getProperty("benchmark.output");
+        // Each tier configuration starts from a fresh JavaScript VM and heap.
+        String ftl = runChild(JITTierBenchmark.class, "com.sun.webkit.useFTLJIT=true");
+        String dfg = runChild(JITTierBenchmark.class, "com.sun.webkit.useFTLJIT=false");
+
+        StringBuilder json = new StringBuilder();
+        json.append(String.format(Locale.ROOT,
+                "{\"benchmark\":\"JITTierBenchmark\",\"iterations\":%d,\"configurations\":[%s,%s],\"speedup\":{",
+                iterations, ftl, dfg));
+        for (int i = 0; i < KERNELS.length; i++) {
+            if (i > 0) {
+                json.append(',');
+            }
+            json.append(String.format(Locale.ROOT, "\"%s\":%.2f", KERNELS[i],
+                    number(dfg, KERNELS[i] + "\".*?\"steadyMillis") / number(ftl, KERNELS[i] + "\".*?\"steadyMillis")));
+        }
+        json.append("}}");
+
+        System.out.println(json);
+        if (output != null) {
+            Files.writeString(Path.of(output), json + "\n");
+        }
+    }
+
+    private static void runKernels() throws Exception {
+        int iterations = Integer.getInteger("benchmark.iterations", 60);
+
+        CountDownLatch startup = new CountDownLatch(1);
+        Platform.startup(startup::countDown);
+        startup.await();
+
+        long rssBefore = status("VmRSS:");
+        StringBuilder json = new StringBuilder();
+        json.append(String.format(Locale.ROOT, "{\"useFTLJIT\":%s,\"kernels\":{",
+                System.getProperty("com.sun.webkit.useFTLJIT", "true")));
+        for (int i = 0; i < KERNELS.length; i++) {
+            String result = run(KERNELS[i], iterations);
+            if (i > 0) {
+                json.append(',');
+            }
+            json.append(String.format(Locale.ROOT,
+                    "\"%s\":{\"firstMillis\":%.3f,\"maxMillis\":%.3f,\"steadyMillis\":%.3f}",
+                    KERNELS[i],
+                    number(result, "first"),
+                    number(result, "max"),
+                    number(result, "steady")));
+        }
+        long rssAfter = status("VmRSS:");
+        json.append(String.format(Locale.ROOT, "},\"rssGrowthMB\":%.1f}",
+                rssBefore < 0 || rssAfter < 0 ? -1.0 : (rssAfter - rssBefore) / 1024.0));
+
+        System.out.println(json);
+        Platform.exit();
+    }
+
+    private static String run(String kernel, int iterations) throws InterruptedException {
+        CountDownLatch done = new CountDownLatch(1);
+        String[] result = new String[1];
+        Platform.runLater(() -> {
+            WebEngine engine = new WebEngine();
+            engine.setOnAlert(event -> {
+                result[0] = event.getData();
+                done.countDown();
+            });
+            engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+                if (n == Worker.State.FAILED) {
+                    done.countDown();
+                }
+            });
+            engine.loadContent(page(kernel, iterations));
+        });
+        if (!done.await(10, TimeUnit.MINUTES)) {
+            throw new AssertionError("Timed out running " + kernel);
+        }
+        if (result[0] == null || result[0].startsWith("error")) {
+            throw new AssertionError("Failed running " + kernel + ": " + result[0]);
+        }
+        return result[0];
+    }
+
+    /*
+     * Iterations are run from timers rather than in one loop, so that the
+     * page stays responsive and the concurrent compilers can finish
+     * between them.
+     */
+    private static String page(String kernel, int iterations) {
+        return "<!DOCTYPE html><html><body><script>\n"
+            + KERNEL_SOURCE
+            + "var kernel = kernels['" + kernel + "'];\n"
+            + "var times = [], checksum = 0;\n"
+            + "function step() {\n"
+            + "  try {\n"
+            + "    var start = performance.now();\n"
+            + "    checksum += kernel();\n"
+            + "    times.push(performance.now() - start);\n"
+            + "  } catch (e) {\n"
+            + "    alert('error: ' + e);\n"
+            + "    return;\n"
+            + "  }\n"
+            + "  if (times.length < " + iterations + ") {\n"
+            + "    setTimeout(step, 0);\n"
+            + "    return;\n"
+            + "  }\n"
+            + "  var tail = times.slice(Math.floor(times.length * 2 / 3)).sort(function(a, b) { return a - b; });\n"
+            + "  alert(JSON.stringify({ first: times[0], max: Math.max.apply(null, times),\n"
+            + "      steady: tail[Math.floor(tail.length / 2)], checksum: checksum }));\n"
+            + "}\n"
+            + "setTimeout(step, 0);\n"
+            + "</script></body></html>";
+    }
+
+    private static final String KERNEL_SOURCE = """
+        var kernels = {};
+
+        kernels.numeric = function() {
+            var n = 64, steps = 200;
+            var x = new Float64Array(n), y = new Float64Array(n), z = new Float64Array(n);
+            var vx = new Float64Array(n), vy = new Float64Array(n), vz = new Float64Array(n);
+            var m = new Float64Array(n);
+            for (var i = 0; i < n; i++) {
+                x[i] = Math.cos(i); y[i] = Math.sin(i); z[i] = i / n;
+                m[i] = 1 + (i % 7);
+            }
+            for (var s = 0; s < steps; s++) {
+                for (var i = 0; i < n; i++) {
+                    for (var j = i + 1; j < n; j++) {
+                        var dx = x[i] - x[j], dy = y[i] - y[j], dz = z[i] - z[j];
+                        var d2 = dx * dx + dy * dy + dz * dz + 0.01;
+                        var mag = 0.001 / (d2 * Math.sqrt(d2));
+                        vx[i] -= dx * m[j] * mag; vy[i] -= dy * m[j] * mag; vz[i] -= dz * m[j] * mag;
+                        vx[j] += dx * m[i] * mag; vy[j] += dy * m[i] * mag; vz[j] += dz * m[i] * mag;
+                    }
+                }
+                for (var i = 0; i < n; i++) {
+                    x[i] += vx[i]; y[i] += vy[i]; z[i] += vz[i];
+                }
+            }
+            return x[0] + y[0] + z[0];
+        };
+
+        function Variable(value) { this.value = value; this.constraints = []; }
+        function Constraint(a, b) { this.a = a; this.b = b; a.constraints.push(this); b.constraints.push(this); }
+        Constraint.prototype.error = function() { return 0; };
+        function Equal(a, b) { Constraint.call(this, a, b); }
+        Equal.prototype = Object.create(Constraint.prototype);
+        Equal.prototype.error = function() { return this.b.value - this.a.value; };
+        function Offset(a, b, offset) { Constraint.call(this, a, b); this.offset = offset; }
+        Offset.prototype = Object.create(Constraint.prototype);
+        Offset.prototype.error = function() { return this.b.value - this.a.value - this.offset; };
+        function Scale(a, b, scale) { Constraint.call(this, a, b); this.scale = scale; }
+        Scale.prototype = Object.create(Constraint.prototype);
+        Scale.prototype.error = function() { return this.b.value - this.a.value * this.scale; };
+
+        kernels.objects = function() {
+            var variables = [], constraints = [];
+            for (var i = 0; i < 400; i++) {
+                variables.push(new Variable(i % 13));
+            }
+            for (var i = 1; i < variables.length; i++) {
+                var a = variables[i - 1], b = variables[i];
+                constraints.push(i % 3 == 0 ? new Equal(a, b)
+                    : i % 3 == 1 ? new Offset(a, b, 1) : new Scale(a, b, 1.001));
+            }
+            var total = 0;
+            for (var pass = 0; pass < 60; pass++) {
+                total = 0;
+                for (var i = 0; i < constraints.length; i++) {
+                    var c = constraints[i], e = c.error();
+                    c.a.value += e * 0.25;
+                    c.b.value -= e * 0.25;
+                    total += Math.abs(e);
+                }
+            }
+            return total;
+        };
+
+        kernels.grid = function() {
+            var rows = [];
+            for (var i = 0; i < 5000; i++) {
+                rows.push({ id: i, region: 'r' + (i % 17), price: (i * 7919) % 1000 / 10,
+                            quantity: (i * 104729) % 50, active: i % 5 != 0 });
+            }
+            rows.sort(function(a, b) { return a.price - b.price || a.id - b.id; });
+            var byRegion = {};
+            rows.filter(function(r) { return r.active && r.quantity > 5; }).forEach(function(r) {
+                var total = byRegion[r.region] || (byRegion[r.region] = { count: 0, revenue: 0 });
+                total.count++;
+                total.revenue += r.price * r.quantity;
+            });
+            var result = 0;
+            for (var key in byRegion) {
+                result += byRegion[key].revenue / byRegion[key].count;
+            }
+            return result;
+        };
+
+        kernels.strings = function() {
+            var labels = [];
+            for (var i = 0; i < 3000; i++) {
+                var date = new Date(2020, i % 12, 1 + i % 28);
+                labels.push(date.getFullYear() + '-' + ('0' + (date.getMonth() + 1)).slice(-2)
+                    + '-' + ('0' + date.getDate()).slice(-2) + ' ' + (i * 1.5).toFixed(1) + '%');
+            }
+            var csv = labels.join(',');
+            var sum = 0;
+            csv.split(',').forEach(function(label) {
+                var parts = label.split(' ');
+                sum += parseFloat(parts[1]) + parseInt(parts[0].split('-')[1], 10);
+            });
+            return sum + JSON.parse(JSON.stringify(labels.slice(0, 100))).length;
+        };
+        """;
+}
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package benchmark;
+
+import static benchmark.BenchmarkSupport.number;
+import static benchmark.BenchmarkSupport.runChild;
+import static benchmark.BenchmarkSupport.status;
+import static benchmark.BenchmarkSupport.submit;
+
+import com.sun.webkit.JSEngine;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Locale;
+import java.util.Map;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+
+/**
+ * Shows the memory and throughput trade-off of the JavaScript engine
+ * profiles ({@code -Dcom.sun.webkit.jscProfile}).
+ * <p>
+ * A page runs {@code -Dbenchmark.iterations} (default 60) tasks from
+ * timers, as an application page does. Each task allocates a tree of
+ * small objects, of which the last few are kept alive, runs a numeric
+ * kernel, and serializes and parses a batch of records. The benchmark
+ * starts itself once per profile, in separate processes, and reports for
+ * each the total, steady-state (median of the last third) and worst task
+ * times, the worst of which includes garbage collection pauses and
+ * compilation stalls, the resident memory growth and peak, and the
+ * effective engine options. It also reports the total time and peak
+ * memory of each profile relative to the default one. The results are
+ * printed as JSON and, if {@code -Dbenchmark.output} is set, also written
+ * to that file for trend tracking. The resident memory is read from
+ * {@code /proc/self/status}, so it is only reported on Linux.
+ * <p>
+ * It uses the internal {@code com.sun.webkit.JSEngine} class, so it needs
+ * {@code --add-exports javafx.web/com.sun.webkit=ALL-UNNAMED}, and runs
+ * headless with {@code -Dglass.platform=Monocle
+ * -Dmonocle.platform=Headless -Dprism.order=sw}.
+ */
+public class JSEngineProfileBenchmark {
+
+    private static final String[] PROFILES = { "default", "lowMemory", "throughput", "lowLatency" };
+
+    public static void main(String[] args) throws Exception {
+        if (Boolean.getBoolean("benchmark.child")) {
+            runTasks();
+            return;
+        }
+
+        int iterations = Integer.getInteger("benchmark.iterations", 60);
+        String output = System.getProperty("benchmark.output");
+        String[] results = new String[PROFILES.length];
+        // The profile is applied when the VM is created and cannot change
+        // afterwards, so each profile runs in a new JVM.
+        for (int i = 0; i < PROFILES.length; i++) {
+            results[i] = runChild(JSEngineProfileBenchmark.class,
+                    "com.sun.webkit.jscProfile=" + PROFILES[i]);
+        }
+
+        StringBuilder json = new StringBuilder();
+        json.append(String.format(Locale.ROOT,
+                "{\"benchmark\":\"JSEngineProfileBenchmark\",\"iterations\":%d,\"configurations\":[%s],\"relativeToDefault\":{",
+                iterations, String.join(",", results)));
+        for (int i = 1; i < PROFILES.length; i++) {
+            if (i > 1) {
+                json.append(',');
+            }
+            json.append(String.format(Locale.ROOT, "\"%s\":{\"totalTime\":%.2f,\"peakMemory\":%.2f}",
+                    PROFILES[i],
+                    number(results[i], "totalMillis") / number(results[0], "totalMillis"),
+                    number(results[i], "peakRSSMB") / number(results[0], "peakRSSMB")));
+        }
+        json.append("}}");
+
+        System.out.println(json);
+        if (output != null) {
+            Files.writeString(Path.of(output), json + "\n");
+        }
+    }
+
+    private static void runTasks() throws Exception {
+        int iterations = Integer.getInteger("benchmark.iterations", 60);
+
+        CountDownLatch startup = new CountDownLatch(1);
+        Platform.startup(startup::countDown);
+        startup.await();
+
+        long rssBefore = status("VmRSS:");
+        CountDownLatch done = new CountDownLatch(1);
+        String[] result = new String[1];
+        Platform.runLater(() -> {
+            WebEngine engine = new WebEngine();
+            engine.setOnAlert(event -> {
+                result[0] = event.getData();
+                done.countDown();
+            });
+            engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+                if (n == Worker.State.FAILED) {
+                    done.countDown();
+                }
+            });
+            engine.loadContent(page(iterations));
+        });
+        if (!done.await(10, TimeUnit.MINUTES)) {
+            throw new AssertionError("Timed out");
+        }
+        if (result[0] == null || result[0].startsWith("error")) {
+            throw new AssertionError("Failed: " + result[0]);
+        }
+        long rssAfter = status("VmRSS:");
+        long rssPeak = status("VmHWM:");
+
+        String options = submit(() -> {
+            StringBuilder list = new StringBuilder();
+            for (Map.Entry<String, String> option : JSEngine.getEffectiveOptions().entrySet()) {
+                list.append(list.length() == 0 ? "" : ",")
+                        .append('"').append(option.getKey()).append("\":\"")
+                        .append(option.getValue()).append('"');
+            }
+            return list.toString();
+        });
+
+        System.out.println(String.format(Locale.ROOT,
+                "{\"profile\":\"%s\",%s,\"rssGrowthMB\":%.1f,\"peakRSSMB\":%.1f,\"options\":{%s}}",
+                System.getProperty("com.sun.webkit.jscProfile"),
+                result[0].substring(1, result[0].length() - 1),
+                rssBefore < 0 || rssAfter < 0 ? -1.0 : (rssAfter - rssBefore) / 1024.0,
+                rssPeak < 0 ? -1.0 : rssPeak / 1024.0,
+                options));
+        Platform.exit();
+    }
+
+    private static String page(int iterations) {
+        return "<!DOCTYPE html><html><body><script>\n"
+            + "var iterations = " + iterations + ";\n"
+            + PAGE_SOURCE
+            + "</script></body></html>";
+    }
+
+    private static final String PAGE_SOURCE = """
+        var retained = [];
+
+        function tree(depth, seed) {
+            if (!depth) {
+                return { value: seed, label: 'n' + seed };
+            }
+            return { left: tree(depth - 1, seed * 2), right: tree(depth - 1, seed * 2 + 1), value: seed };
+        }
+
+        function sum(node) {
+            return node.left ? node.value + sum(node.left) + sum(node.right) : node.value;
+        }
+
+        function numeric() {
+            var n = 20000, a = new Float64Array(n), s = 0;
+            for (var i = 0; i < n; i++) {
+                a[i] = Math.sin(i) * Math.cos(i / 3);
+            }
+            for (var pass = 0; pass < 10; pass++) {
+                for (var i = 1; i < n - 1; i++) {
+                    a[i] = (a[i - 1] + a[i] + a[i + 1]) / 3;
+                }
+                s += a[n >> 1];
+            }
+            return s;
+        }
+
+        function records(k) {
+            var rows = [];
+            for (var i = 0; i < 2000; i++) {
+                rows.push({ id: i, name: 'row ' + i + '/' + k, tags: ['a' + i % 7, 'b' + i % 11], price: i * 1.25 });
+            }
+            return JSON.parse(JSON.stringify(rows)).length;
+        }
+
+        function task(k) {
+            var t = tree(14, k);
+            retained.push(t);
+            if (retained.length > 8) {
+                retained.shift();
+            }
+            return sum(t) + numeric() + records(k);
+        }
+
+        var times = [], checksum = 0;
+        function step() {
+            try {
+                var start = performance.now();
+                checksum += task(times.length);
+                times.push(performance.now() - start);
+            } catch (e) {
+                alert('error: ' + e);
+                return;
+            }
+            if (times.length < iterations) {
+                setTimeout(step, 0);
+                return;
+            }
+            var total = times.reduce(function(a, b) { return a + b; }, 0);
+            var tail = times.slice(Math.floor(times.length * 2 / 3)).sort(function(a, b) { return a - b; });
+            alert(JSON.stringify({ totalMillis: total, steadyMillis: tail[tail.length >> 1],
+                maxMillis: Math.max.apply(null, times), checksum: checksum }));
+        }
+        setTimeout(step, 0);
+        """;
+}
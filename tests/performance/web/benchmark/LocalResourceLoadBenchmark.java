@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package benchmark;
+
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+
+/**
+ * Measures how many local ({@code file:}) resources per second a WebEngine loads.
+ * <p>
+ * A temporary app bundle is generated with one page that references
+ * {@code -Dbenchmark.resources} (default 2000) small stylesheets, scripts,
+ * images and fonts. The page is loaded {@code -Dbenchmark.iterations} times
+ * (default 10) after two warm-up loads, and the time from {@code load()} to
+ * {@code SUCCEEDED} is reported.
+ */
+public class LocalResourceLoadBenchmark {
+
+    private static final String[] EXTENSIONS = { "css", "js", "png", "woff2", "json", "svg" };
+
+    public static void main(String[] args) throws Exception {
+        int resources = Integer.getInteger("benchmark.resources", 2000);
+        int iterations = Integer.getInteger("benchmark.iterations", 10);
+
+        Path bundle = createBundle(resources);
+        String url = bundle.resolve("index.html").toUri().toString();
+
+        CountDownLatch startup = new CountDownLatch(1);
+        Platform.startup(startup::countDown);
+        startup.await();
+
+        for (int i = 0; i < 2; i++) {
+            load(url);
+        }
+
+        long total = 0;
+        long best = Long.MAX_VALUE;
+        for (int i = 0; i < iterations; i++) {
+            long elapsed = load(url);
+            total += elapsed;
+            best = Math.min(best, elapsed);
+        }
+
+        double averageMillis = total / (iterations * 1e6);
+        System.out.printf("resources: %d, iterations: %d%n", resources, iterations);
+        System.out.printf("average: %.2f ms, best: %.2f ms%n", averageMillis, best / 1e6);
+        System.out.printf("throughput: %.0f resources/s%n", resources / (averageMillis / 1000));
+        Platform.exit();
+    }
+
+    private static long load(String url) throws InterruptedException {
+        CountDownLatch done = new CountDownLatch(1);
+        long[] elapsed = new long[1];
+        Platform.runLater(() -> {
+            WebEngine engine = new WebEngine();
+            long start = System.nanoTime();
+            engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+                if (n == Worker.State.SUCCEEDED || n == Worker.State.FAILED) {
+                    elapsed[0] = System.nanoTime() - start;
+                    done.countDown();
+                }
+            });
+            engine.load(url);
+        });
+        if (!done.await(5, TimeUnit.MINUTES)) {
+            throw new AssertionError("Timed out loading " + url);
+        }
+        return elapsed[0];
+    }
+
+    private static Path createBundle(int resources) throws IOException {
+        Path dir = Files.createTempDirectory("local-resource-benchmark");
+        dir.toFile().deleteOnExit();
+        StringBuilder html = new StringBuilder("<!DOCTYPE html><html><head>\n");
+        StringBuilder body = new StringBuilder("<body>\n");
+        for (int i = 0; i < resources; i++) {
+            String ext = EXTENSIONS[i % EXTENSIONS.length];
+            String name = "r" + i + "." + ext;
+            Path file = dir.resolve(name);
+            file.toFile().deleteOnExit();
+            switch (ext) {
+                case "css" -> {
+                    Files.writeString(file, ".c" + i + " { color: red; }");
+                    html.append("<link rel=stylesheet href='").append(name).append("'>\n");
+                }
+                case "js" -> {
+                    Files.writeString(file, "var v" + i + " = " + i + ";");
+                    html.append("<script src='").append(name).append("'></script>\n");
+                }
+                case "png" -> {
+                    Files.write(file, PNG_1X1);
+                    body.append("<img src='").append(name).append("'>\n");
+                }
+                case "svg" -> {
+                    Files.writeString(file, "<svg xmlns='http://www.w3.org/2000/svg' width='1' height='1'/>");
+                    body.append("<img src='").append(name).append("'>\n");
+                }
+                default -> {
+                    Files.writeString(file, "{}");
+                    html.append("<link rel=preload as=fetch crossorigin href='").append(name).append("'>\n");
+                }
+            }
+        }
+        html.append("</head>\n").append(body).append("</body></html>\n");
+        Path index = dir.resolve("index.html");
+        index.toFile().deleteOnExit();
+        Files.writeString(index, html);
+        return dir;
+    }
+
+    private static final byte[] PNG_1X1 = {
+        (byte) 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n',
+        0, 0, 0, 13, 'I', 'H', 'D', 'R', 0, 0, 0, 1, 0, 0, 0, 1, 8, 6, 0, 0, 0,
+        0x1f, 0x15, (byte) 0xc4, (byte) 0x89,
+        0, 0, 0, 13, 'I', 'D', 'A', 'T', 0x78, (byte) 0x9c, 0x63, 0x60, 0, 0, 0, 0, 5, 0, 1,
+        0x0d, 0x0a, 0x2d, (byte) 0xb4,
+        0, 0, 0, 0, 'I', 'E', 'N', 'D', (byte) 0xae, 0x42, 0x60, (byte) 0x82
+    };
+}
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package benchmark;
+
+import static benchmark.BenchmarkSupport.number;
+
+import com.sun.javafx.webkit.Accessor;
+import com.sun.webkit.JavaCallProfiler;
+import com.sun.webkit.WebPage;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Locale;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * Measures the WebView paint pipeline, from {@code WebPage::paint} through
+ * {@code GraphicsContextJava} and the render queue to Prism, on a set of
+ * generated, deterministic static pages: long text, tables, SVG, CSS
+ * transforms, 2D canvas and an image grid.
+ * <p>
+ * Each page is loaded into a {@code -Dbenchmark.width} x
+ * {@code -Dbenchmark.height} (default 1024 x 768) WebView and then changed
+ * on every animation frame, for {@code -Dbenchmark.frames} (default 100)
+ * frames, so that it is laid out and painted completely each time. The
+ * page's paint statistics give the average style and layout time, paint
+ * time, render queue bytes and calls into Java per frame. Calls into Java
+ * are only counted with {@code -Dbenchmark.javaCalls=true}, which enables
+ * the {@code JavaCallProfiler} and with it some overhead on every call, so
+ * the other figures are best taken from a run without it. The results are
+ * printed as JSON and, if {@code -Dbenchmark.output} is set, also written
+ * to that file for trend tracking.
+ * <p>
+ * The statistics are read through internal API, so the benchmark needs
+ * {@code --add-exports javafx.web/com.sun.javafx.webkit=ALL-UNNAMED} and
+ * {@code --add-exports javafx.web/com.sun.webkit=ALL-UNNAMED}. It runs
+ * headless with {@code -Dglass.platform=Monocle -Dmonocle.platform=Headless
+ * -Dprism.order=sw}.
+ */
+public class PaintBenchmark {
+
+    private static final String[] PAGES = { "text", "table", "svg", "transforms", "canvas", "images" };
+
+    public static void main(String[] args) throws Exception {
+        int frames = Integer.getInteger("benchmark.frames", 100);
+        int width = Integer.getInteger("benchmark.width", 1024);
+        int height = Integer.getInteger("benchmark.height", 768);
+        String output = System.getProperty("benchmark.output");
+
+        CountDownLatch startup = new CountDownLatch(1);
+        Platform.startup(startup::countDown);
+        startup.await();
+        if (Boolean.getBoolean("benchmark.javaCalls")) {
+            JavaCallProfiler.setEnabled(true);
+        }
+
+        StringBuilder json = new StringBuilder();
+        json.append(String.format(Locale.ROOT,
+                "{\"benchmark\":\"PaintBenchmark\",\"width\":%d,\"height\":%d,\"frames\":%d,\"pages\":[",
+                width, height, frames));
+        for (int i = 0; i < PAGES.length; i++) {
+            String statistics = run(PAGES[i], frames, width, height);
+            double count = number(statistics, "frameCount");
+            if (i > 0) {
+                json.append(',');
+            }
+            json.append(String.format(Locale.ROOT,
+                    "{\"name\":\"%s\",\"frames\":%.0f,\"layoutMillis\":%.3f,\"paintMillis\":%.3f,"
+                    + "\"maxPaintMillis\":%.3f,\"queueBytes\":%.0f,\"javaCalls\":%.0f,\"area\":%.0f}",
+                    PAGES[i], count,
+                    number(statistics, "totalLayoutMillis") / count,
+                    number(statistics, "totalPaintMillis") / count,
+                    number(statistics, "maxPaintMillis"),
+                    number(statistics, "totalQueueBytes") / count,
+                    number(statistics, "totalJavaCalls") / count,
+                    number(statistics, "totalArea") / count));
+        }
+        json.append("]}");
+
+        System.out.println(json);
+        if (output != null) {
+            Files.writeString(Path.of(output), json + "\n");
+        }
+        Platform.exit();
+    }
+
+    private static String run(String name, int frames, int width, int height)
+            throws InterruptedException {
+        CountDownLatch done = new CountDownLatch(1);
+        String[] statistics = new String[1];
+        Stage[] stage = new Stage[1];
+        Platform.runLater(() -> {
+            WebView view = new WebView();
+            WebEngine engine = view.getEngine();
+            WebPage page = Accessor.getPageFor(engine);
+            engine.setOnAlert(event -> {
+                if ("loaded".equals(event.getData())) {
+                    // Not from within the alert, which blocks the script.
+                    Platform.runLater(() -> {
+                        page.resetPaintStatistics();
+                        engine.executeScript("start(" + frames + ")");
+                    });
+                } else {
+                    statistics[0] = page.getPaintStatistics();
+                    done.countDown();
+                }
+            });
+            engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+                if (n == Worker.State.FAILED) {
+                    done.countDown();
+                }
+            });
+            stage[0] = new Stage();
+            stage[0].setScene(new Scene(view, width, height));
+            stage[0].show();
+            engine.loadContent(page(name));
+        });
+        if (!done.await(5, TimeUnit.MINUTES)) {
+            throw new AssertionError("Timed out running " + name);
+        }
+        Platform.runLater(() -> stage[0].close());
+        if (statistics[0] == null) {
+            throw new AssertionError("Failed to load " + name);
+        }
+        return statistics[0];
+    }
+
+    /*
+     * Every frame shifts the whole body by a pixel, which relayouts and
+     * repaints everything, and then gives the page a chance to change
+     * itself. The page reports back once the last frame has been painted,
+     * which is the case when the following animation frame runs.
+     */
+    private static String page(String name) {
+        return "<!DOCTYPE html><html><head><style>\n"
+            + "body { margin: 0; font: 14px sans-serif; }\n"
+            + "td { border: 1px solid #888; padding: 2px 6px; }\n"
+            + ".box { display: inline-block; width: 40px; height: 40px; margin: 8px;"
+            + " background: linear-gradient(#48c, #c84); border-radius: 6px; }\n"
+            + "</style></head><body>\n"
+            + content(name)
+            + "<script>\n"
+            + "var frame = 0, frames = 0;\n"
+            + "var update = " + update(name) + ";\n"
+            + "function step() {\n"
+            + "  if (frame == frames) { alert('done'); return; }\n"
+            + "  document.body.style.paddingTop = (frame & 1) + 'px';\n"
+            + "  update(frame);\n"
+            + "  frame++;\n"
+            + "  requestAnimationFrame(step);\n"
+            + "}\n"
+            + "function start(n) { frames = n; requestAnimationFrame(step); }\n"
+            + "window.onload = function() {\n"
+            + "  requestAnimationFrame(function() { requestAnimationFrame(function() { alert('loaded'); }); });\n"
+            + "};\n"
+            + "</script></body></html>";
+    }
+
+    private static String content(String name) {
+        StringBuilder html = new StringBuilder();
+        switch (name) {
+            case "text" -> {
+                for (int i = 0; i < 200; i++) {
+                    html.append("<p>");
+                    for (int j = 0; j < 60; j++) {
+                        html.append(WORDS[(i * 7 + j * 13) % WORDS.length]).append(' ');
+                    }
+                    html.append("</p>\n");
+                }
+            }
+            case "table" -> {
+                html.append("<table>\n");
+                for (int i = 0; i < 200; i++) {
+                    html.append("<tr>");
+                    for (int j = 0; j < 8; j++) {
+                        html.append("<td>").append(WORDS[(i + j) % WORDS.length])
+                            .append(' ').append(i * 8 + j).append("</td>");
+                    }
+                    html.append("</tr>\n");
+                }
+                html.append("</table>\n");
+            }
+            case "svg" -> {
+                html.append("<svg width=1000 height=2000>\n");
+                for (int i = 0; i < 500; i++) {
+                    int x = (i * 97) % 960, y = (i * 61) % 1960;
+                    switch (i % 3) {
+                        case 0 -> html.append("<circle cx=").append(x + 20).append(" cy=").append(y + 20)
+                            .append(" r=18 fill='hsl(").append(i % 360).append(",60%,50%)' stroke=black/>\n");
+                        case 1 -> html.append("<path d='M").append(x).append(' ').append(y)
+                            .append(" q20 -30 40 0 t40 0' fill=none stroke='#369' stroke-width=3/>\n");
+                        default -> html.append("<text x=").append(x).append(" y=").append(y + 20)
+                            .append(">").append(WORDS[i % WORDS.length]).append("</text>\n");
+                    }
+                }
+                html.append("</svg>\n");
+            }
+            case "transforms" -> {
+                for (int i = 0; i < 300; i++) {
+                    html.append("<div class=box style='transform: rotate(").append((i * 17) % 360)
+                        .append("deg) scale(").append(0.6 + (i % 5) * 0.1)
+                        .append(") skewX(").append((i % 7) * 3).append("deg)'></div>\n");
+                }
+            }
+            case "canvas" -> html.append("<canvas id=c width=1000 height=700></canvas>\n");
+            case "images" -> {
+                for (int i = 0; i < 400; i++) {
+                    html.append("<img width=40 height=40 src=\"data:image/svg+xml,")
+                        .append("%3Csvg xmlns='http://www.w3.org/2000/svg' width='40' height='40'%3E")
+                        .append("%3Crect width='40' height='40' fill='%23").append(COLORS[i % COLORS.length])
+                        .append("'/%3E%3Ccircle cx='20' cy='20' r='12' fill='white'/%3E%3C/svg%3E\">\n");
+                }
+            }
+            default -> throw new IllegalArgumentException(name);
+        }
+        return html.toString();
+    }
+
+    private static String update(String name) {
+        if (!"canvas".equals(name)) {
+            return "function(frame) {}";
+        }
+        return "function(frame) {\n"
+            + "  var g = document.getElementById('c').getContext('2d');\n"
+            + "  g.fillStyle = '#fff'; g.fillRect(0, 0, 1000, 700);\n"
+            + "  for (var i = 0; i < 300; i++) {\n"
+            + "    var x = (i * 97 + frame * 5) % 960, y = (i * 61) % 660;\n"
+            + "    g.fillStyle = 'hsl(' + (i % 360) + ',60%,50%)';\n"
+            + "    g.beginPath(); g.arc(x + 20, y + 20, 18, 0, 2 * Math.PI); g.fill();\n"
+            + "    g.strokeRect(x, y, 40, 40);\n"
+            + "    g.fillText('item ' + i, x, y + 50);\n"
+            + "  }\n"
+            + "}";
+    }
+
+    private static final String[] WORDS = {
+        "lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing",
+        "elit", "sed", "do", "eiusmod", "tempor", "incididunt", "ut", "labore",
+        "et", "dolore", "magna", "aliqua", "enim", "ad", "minim", "veniam"
+    };
+
+    private static final String[] COLORS = { "c33", "3a3", "33c", "c93", "939", "399" };
+}
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package benchmark;
+
+import static benchmark.BenchmarkSupport.number;
+import static benchmark.BenchmarkSupport.runChild;
+import static benchmark.BenchmarkSupport.status;
+import static benchmark.BenchmarkSupport.submit;
+
+import com.sun.webkit.SharedResourceCache;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Locale;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+import test.javafx.scene.web.TestHttpServer;
+import test.javafx.scene.web.TestHttpServer.Response;
+
+/**
+ * Measures the memory and load time of many pages in one process that use
+ * the same large stylesheet and script, with and without the shared
+ * resource cache.
+ * <p>
+ * A local HTTP server serves a page with a stylesheet of
+ * {@code -Dbenchmark.rules} (default 5000) rules and a script of
+ * {@code -Dbenchmark.functions} (default 5000) functions, all with
+ * {@code Cache-Control: no-store}, so that the memory cache loads them
+ * again for every page, as it does for servers that send no validators.
+ * {@code -Dbenchmark.pages} (default 20) engines load the page one after
+ * another and are all kept open. The benchmark starts itself once with
+ * the default cache capacity and once with the cache disabled, in separate
+ * processes, and reports for each the load time of the first page and the
+ * average of the others, the resident memory added per page and the size
+ * and hits of the cache. It also reports the ratios of the shared to the
+ * unshared run. The results are printed as JSON and, if
+ * {@code -Dbenchmark.output} is set, also written to that file for trend
+ * tracking. The resident memory is read from {@code /proc/self/status}, so
+ * it is only reported on Linux.
+ * <p>
+ * It uses the internal {@code com.sun.webkit.SharedResourceCache} class,
+ * so it needs {@code --add-exports javafx.web/com.sun.webkit=ALL-UNNAMED}.
+ * The server is {@code test.javafx.scene.web.TestHttpServer}, so the
+ * javafx.web test classes must be on the class path. It runs headless with {@code -Dglass.platform=Monocle
+ * -Dmonocle.platform=Headless -Dprism.order=sw}.
+ */
+public class SharedResourceBenchmark {
+
+    public static void main(String[] args) throws Exception {
+        if (Boolean.getBoolean("benchmark.child")) {
+            runPages();
+            return;
+        }
+
+        int pages = Integer.getInteger("benchmark.pages", 20);
+        String output = System.getProperty("benchmark.output");
+        // Each mode runs in a new JVM, so that neither sees the memory or
+        // the code cache of the other.
+        String shared = runChild(SharedResourceBenchmark.class, "benchmark.mode=shared");
+        String unshared = runChild(SharedResourceBenchmark.class, "benchmark.mode=unshared",
+                "com.sun.webkit.sharedResourceCacheSize=0");
+
+        String json = String.format(Locale.ROOT,
+                "{\"benchmark\":\"SharedResourceBenchmark\",\"pages\":%d,\"configurations\":[%s,%s],"
+                + "\"sharedRelativeToUnshared\":{\"loadTime\":%.2f,\"memoryPerPage\":%.2f}}",
+                pages, shared, unshared,
+                number(shared, "otherPagesMillis") / number(unshared, "otherPagesMillis"),
+                number(shared, "rssPerPageMB") / number(unshared, "rssPerPageMB"));
+        System.out.println(json);
+        if (output != null) {
+            Files.writeString(Path.of(output), json + "\n");
+        }
+    }
+
+    private static void runPages() throws Exception {
+        int pages = Integer.getInteger("benchmark.pages", 20);
+        byte[] style = style(Integer.getInteger("benchmark.rules", 5000));
+        byte[] script = script(Integer.getInteger("benchmark.functions", 5000));
+
+        TestHttpServer server = new TestHttpServer(request -> {
+            String path = request.getPath();
+            Response response = path.endsWith(".css") ? Response.ok("text/css", style)
+                    : path.endsWith(".js") ? Response.ok("text/javascript", script)
+                    : Response.ok("text/html", PAGE);
+            return response.header("Cache-Control", "no-store");
+        });
+        String url = server.url("/index.html");
+
+        CountDownLatch startup = new CountDownLatch(1);
+        Platform.startup(startup::countDown);
+        startup.await();
+
+        // Start one engine and close it, so that the start-up cost and
+        // memory of the engine itself are not counted for the first page.
+        List<WebEngine> engines = new ArrayList<>();
+        load("about:blank", engines);
+        submit(() -> {
+            engines.get(0).load(null);
+            engines.clear();
+            return null;
+        });
+        System.gc();
+
+        long rssBefore = status("VmRSS:");
+        double first = 0;
+        double others = 0;
+        for (int i = 0; i < pages; i++) {
+            double elapsed = load(url, engines);
+            if (i == 0) {
+                first = elapsed;
+            } else {
+                others += elapsed;
+            }
+        }
+        System.gc();
+        long rssAfter = status("VmRSS:");
+
+        long[] cache = submit(() -> new long[] {
+            SharedResourceCache.getStyleSheetSize(),
+            SharedResourceCache.getScriptSize(),
+            SharedResourceCache.getHitCount()
+        });
+        System.out.println(String.format(Locale.ROOT,
+                "{\"name\":\"%s\",\"styleBytes\":%d,\"scriptBytes\":%d,\"firstPageMillis\":%.2f,"
+                + "\"otherPagesMillis\":%.2f,\"rssPerPageMB\":%.2f,\"cacheStyleSheetBytes\":%d,"
+                + "\"cacheScriptBytes\":%d,\"cacheHits\":%d}",
+                System.getProperty("benchmark.mode"), style.length, script.length, first,
+                pages > 1 ? others / (pages - 1) : 0.0,
+                rssBefore < 0 || rssAfter < 0 ? -1.0 : (rssAfter - rssBefore) / 1024.0 / pages,
+                cache[0], cache[1], cache[2]));
+        server.close();
+        Platform.exit();
+    }
+
+    /**
+     * Loads the URL in a new engine, which is kept in the list, and
+     * returns the time to the end of the load, in milliseconds.
+     */
+    private static double load(String url, List<WebEngine> engines) throws InterruptedException {
+        CountDownLatch done = new CountDownLatch(1);
+        long[] elapsed = new long[1];
+        Platform.runLater(() -> {
+            WebEngine engine = new WebEngine();
+            engines.add(engine);
+            long start = System.nanoTime();
+            engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+                if (n == Worker.State.SUCCEEDED || n == Worker.State.FAILED) {
+                    // Include the style resolution and layout of the page.
+                    engine.executeScript("document.body.offsetHeight");
+                    elapsed[0] = System.nanoTime() - start;
+                    done.countDown();
+                }
+            });
+            engine.load(url);
+        });
+        if (!done.await(5, TimeUnit.MINUTES)) {
+            throw new AssertionError("Timed out loading " + url);
+        }
+        return elapsed[0] / 1e6;
+    }
+
+    private static byte[] style(int rules) {
+        StringBuilder css = new StringBuilder();
+        for (int i = 0; i < rules; i++) {
+            css.append(String.format(Locale.ROOT,
+                    ".w%d .c%d > span, #item%d:hover { color: #%06x; margin: %dpx %dpx; padding: 0 %dem; }\n",
+                    i % 97, i, i, i * 2654435 & 0xffffff, i % 7, i % 5, i % 3));
+        }
+        return css.toString().getBytes(StandardCharsets.ISO_8859_1);
+    }
+
+    /*
+     * Only a few of the functions run while the page loads, like in an
+     * application bundle; the rest are parsed and kept.
+     */
+    private static byte[] script(int functions) {
+        StringBuilder js = new StringBuilder("var app = {};\n");
+        for (int i = 0; i < functions; i++) {
+            js.append(String.format(Locale.ROOT,
+                    "app.f%d = function(items, k) { var s = 0; for (var i = 0; i < items.length; i++) "
+                    + "{ s += items[i].value * %d + k; } return { id: 'f%d', total: s }; };\n",
+                    i, i % 13 + 1, i));
+        }
+        js.append("var items = [];\n")
+          .append("for (var i = 0; i < 100; i++) { items.push({ value: i }); }\n")
+          .append("for (var i = 0; i < ").append(functions).append("; i += 50) { app['f' + i](items, i); }\n");
+        return js.toString().getBytes(StandardCharsets.ISO_8859_1);
+    }
+
+    private static final String PAGE = """
+        <!DOCTYPE html>
+        <html><head>
+        <link rel="stylesheet" href="style.css">
+        <script src="app.js"></script>
+        </head><body>
+        <div class="w1"><p class="c1"><span>one</span></p><p id="item2">two</p></div>
+        </body></html>
+        """;
+}
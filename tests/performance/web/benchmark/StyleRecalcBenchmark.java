@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package benchmark;
+
+import static benchmark.BenchmarkSupport.number;
+import static benchmark.BenchmarkSupport.runChild;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Locale;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+
+/**
+ * Measures style resolution on a large data grid with a heavy stylesheet.
+ * <p>
+ * The page builds a grid of {@code -Dbenchmark.rows} (default 5000) rows
+ * of {@code -Dbenchmark.columns} (default 10) cells, styled by
+ * {@code -Dbenchmark.rules} (default 2000) generated rules with
+ * descendant, child, sibling, attribute, {@code :nth-child} and
+ * {@code :not} selectors, as grid themes use. It times, as the median of
+ * {@code -Dbenchmark.iterations} (default 10) runs,
+ * <ul>
+ * <li>"initial": resolving the style of a freshly inserted grid,</li>
+ * <li>"theme": restyling the whole grid after a class change on the
+ *     root element,</li>
+ * <li>"selection": restyling after selecting every tenth row,</li>
+ * <li>"query": running a set of {@code querySelectorAll} queries.</li>
+ * </ul>
+ * Style resolution is forced with {@code getComputedStyle}, which does
+ * not lay out, so the times are those of selector matching and style
+ * building.
+ * <p>
+ * The benchmark starts itself once with the JIT and once with
+ * {@code -Dcom.sun.webkit.useJIT=false}, in separate processes. There is
+ * no switch for the selector JIT alone: without the JIT, selectors are
+ * matched by the interpreting selector checker, but the page's script is
+ * interpreted as well. The timed phases run little script besides the
+ * DOM calls, but the reported "jitSpeedup" is that of turning the whole
+ * JIT on, not of the selector JIT by itself. Both runs and the speedup
+ * are printed as JSON and, if {@code -Dbenchmark.output} is set, also
+ * written to that file for trend tracking.
+ * <p>
+ * It runs headless with {@code -Dglass.platform=Monocle
+ * -Dmonocle.platform=Headless -Dprism.order=sw}.
+ */
+public class StyleRecalcBenchmark {
+
+    private static final String[] PHASES = { "initial", "theme", "selection", "query" };
+
+    public static void main(String[] args) throws Exception {
+        if (Boolean.getBoolean("benchmark.child")) {
+            runPhases();
+            return;
+        }
+
+        String output = System.getProperty("benchmark.output");
+        // The JIT can only be turned off for the whole process.
+        String jit = runChild(StyleRecalcBenchmark.class, "com.sun.webkit.useJIT=true");
+        String noJIT = runChild(StyleRecalcBenchmark.class, "com.sun.webkit.useJIT=false");
+
+        StringBuilder json = new StringBuilder();
+        json.append(String.format(Locale.ROOT,
+                "{\"benchmark\":\"StyleRecalcBenchmark\",\"rows\":%d,\"columns\":%d,\"rules\":%d,"
+                + "\"configurations\":[%s,%s],\"jitSpeedup\":{",
+                Integer.getInteger("benchmark.rows", 5000),
+                Integer.getInteger("benchmark.columns", 10),
+                Integer.getInteger("benchmark.rules", 2000),
+                jit, noJIT));
+        for (int i = 0; i < PHASES.length; i++) {
+            if (i > 0) {
+                json.append(',');
+            }
+            json.append(String.format(Locale.ROOT, "\"%s\":%.2f", PHASES[i],
+                    number(noJIT, PHASES[i] + "Millis") / number(jit, PHASES[i] + "Millis")));
+        }
+        json.append("}}");
+
+        System.out.println(json);
+        if (output != null) {
+            Files.writeString(Path.of(output), json + "\n");
+        }
+    }
+
+    private static void runPhases() throws Exception {
+        CountDownLatch startup = new CountDownLatch(1);
+        Platform.startup(startup::countDown);
+        startup.await();
+
+        CountDownLatch done = new CountDownLatch(1);
+        String[] result = new String[1];
+        Platform.runLater(() -> {
+            WebEngine engine = new WebEngine();
+            engine.setOnAlert(event -> {
+                result[0] = event.getData();
+                done.countDown();
+            });
+            engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+                if (n == Worker.State.FAILED) {
+                    done.countDown();
+                }
+            });
+            engine.loadContent(page());
+        });
+        if (!done.await(10, TimeUnit.MINUTES)) {
+            throw new AssertionError("Timed out");
+        }
+        if (result[0] == null || result[0].startsWith("error")) {
+            throw new AssertionError("Failed: " + result[0]);
+        }
+
+        System.out.println(String.format(Locale.ROOT, "{\"useJIT\":%s,%s",
+                System.getProperty("com.sun.webkit.useJIT", "true"), result[0].substring(1)));
+        Platform.exit();
+    }
+
+    private static String page() {
+        return "<!DOCTYPE html><html><head><style id='theme'></style></head><body><script>\n"
+            + "var rows = " + Integer.getInteger("benchmark.rows", 5000) + ";\n"
+            + "var columns = " + Integer.getInteger("benchmark.columns", 10) + ";\n"
+            + "var rules = " + Integer.getInteger("benchmark.rules", 2000) + ";\n"
+            + "var iterations = " + Integer.getInteger("benchmark.iterations", 10) + ";\n"
+            + PAGE_SOURCE
+            + "</script></body></html>";
+    }
+
+    private static final String PAGE_SOURCE = """
+        function stylesheet() {
+            var css = [];
+            for (var i = 0; i < rules; i++) {
+                var c = i % columns, color = '#' + ('00000' + (i * 2654435761 % 16777216).toString(16)).slice(-6);
+                switch (i % 5) {
+                case 0:
+                    css.push('.grid .row[data-state="s' + (i % 7) + '"] .cell:nth-child(' + (c + 1) + ') { color: ' + color + '; }');
+                    break;
+                case 1:
+                    css.push('.theme-dark .grid .row:not(.selected) > .cell.c' + c + ' span.v' + (i % 50) + ' { background-color: ' + color + '; }');
+                    break;
+                case 2:
+                    css.push('.grid .row:nth-child(' + (2 + i % 5) + 'n+' + (i % 3) + ') .cell[data-col="c' + c + '"] { padding-left: ' + (i % 9) + 'px; }');
+                    break;
+                case 3:
+                    css.push('html:not(.theme-dark) .grid .row.selected .cell.c' + c + ' ~ .cell { border-left-color: ' + color + '; }');
+                    break;
+                default:
+                    css.push('.grid > .row > .cell[data-col^="c' + c + '"]:not(:first-child) > span[class$="' + (i % 10) + '"] { outline-color: ' + color + '; }');
+                }
+            }
+            return css.join('\\n');
+        }
+
+        function grid() {
+            var html = ['<div class="grid">'];
+            for (var r = 0; r < rows; r++) {
+                html.push('<div class="row" data-state="s' + (r % 7) + '">');
+                for (var c = 0; c < columns; c++) {
+                    html.push('<div class="cell c' + c + '" data-col="c' + c + '"><span class="v' + ((r + c) % 50) + '">' + r + ':' + c + '</span></div>');
+                }
+                html.push('</div>');
+            }
+            html.push('</div>');
+            return html.join('');
+        }
+
+        // Resolves the style of the document without laying it out
+        function resolveStyle() {
+            var grid = document.querySelector('.grid');
+            return getComputedStyle(grid ? grid.lastElementChild.lastElementChild : document.body).color;
+        }
+
+        function time(f) {
+            var start = performance.now();
+            f();
+            resolveStyle();
+            return performance.now() - start;
+        }
+
+        function median(times) {
+            times.sort(function(a, b) { return a - b; });
+            return times[times.length >> 1];
+        }
+
+        var QUERIES = [
+            '.grid .row.selected .cell',
+            '.row:nth-child(3n+1) > .cell.c2 span',
+            '.row[data-state="s3"] .cell:not(:first-child)',
+            '.cell[data-col^="c1"] ~ .cell span[class$="7"]',
+            '.row:not(.selected) > .cell:last-child'
+        ];
+
+        try {
+            document.getElementById('theme').textContent = stylesheet();
+            var markup = grid();
+            var times = { initial: [], theme: [], selection: [], query: [] };
+            var matches = 0;
+            for (var i = 0; i < iterations; i++) {
+                var old = document.querySelector('.grid');
+                if (old) {
+                    old.remove();
+                    resolveStyle();
+                }
+                times.initial.push(time(function() {
+                    document.body.insertAdjacentHTML('beforeend', markup);
+                }));
+                times.theme.push(time(function() {
+                    document.documentElement.classList.toggle('theme-dark');
+                }));
+                var rowList = document.querySelectorAll('.grid > .row');
+                times.selection.push(time(function() {
+                    for (var r = i % 10; r < rowList.length; r += 10) {
+                        rowList[r].classList.add('selected');
+                    }
+                }));
+                times.query.push(time(function() {
+                    for (var q = 0; q < QUERIES.length; q++) {
+                        matches += document.querySelectorAll(QUERIES[q]).length;
+                    }
+                }));
+            }
+            alert(JSON.stringify({
+                initialMillis: median(times.initial),
+                themeMillis: median(times.theme),
+                selectionMillis: median(times.selection),
+                queryMillis: median(times.query),
+                matches: matches
+            }));
+        } catch (e) {
+            alert('error: ' + e);
+        }
+        """;
+}
@@ -0,0 +1,411 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package benchmark;
+
+import java.io.ByteArrayOutputStream;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+import test.javafx.scene.web.TestHttpServer;
+import test.javafx.scene.web.TestHttpServer.Response;
+
+/**
+ * Compares a WebAssembly module with the equivalent JavaScript.
+ * <p>
+ * A local HTTP server serves a generated module with
+ * {@code -Dbenchmark.functions} (default 5000) small functions, to give
+ * the compilers a realistic amount of code, and a Mandelbrot kernel
+ * rendering a {@code -Dbenchmark.width} by {@code -Dbenchmark.height}
+ * (default 400 by 300) image with up to 256 iterations per pixel. It also
+ * serves the same code as a JavaScript file. The page measures
+ * <ul>
+ * <li>the compilation of the module from an array buffer
+ *     ({@code WebAssembly.compile}),</li>
+ * <li>the streaming compilation of the module while it is loaded
+ *     ({@code WebAssembly.compileStreaming}, which needs the
+ *     {@code application/wasm} type),</li>
+ * <li>the instantiation, and the first and steady-state runs of the
+ *     kernel,</li>
+ * <li>the evaluation of the JavaScript fallback and its first and
+ *     steady-state runs,</li>
+ * </ul>
+ * and the results are printed as JSON and, if {@code -Dbenchmark.output}
+ * is set, also written to that file for trend tracking. The steady state
+ * is the median of {@code -Dbenchmark.iterations} (default 20) runs.
+ * <p>
+ * WebAssembly is only built on Linux x86_64. The server is
+ * {@code test.javafx.scene.web.TestHttpServer}, so the javafx.web test
+ * classes must be on the class path. It runs headless with
+ * {@code -Dglass.platform=Monocle -Dmonocle.platform=Headless
+ * -Dprism.order=sw}.
+ */
+public class WasmBenchmark {
+
+    private static final int MAX_ITERATIONS = 256;
+
+    private static byte[] module;
+    private static byte[] fallback;
+
+    public static void main(String[] args) throws Exception {
+        int functions = Integer.getInteger("benchmark.functions", 5000);
+        int width = Integer.getInteger("benchmark.width", 400);
+        int height = Integer.getInteger("benchmark.height", 300);
+        int iterations = Integer.getInteger("benchmark.iterations", 20);
+        String output = System.getProperty("benchmark.output");
+
+        module = module(functions);
+        fallback = fallback(functions).getBytes(StandardCharsets.ISO_8859_1);
+
+        TestHttpServer server = new TestHttpServer(WasmBenchmark::handle);
+
+        CountDownLatch startup = new CountDownLatch(1);
+        Platform.startup(startup::countDown);
+        startup.await();
+
+        CountDownLatch done = new CountDownLatch(1);
+        String[] result = new String[1];
+        String url = server.url("/index.html?")
+                + width + "&" + height + "&" + iterations;
+        Platform.runLater(() -> {
+            WebEngine engine = new WebEngine();
+            engine.setOnAlert(event -> {
+                result[0] = event.getData();
+                done.countDown();
+            });
+            engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+                if (n == Worker.State.FAILED) {
+                    done.countDown();
+                }
+            });
+            engine.load(url);
+        });
+        if (!done.await(10, TimeUnit.MINUTES)) {
+            throw new AssertionError("Timed out");
+        }
+        server.close();
+        if (result[0] == null || result[0].startsWith("error")) {
+            throw new AssertionError("Failed: " + result[0]);
+        }
+
+        String json = "{\"benchmark\":\"WasmBenchmark\",\"functions\":" + functions
+                + ",\"moduleBytes\":" + module.length
+                + ",\"fallbackBytes\":" + fallback.length
+                + "," + result[0].substring(1);
+        System.out.println(json);
+        if (output != null) {
+            Files.writeString(Path.of(output), json + "\n");
+        }
+        Platform.exit();
+    }
+
+    private static Response handle(TestHttpServer.Request request) {
+        String path = request.getPath();
+        Response response;
+        if (path.startsWith("/module.wasm")) {
+            response = Response.ok("application/wasm", module);
+        } else if (path.startsWith("/fallback.js")) {
+            response = Response.ok("text/javascript", fallback);
+        } else {
+            response = Response.ok("text/html", PAGE);
+        }
+        return response.header("Cache-Control", "no-store");
+    }
+
+    /*
+     * Each step awaits the previous one, so that the timings do not
+     * overlap. The checksums of both kernels must agree.
+     */
+    private static final String PAGE = """
+        <!DOCTYPE html><html><body><script>
+        var args = location.search.substring(1).split('&').map(Number);
+        var width = args[0], height = args[1], iterations = args[2];
+
+        function time(f) {
+            var start = performance.now();
+            var value = f();
+            return { millis: performance.now() - start, value: value };
+        }
+
+        async function timeAsync(f) {
+            var start = performance.now();
+            var value = await f();
+            return { millis: performance.now() - start, value: value };
+        }
+
+        function runs(kernel) {
+            var first = time(function() { return kernel(width, height, %d); });
+            var times = [];
+            for (var i = 0; i < iterations; i++) {
+                times.push(time(function() { return kernel(width, height, %d); }).millis);
+            }
+            times.sort(function(a, b) { return a - b; });
+            return { first: first.millis, steady: times[times.length >> 1], checksum: first.value };
+        }
+
+        async function run() {
+            var bytes = await (await fetch('module.wasm')).arrayBuffer();
+            var compile = await timeAsync(function() { return WebAssembly.compile(bytes); });
+            var streaming = await timeAsync(function() {
+                return WebAssembly.compileStreaming(fetch('module.wasm'));
+            });
+            var instantiate = await timeAsync(function() {
+                return WebAssembly.instantiate(streaming.value);
+            });
+            var wasm = runs(instantiate.value.exports.mandel);
+
+            var source = await (await fetch('fallback.js')).text();
+            var evaluate = time(function() { return (0, eval)(source); });
+            var js = runs(mandel);
+
+            if (wasm.checksum !== js.checksum) {
+                throw 'checksums differ: ' + wasm.checksum + ' != ' + js.checksum;
+            }
+            alert(JSON.stringify({
+                wasm: {
+                    compileMillis: compile.millis,
+                    compileStreamingMillis: streaming.millis,
+                    instantiateMillis: instantiate.millis,
+                    firstRunMillis: wasm.first,
+                    steadyRunMillis: wasm.steady
+                },
+                js: {
+                    evalMillis: evaluate.millis,
+                    firstRunMillis: js.first,
+                    steadyRunMillis: js.steady
+                },
+                speedup: js.steady / wasm.steady
+            }));
+        }
+
+        run().catch(function(e) { alert('error: ' + e); });
+        </script></body></html>
+        """.formatted(MAX_ITERATIONS, MAX_ITERATIONS);
+
+    private static String fallback(int functions) {
+        StringBuilder js = new StringBuilder();
+        for (int k = 0; k < functions; k++) {
+            js.append("function f").append(k).append("(a, b) { return (Math.imul(a, ")
+                    .append(k).append(") + b) | 0; }\n");
+        }
+        js.append("""
+            function mandel(w, h, max) {
+                var total = 0;
+                for (var y = 0; y < h; y++) {
+                    for (var x = 0; x < w; x++) {
+                        var cr = x * 3 / w - 2, ci = y * 2 / h - 1;
+                        var zr = 0, zi = 0, i = 0;
+                        for (; i < max; i++) {
+                            if (zr * zr + zi * zi > 4) {
+                                break;
+                            }
+                            var t = zr * zr - zi * zi + cr;
+                            zi = 2 * zr * zi + ci;
+                            zr = t;
+                        }
+                        total = (total + i) | 0;
+                    }
+                }
+                return total;
+            }
+            """);
+        return js.toString();
+    }
+
+    // WebAssembly binary encoding
+
+    private static final int I32 = 0x7f;
+    private static final int F64 = 0x7c;
+    private static final int VOID = 0x40;
+    private static final int BLOCK = 0x02;
+    private static final int LOOP = 0x03;
+    private static final int END = 0x0b;
+    private static final int BR = 0x0c;
+    private static final int BR_IF = 0x0d;
+    private static final int LOCAL_GET = 0x20;
+    private static final int LOCAL_SET = 0x21;
+    private static final int I32_CONST = 0x41;
+    private static final int F64_CONST = 0x44;
+    private static final int I32_GE_S = 0x4e;
+    private static final int F64_GT = 0x64;
+    private static final int I32_ADD = 0x6a;
+    private static final int I32_MUL = 0x6c;
+    private static final int F64_ADD = 0xa0;
+    private static final int F64_SUB = 0xa1;
+    private static final int F64_MUL = 0xa2;
+    private static final int F64_DIV = 0xa3;
+    private static final int F64_CONVERT_I32_S = 0xb7;
+
+    /**
+     * Builds a module exporting {@code mandel(w, h, max)} and {@code f0},
+     * with {@code functions} functions {@code fk(a, b) = a * k + b}.
+     */
+    private static byte[] module(int functions) {
+        ByteArrayOutputStream out = new ByteArrayOutputStream();
+        out.writeBytes(new byte[] { 0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00 });
+
+        ByteArrayOutputStream types = new ByteArrayOutputStream();
+        ops(types, 2, 0x60, 2, I32, I32, 1, I32, 0x60, 3, I32, I32, I32, 1, I32);
+        section(out, 1, types);
+
+        ByteArrayOutputStream declarations = new ByteArrayOutputStream();
+        uleb(declarations, functions + 1);
+        for (int k = 0; k < functions; k++) {
+            declarations.write(0);
+        }
+        declarations.write(1);
+        section(out, 3, declarations);
+
+        ByteArrayOutputStream exports = new ByteArrayOutputStream();
+        uleb(exports, 2);
+        name(exports, "mandel");
+        exports.write(0);
+        uleb(exports, functions);
+        name(exports, "f0");
+        ops(exports, 0, 0);
+        section(out, 7, exports);
+
+        ByteArrayOutputStream code = new ByteArrayOutputStream();
+        uleb(code, functions + 1);
+        for (int k = 0; k < functions; k++) {
+            ByteArrayOutputStream body = new ByteArrayOutputStream();
+            ops(body, 0, LOCAL_GET, 0, I32_CONST);
+            sleb(body, k);
+            ops(body, I32_MUL, LOCAL_GET, 1, I32_ADD, END);
+            uleb(code, body.size());
+            code.writeBytes(body.toByteArray());
+        }
+        ByteArrayOutputStream body = mandel();
+        uleb(code, body.size());
+        code.writeBytes(body.toByteArray());
+        section(out, 10, code);
+
+        return out.toByteArray();
+    }
+
+    /*
+     * Parameters: w = 0, h = 1, max = 2.
+     * Locals: x = 3, y = 4, i = 5, total = 6, cr = 7, ci = 8, zr = 9,
+     * zi = 10, t = 11.
+     */
+    private static ByteArrayOutputStream mandel() {
+        ByteArrayOutputStream c = new ByteArrayOutputStream();
+        ops(c, 2, 4, I32, 5, F64);
+        // for (y = 0; y < h; y++)
+        ops(c, BLOCK, VOID, LOOP, VOID, LOCAL_GET, 4, LOCAL_GET, 1, I32_GE_S, BR_IF, 1,
+                I32_CONST, 0, LOCAL_SET, 3);
+        // for (x = 0; x < w; x++)
+        ops(c, BLOCK, VOID, LOOP, VOID, LOCAL_GET, 3, LOCAL_GET, 0, I32_GE_S, BR_IF, 1);
+        // cr = x * 3 / w - 2
+        ops(c, LOCAL_GET, 3, F64_CONVERT_I32_S, F64_CONST);
+        f64(c, 3);
+        ops(c, F64_MUL, LOCAL_GET, 0, F64_CONVERT_I32_S, F64_DIV, F64_CONST);
+        f64(c, 2);
+        ops(c, F64_SUB, LOCAL_SET, 7);
+        // ci = y * 2 / h - 1
+        ops(c, LOCAL_GET, 4, F64_CONVERT_I32_S, F64_CONST);
+        f64(c, 2);
+        ops(c, F64_MUL, LOCAL_GET, 1, F64_CONVERT_I32_S, F64_DIV, F64_CONST);
+        f64(c, 1);
+        ops(c, F64_SUB, LOCAL_SET, 8);
+        // zr = zi = 0, i = 0
+        ops(c, F64_CONST);
+        f64(c, 0);
+        ops(c, LOCAL_SET, 9, F64_CONST);
+        f64(c, 0);
+        ops(c, LOCAL_SET, 10, I32_CONST, 0, LOCAL_SET, 5);
+        // for (; i < max && zr * zr + zi * zi <= 4; i++)
+        ops(c, BLOCK, VOID, LOOP, VOID, LOCAL_GET, 5, LOCAL_GET, 2, I32_GE_S, BR_IF, 1);
+        ops(c, LOCAL_GET, 9, LOCAL_GET, 9, F64_MUL, LOCAL_GET, 10, LOCAL_GET, 10, F64_MUL,
+                F64_ADD, F64_CONST);
+        f64(c, 4);
+        ops(c, F64_GT, BR_IF, 1);
+        // t = zr * zr - zi * zi + cr
+        ops(c, LOCAL_GET, 9, LOCAL_GET, 9, F64_MUL, LOCAL_GET, 10, LOCAL_GET, 10, F64_MUL,
+                F64_SUB, LOCAL_GET, 7, F64_ADD, LOCAL_SET, 11);
+        // zi = 2 * zr * zi + ci
+        ops(c, F64_CONST);
+        f64(c, 2);
+        ops(c, LOCAL_GET, 9, F64_MUL, LOCAL_GET, 10, F64_MUL, LOCAL_GET, 8, F64_ADD, LOCAL_SET, 10);
+        // zr = t
+        ops(c, LOCAL_GET, 11, LOCAL_SET, 9);
+        ops(c, LOCAL_GET, 5, I32_CONST, 1, I32_ADD, LOCAL_SET, 5, BR, 0, END, END);
+        // total += i
+        ops(c, LOCAL_GET, 6, LOCAL_GET, 5, I32_ADD, LOCAL_SET, 6);
+        ops(c, LOCAL_GET, 3, I32_CONST, 1, I32_ADD, LOCAL_SET, 3, BR, 0, END, END);
+        ops(c, LOCAL_GET, 4, I32_CONST, 1, I32_ADD, LOCAL_SET, 4, BR, 0, END, END);
+        ops(c, LOCAL_GET, 6, END);
+        return c;
+    }
+
+    private static void section(ByteArrayOutputStream out, int id, ByteArrayOutputStream content) {
+        out.write(id);
+        uleb(out, content.size());
+        out.writeBytes(content.toByteArray());
+    }
+
+    private static void name(ByteArrayOutputStream out, String name) {
+        uleb(out, name.length());
+        out.writeBytes(name.getBytes(StandardCharsets.US_ASCII));
+    }
+
+    private static void ops(ByteArrayOutputStream out, int... ops) {
+        for (int op : ops) {
+            out.write(op);
+        }
+    }
+
+    private static void uleb(ByteArrayOutputStream out, int value) {
+        do {
+            int b = value & 0x7f;
+            value >>>= 7;
+            out.write(value != 0 ? b | 0x80 : b);
+        } while (value != 0);
+    }
+
+    private static void sleb(ByteArrayOutputStream out, int value) {
+        while (true) {
+            int b = value & 0x7f;
+            value >>= 7;
+            if ((value == 0 && (b & 0x40) == 0) || (value == -1 && (b & 0x40) != 0)) {
+                out.write(b);
+                return;
+            }
+            out.write(b | 0x80);
+        }
+    }
+
+    private static void f64(ByteArrayOutputStream out, double value) {
+        long bits = Double.doubleToLongBits(value);
+        for (int i = 0; i < 8; i++) {
+            out.write((int) (bits >>> (i * 8)) & 0xff);
+        }
+    }
+}
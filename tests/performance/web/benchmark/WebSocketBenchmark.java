@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package benchmark;
+
+import static benchmark.BenchmarkSupport.number;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Locale;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+import test.javafx.scene.web.TestHttpServer;
+import test.javafx.scene.web.TestHttpServer.Response;
+
+/**
+ * Measures WebSocket message throughput and round trip latency between
+ * a page and a local echo server.
+ * <p>
+ * The page sends {@code -Dbenchmark.messages} (default 20000) text
+ * messages of {@code -Dbenchmark.size} (default 64) bytes and waits for
+ * every echo, keeping at most a given number of messages in flight: one
+ * ("pingpong", latency bound), 64 ("pipelined") or all of them ("burst",
+ * the real-time dashboard case). For each mode the messages per second
+ * and the 50th, 90th and 99th percentile and maximum round trip times are
+ * printed as JSON and, if {@code -Dbenchmark.output} is set, also written
+ * to that file for trend tracking.
+ * <p>
+ * The echo server is {@code test.javafx.scene.web.TestHttpServer}, so the
+ * javafx.web test classes must be on the class path. It runs headless
+ * with {@code -Dglass.platform=Monocle -Dmonocle.platform=Headless
+ * -Dprism.order=sw}.
+ */
+public class WebSocketBenchmark {
+
+    private static final String[] MODES = { "pingpong", "pipelined", "burst" };
+
+    public static void main(String[] args) throws Exception {
+        int messages = Integer.getInteger("benchmark.messages", 20000);
+        int size = Integer.getInteger("benchmark.size", 64);
+        String output = System.getProperty("benchmark.output");
+
+        TestHttpServer server = new TestHttpServer(
+                request -> Response.webSocket(TestHttpServer.ECHO));
+
+        CountDownLatch startup = new CountDownLatch(1);
+        Platform.startup(startup::countDown);
+        startup.await();
+
+        StringBuilder json = new StringBuilder();
+        json.append(String.format(Locale.ROOT,
+                "{\"benchmark\":\"WebSocketBenchmark\",\"messages\":%d,\"size\":%d,\"modes\":[",
+                messages, size));
+        for (int i = 0; i < MODES.length; i++) {
+            int window = switch (MODES[i]) {
+                case "pingpong" -> 1;
+                case "pipelined" -> 64;
+                default -> messages;
+            };
+            String result = run(server.webSocketURL("/"), messages, size, window);
+            if (i > 0) {
+                json.append(',');
+            }
+            json.append(String.format(Locale.ROOT,
+                    "{\"name\":\"%s\",\"window\":%d,\"messagesPerSecond\":%.0f,"
+                    + "\"p50Millis\":%.3f,\"p90Millis\":%.3f,\"p99Millis\":%.3f,\"maxMillis\":%.3f}",
+                    MODES[i], window,
+                    number(result, "messagesPerSecond"),
+                    number(result, "p50"),
+                    number(result, "p90"),
+                    number(result, "p99"),
+                    number(result, "max")));
+        }
+        json.append("]}");
+
+        System.out.println(json);
+        if (output != null) {
+            Files.writeString(Path.of(output), json + "\n");
+        }
+        server.close();
+        Platform.exit();
+    }
+
+    private static String run(String url, int messages, int size, int window)
+            throws InterruptedException {
+        CountDownLatch done = new CountDownLatch(1);
+        String[] result = new String[1];
+        Platform.runLater(() -> {
+            WebEngine engine = new WebEngine();
+            engine.setOnAlert(event -> {
+                result[0] = event.getData();
+                done.countDown();
+            });
+            engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+                if (n == Worker.State.FAILED) {
+                    done.countDown();
+                }
+            });
+            engine.loadContent(page(url, messages, size, window));
+        });
+        if (!done.await(5, TimeUnit.MINUTES)) {
+            throw new AssertionError("Timed out with window " + window);
+        }
+        if (result[0] == null || result[0].startsWith("error")) {
+            throw new AssertionError("Failed with window " + window + ": " + result[0]);
+        }
+        return result[0];
+    }
+
+    /*
+     * Every message starts with its sequence number, so that the echo can
+     * be matched with the time it was sent.
+     */
+    private static String page(String url, int messages, int size, int window) {
+        return "<!DOCTYPE html><html><body><script>\n"
+            + "var count = " + messages + ", inFlight = " + window + ";\n"
+            + "var padding = new Array(" + Math.max(size - 8, 0) + " + 1).join('x');\n"
+            + "var sent = 0, received = 0, start = 0;\n"
+            + "var sendTimes = new Float64Array(count), latencies = new Float64Array(count);\n"
+            + "var ws = new WebSocket('" + url + "');\n"
+            + "function send() {\n"
+            + "  sendTimes[sent] = performance.now();\n"
+            + "  ws.send(sent + ':' + padding);\n"
+            + "  sent++;\n"
+            + "}\n"
+            + "function percentile(sorted, p) {\n"
+            + "  return sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))];\n"
+            + "}\n"
+            + "ws.onopen = function() {\n"
+            + "  start = performance.now();\n"
+            + "  while (sent < count && sent - received < inFlight) send();\n"
+            + "};\n"
+            + "ws.onmessage = function(e) {\n"
+            + "  var now = performance.now();\n"
+            + "  latencies[received++] = now - sendTimes[parseInt(e.data)];\n"
+            + "  while (sent < count && sent - received < inFlight) send();\n"
+            + "  if (received < count) return;\n"
+            + "  var seconds = (now - start) / 1000;\n"
+            + "  var sorted = Array.prototype.slice.call(latencies).sort(function(a, b) { return a - b; });\n"
+            + "  ws.close();\n"
+            + "  alert(JSON.stringify({ messagesPerSecond: count / seconds,\n"
+            + "      p50: percentile(sorted, 0.5), p90: percentile(sorted, 0.9),\n"
+            + "      p99: percentile(sorted, 0.99), max: sorted[count - 1] }));\n"
+            + "};\n"
+            + "ws.onerror = function() { alert('error'); };\n"
+            + "</script></body></html>";
+    }
+}